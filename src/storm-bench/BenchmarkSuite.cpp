@@ -0,0 +1,156 @@
+#include "storm-bench/BenchmarkSuite.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <regex>
+
+// JSON parser
+#include "json.hpp"
+namespace modernjson {
+    using json = nlohmann::json;
+}
+
+#include "storm/utility/storm-version.h"
+
+namespace storm {
+    namespace bench {
+        namespace detail {
+            double measure(std::function<void()> const& function, uint64_t runs) {
+                auto start = std::chrono::high_resolution_clock::now();
+                for (uint64_t run = 0; run < runs; ++run) {
+                    function();
+                }
+                return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count() / runs;
+            }
+        }
+
+        BenchmarkOptions::BenchmarkOptions() : filter(""), warmupRuns(1), repetitions(10), minimalRepetitionTime(0.1) {
+            // Intentionally left empty.
+        }
+
+        void BenchmarkSuite::addBenchmark(std::string const& name, std::function<std::function<void()>(BenchmarkInformation& information)> const& setUp) {
+            benchmarks.push_back(Benchmark{name, setUp});
+        }
+
+        std::vector<std::string> BenchmarkSuite::getBenchmarkNames(std::string const& filter) const {
+            std::regex filterRegex(filter);
+            std::vector<std::string> result;
+            for (auto const& benchmark : benchmarks) {
+                if (std::regex_search(benchmark.name, filterRegex)) {
+                    result.push_back(benchmark.name);
+                }
+            }
+            return result;
+        }
+
+        std::vector<BenchmarkResult> BenchmarkSuite::run(BenchmarkOptions const& options, std::ostream& out) const {
+            std::regex filterRegex(options.filter);
+            std::vector<BenchmarkResult> results;
+            uint64_t skipped = 0;
+            for (auto const& benchmark : benchmarks) {
+                if (!std::regex_search(benchmark.name, filterRegex)) {
+                    continue;
+                }
+                results.push_back(run(benchmark, options));
+
+                BenchmarkResult const& result = results.back();
+                out << result.name << ": ";
+                if (result.error.empty()) {
+                    out << result.median * 1000 << "ms (median of " << result.repetitions << "x" << result.runsPerRepetition << " runs, min " << result.minimum * 1000 << "ms, rsd " << result.relativeStandardDeviation * 100 << "%)";
+                } else {
+                    out << "skipped (" << result.error << ")";
+                    ++skipped;
+                }
+                out << std::endl;
+            }
+            if (skipped > 0) {
+                out << skipped << " of " << results.size() << " benchmark(s) were skipped." << std::endl;
+            }
+            return results;
+        }
+
+        BenchmarkResult BenchmarkSuite::run(Benchmark const& benchmark, BenchmarkOptions const& options) const {
+            BenchmarkResult result;
+            result.name = benchmark.name;
+            result.runsPerRepetition = 0;
+            result.repetitions = 0;
+            result.minimum = result.median = result.mean = result.maximum = result.relativeStandardDeviation = 0;
+
+            std::vector<double> times;
+            try {
+                std::function<void()> function = benchmark.setUp(result.information);
+
+                // Warm up the caches (and the allocator) and determine how often the function is to be run per
+                // repetition from the fastest warm-up run.
+                double fastestWarmupRun = std::numeric_limits<double>::infinity();
+                for (uint64_t run = 0; run < std::max<uint64_t>(options.warmupRuns, 1); ++run) {
+                    fastestWarmupRun = std::min(fastestWarmupRun, detail::measure(function, 1));
+                }
+                result.runsPerRepetition = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(options.minimalRepetitionTime / std::max(fastestWarmupRun, 1e-9))));
+
+                for (uint64_t repetition = 0; repetition < options.repetitions; ++repetition) {
+                    times.push_back(detail::measure(function, result.runsPerRepetition));
+                }
+            } catch (std::exception const& e) {
+                result.error = e.what();
+                return result;
+            }
+
+            result.repetitions = times.size();
+            if (times.empty()) {
+                return result;
+            }
+            std::sort(times.begin(), times.end());
+            result.minimum = times.front();
+            result.maximum = times.back();
+            result.median = times.size() % 2 == 1 ? times[times.size() / 2] : (times[times.size() / 2 - 1] + times[times.size() / 2]) / 2;
+            result.mean = std::accumulate(times.begin(), times.end(), 0.0) / times.size();
+            double squaredDeviations = 0;
+            for (auto const& time : times) {
+                squaredDeviations += (time - result.mean) * (time - result.mean);
+            }
+            result.relativeStandardDeviation = result.mean > 0 ? std::sqrt(squaredDeviations / times.size()) / result.mean : 0;
+            return result;
+        }
+
+        void BenchmarkSuite::exportToJson(std::vector<BenchmarkResult> const& results, BenchmarkOptions const& options, std::ostream& out) {
+            modernjson::json json;
+            json["storm-version"] = storm::utility::StormVersion::shortVersionString();
+            json["compiler"] = storm::utility::StormVersion::cxxCompiler;
+            json["flags"] = storm::utility::StormVersion::cxxFlags;
+            json["options"]["filter"] = options.filter;
+            json["options"]["warmup-runs"] = options.warmupRuns;
+            json["options"]["repetitions"] = options.repetitions;
+            json["options"]["minimal-repetition-time"] = options.minimalRepetitionTime;
+
+            modernjson::json benchmarksJson = modernjson::json::array();
+            for (auto const& result : results) {
+                modernjson::json resultJson;
+                resultJson["name"] = result.name;
+                modernjson::json informationJson = modernjson::json::object();
+                for (auto const& entry : result.information) {
+                    informationJson[entry.first] = entry.second;
+                }
+                resultJson["information"] = informationJson;
+                if (!result.error.empty()) {
+                    resultJson["error"] = result.error;
+                } else {
+                    resultJson["runs-per-repetition"] = result.runsPerRepetition;
+                    resultJson["repetitions"] = result.repetitions;
+                    resultJson["min"] = result.minimum;
+                    resultJson["median"] = result.median;
+                    resultJson["mean"] = result.mean;
+                    resultJson["max"] = result.maximum;
+                    resultJson["rsd"] = result.relativeStandardDeviation;
+                }
+                benchmarksJson.push_back(resultJson);
+            }
+            json["benchmarks"] = benchmarksJson;
+            out << json.dump(4) << std::endl;
+        }
+
+    }
+}
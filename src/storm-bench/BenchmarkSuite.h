@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace storm {
+    namespace bench {
+
+        /*!
+         * Information about the input of a benchmark (e.g. the number of states), which is exported with the results.
+         */
+        typedef std::map<std::string, uint64_t> BenchmarkInformation;
+
+        /*!
+         * A benchmark is given by a function that prepares the input and returns the function whose running time is
+         * measured. Only the returned function is timed, so it must be repeatable, i.e. it must not consume its input.
+         */
+        struct Benchmark {
+            // The name of the benchmark. By convention, it is of the form <group>/<operation>/<input>.
+            std::string name;
+
+            // Prepares the input of the benchmark, stores information about it and returns the function to measure.
+            std::function<std::function<void()>(BenchmarkInformation& information)> setUp;
+        };
+
+        /*!
+         * The outcome of running a benchmark. All times are given in seconds per run of the measured function.
+         */
+        struct BenchmarkResult {
+            std::string name;
+            BenchmarkInformation information;
+
+            // If set, the benchmark could not be run and this is the reason.
+            std::string error;
+
+            // The number of runs of the measured function per repetition and the number of repetitions.
+            uint64_t runsPerRepetition;
+            uint64_t repetitions;
+
+            double minimum;
+            double median;
+            double mean;
+            double maximum;
+
+            // The standard deviation relative to the mean.
+            double relativeStandardDeviation;
+        };
+
+        /*!
+         * Options that control how the benchmarks are run.
+         */
+        struct BenchmarkOptions {
+            BenchmarkOptions();
+
+            // Only benchmarks whose name matches this regular expression are run.
+            std::string filter;
+
+            // The number of runs before the measurement starts. These also determine how often the measured function is
+            // run per repetition.
+            uint64_t warmupRuns;
+
+            // The number of measured repetitions.
+            uint64_t repetitions;
+
+            // The minimal time (in seconds) of a repetition. Fast functions are run several times per repetition to
+            // reach this time, which makes the measurement robust against the resolution of the clock.
+            double minimalRepetitionTime;
+        };
+
+        /*!
+         * A collection of benchmarks that can be run and whose results can be exported as JSON.
+         */
+        class BenchmarkSuite {
+        public:
+            /*!
+             * Adds the given benchmark to the suite.
+             */
+            void addBenchmark(std::string const& name, std::function<std::function<void()>(BenchmarkInformation& information)> const& setUp);
+
+            /*!
+             * Retrieves the names of all benchmarks that match the given filter.
+             */
+            std::vector<std::string> getBenchmarkNames(std::string const& filter = "") const;
+
+            /*!
+             * Runs all benchmarks that match the filter of the given options, prints a summary line per benchmark to
+             * the given stream and returns the results. Benchmarks that throw an exception are reported with the
+             * corresponding error instead of aborting the suite, and the number of such benchmarks is printed at the end.
+             */
+            std::vector<BenchmarkResult> run(BenchmarkOptions const& options, std::ostream& out) const;
+
+            /*!
+             * Writes the given results (and the options with which they were obtained) as JSON to the given stream.
+             */
+            static void exportToJson(std::vector<BenchmarkResult> const& results, BenchmarkOptions const& options, std::ostream& out);
+
+        private:
+            BenchmarkResult run(Benchmark const& benchmark, BenchmarkOptions const& options) const;
+
+            // The benchmarks of the suite in the order in which they were added.
+            std::vector<Benchmark> benchmarks;
+        };
+
+        /*!
+         * Adds the micro-benchmarks of the core data structures and algorithms to the given suite.
+         */
+        void addMicroBenchmarks(BenchmarkSuite& suite);
+
+        /*!
+         * Adds the macro-benchmarks (building and checking models with the individual engines and solvers) to the
+         * given suite.
+         */
+        void addMacroBenchmarks(BenchmarkSuite& suite);
+
+    }
+}
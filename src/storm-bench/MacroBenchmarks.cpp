@@ -0,0 +1,254 @@
+#include "storm-bench/BenchmarkSuite.h"
+
+#include <set>
+
+#include "storm-config.h"
+
+#include "storm/api/storm.h"
+#include "storm/logic/Formula.h"
+#include "storm/modelchecker/CheckTask.h"
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/HybridDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/HybridMdpPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/MinMaxEquationSolverSettings.h"
+#include "storm/solver/EigenLinearEquationSolver.h"
+#include "storm/solver/EliminationLinearEquationSolver.h"
+#include "storm/solver/GmmxxLinearEquationSolver.h"
+#include "storm/solver/NativeLinearEquationSolver.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/SolverSelectionOptions.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+namespace storm {
+    namespace bench {
+        namespace detail {
+            // A model from the bundled resources together with the property that is checked on it.
+            struct PropertyInput {
+                std::string name;
+                std::string filename;
+                std::string property;
+                
+                // For MDPs, the min/max methods that can check the property with the engines that solve explicitly
+                // (sparse and hybrid) and with the dd engine, respectively.
+                std::set<storm::solver::MinMaxMethod> explicitMethods;
+                std::set<storm::solver::MinMaxMethod> symbolicMethods;
+            };
+
+            static const std::vector<PropertyInput> DTMC_PROPERTY_INPUTS = {
+                {"brp-16-2", STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", "P=? [F \"target\"]"},
+                {"crowds-5-5", STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", "P=? [F \"observe0Greater1\"]"},
+                {"leader-3-5", STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm", "R{\"num_rounds\"}=? [F \"elected\"]"},
+                {"nand-5-2", STORM_TEST_RESOURCES_DIR "/dtmc/nand-5-2.pm", "P=? [F \"target\"]"}
+            };
+
+            // The symbolic interval iteration neither computes upper reward bounds nor eliminates end components, so it
+            // is only applicable to minimal probabilities, whose solution is unique. No upper bounds on maximal rewards
+            // can be computed for leader4, so interval iteration is not applicable there at all.
+            static const std::vector<PropertyInput> MDP_PROPERTY_INPUTS = {
+                {"coin2-2", STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm", "Pmin=? [F \"finished\" & \"all_coins_equal_1\"]",
+                    {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::PolicyIteration, storm::solver::MinMaxMethod::IntervalIteration, storm::solver::MinMaxMethod::LinearProgramming},
+                    {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::PolicyIteration, storm::solver::MinMaxMethod::IntervalIteration}},
+                {"csma2-2", STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm", "Pmax=? [F \"collision_max_backoff\"]",
+                    {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::PolicyIteration, storm::solver::MinMaxMethod::IntervalIteration, storm::solver::MinMaxMethod::LinearProgramming},
+                    {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::PolicyIteration}},
+                {"firewire3-0.5", STORM_TEST_RESOURCES_DIR "/mdp/firewire3-0.5.nm", "R{\"time\"}min=? [F \"elected\"]",
+                    {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::PolicyIteration, storm::solver::MinMaxMethod::IntervalIteration, storm::solver::MinMaxMethod::LinearProgramming},
+                    {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::PolicyIteration}},
+                {"leader4", STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm", "Rmax=? [F \"elected\"]",
+                    {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::PolicyIteration, storm::solver::MinMaxMethod::LinearProgramming},
+                    {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::PolicyIteration}},
+                {"wlan0-2-2", STORM_TEST_RESOURCES_DIR "/mdp/wlan0-2-2.nm", "Pmax=? [F \"twoCollisions\"]",
+                    {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::PolicyIteration, storm::solver::MinMaxMethod::IntervalIteration, storm::solver::MinMaxMethod::LinearProgramming},
+                    {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::PolicyIteration}}
+            };
+
+            // The linear equation solvers with which the explicit parts of the DTMC engines are benchmarked.
+            static const std::vector<std::pair<std::string, std::function<std::unique_ptr<storm::solver::LinearEquationSolverFactory<double>>()>>> LINEAR_EQUATION_SOLVERS = {
+                {"native", [] () { return std::make_unique<storm::solver::NativeLinearEquationSolverFactory<double>>(); }},
+                {"gmmxx", [] () { return std::make_unique<storm::solver::GmmxxLinearEquationSolverFactory<double>>(); }},
+                {"eigen", [] () { return std::make_unique<storm::solver::EigenLinearEquationSolverFactory<double>>(); }},
+                {"elimination", [] () { return std::make_unique<storm::solver::EliminationLinearEquationSolverFactory<double>>(); }}
+            };
+
+            // The methods with which min/max equation systems are benchmarked.
+            static const std::vector<std::pair<std::string, storm::solver::MinMaxMethod>> MIN_MAX_METHODS = {
+                {"vi", storm::solver::MinMaxMethod::ValueIteration},
+                {"pi", storm::solver::MinMaxMethod::PolicyIteration},
+                {"ii", storm::solver::MinMaxMethod::IntervalIteration},
+                {"lp", storm::solver::MinMaxMethod::LinearProgramming}
+            };
+
+            /*!
+             * Retrieves whether the selected LP solver is available in this build.
+             */
+            bool isLpSolverAvailable() {
+                switch (storm::settings::getModule<storm::settings::modules::CoreSettings>().getLpSolver()) {
+                    case storm::solver::LpSolverType::Glpk:
+#ifdef STORM_HAVE_GLPK
+                        return true;
+#else
+                        return false;
+#endif
+                    case storm::solver::LpSolverType::Gurobi:
+#ifdef STORM_HAVE_GUROBI
+                        return true;
+#else
+                        return false;
+#endif
+                    case storm::solver::LpSolverType::Z3:
+#ifdef STORM_HAVE_Z3_OPTIMIZE
+                        return true;
+#else
+                        return false;
+#endif
+                }
+                return false;
+            }
+            
+            /*!
+             * Sets the min/max method in the settings for the lifetime of the object and restores the previous method
+             * afterwards.
+             */
+            class MinMaxMethodMemento {
+            public:
+                MinMaxMethodMemento(storm::solver::MinMaxMethod const& method) : previousMethod(storm::settings::getModule<storm::settings::modules::MinMaxEquationSolverSettings>().getMinMaxEquationSolvingMethod()) {
+                    storm::settings::mutableMinMaxEquationSolverSettings().setMinMaxEquationSolvingMethod(method);
+                }
+                
+                ~MinMaxMethodMemento() {
+                    storm::settings::mutableMinMaxEquationSolverSettings().setMinMaxEquationSolvingMethod(previousMethod);
+                }
+                
+            private:
+                storm::solver::MinMaxMethod previousMethod;
+            };
+
+            // The parsed input of a macro-benchmark.
+            struct ParsedInput {
+                storm::storage::SymbolicModelDescription model;
+                std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+            };
+
+            std::shared_ptr<ParsedInput> parseInput(PropertyInput const& input) {
+                auto result = std::make_shared<ParsedInput>();
+                storm::prism::Program program = storm::api::parseProgram(input.filename);
+                result->formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(input.property, program));
+                result->model = program;
+                return result;
+            }
+
+            storm::modelchecker::CheckTask<storm::logic::Formula, double> createTask(ParsedInput const& input) {
+                return storm::modelchecker::CheckTask<storm::logic::Formula, double>(*input.formulas.front(), true);
+            }
+
+            /*!
+             * Adds a benchmark that builds the model with the given engine and checks the property using the given
+             * function. Parsing is done beforehand and is not measured.
+             */
+            template<typename ModelType>
+            void addMacroBenchmark(BenchmarkSuite& suite, PropertyInput const& input, std::string const& engine, std::string const& solver, std::function<std::shared_ptr<ModelType>(ParsedInput const&)> const& build, std::function<void(ModelType const&, ParsedInput const&)> const& check) {
+                suite.addBenchmark("macro/" + engine + "/" + solver + "/" + input.name, [input, build, check] (BenchmarkInformation& information) {
+                    std::shared_ptr<ParsedInput> parsedInput = parseInput(input);
+
+                    // Build the model once to report its size.
+                    std::shared_ptr<ModelType> model = build(*parsedInput);
+                    information["states"] = model->getNumberOfStates();
+                    information["transitions"] = model->getNumberOfTransitions();
+
+                    return [parsedInput, build, check] () {
+                        std::shared_ptr<ModelType> model = build(*parsedInput);
+                        check(*model, *parsedInput);
+                    };
+                });
+            }
+
+            template<typename ModelType>
+            std::shared_ptr<ModelType> buildSparse(ParsedInput const& input) {
+                return storm::api::buildSparseModel<double>(input.model, input.formulas)->template as<ModelType>();
+            }
+
+            template<typename ModelType>
+            std::shared_ptr<ModelType> buildSymbolic(ParsedInput const& input) {
+                return storm::api::buildSymbolicModel<storm::dd::DdType::CUDD, double>(input.model, input.formulas)->template as<ModelType>();
+            }
+
+            void addDtmcBenchmarks(BenchmarkSuite& suite, PropertyInput const& input) {
+                typedef storm::models::sparse::Dtmc<double> SparseDtmc;
+                typedef storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double> SymbolicDtmc;
+
+                for (auto const& solver : LINEAR_EQUATION_SOLVERS) {
+                    auto factory = solver.second;
+                    addMacroBenchmark<SparseDtmc>(suite, input, "sparse", solver.first, buildSparse<SparseDtmc>, [factory] (SparseDtmc const& dtmc, ParsedInput const& parsedInput) {
+                        storm::modelchecker::SparseDtmcPrctlModelChecker<SparseDtmc> checker(dtmc, factory());
+                        checker.check(createTask(parsedInput));
+                    });
+                    addMacroBenchmark<SymbolicDtmc>(suite, input, "hybrid", solver.first, buildSymbolic<SymbolicDtmc>, [factory] (SymbolicDtmc const& dtmc, ParsedInput const& parsedInput) {
+                        storm::modelchecker::HybridDtmcPrctlModelChecker<SymbolicDtmc> checker(dtmc, factory());
+                        checker.check(createTask(parsedInput));
+                    });
+                }
+                addMacroBenchmark<SymbolicDtmc>(suite, input, "dd", "default", buildSymbolic<SymbolicDtmc>, [] (SymbolicDtmc const& dtmc, ParsedInput const& parsedInput) {
+                    storm::modelchecker::SymbolicDtmcPrctlModelChecker<SymbolicDtmc> checker(dtmc);
+                    checker.check(createTask(parsedInput));
+                });
+            }
+
+            void addMdpBenchmarks(BenchmarkSuite& suite, PropertyInput const& input) {
+                typedef storm::models::sparse::Mdp<double> SparseMdp;
+                typedef storm::models::symbolic::Mdp<storm::dd::DdType::CUDD, double> SymbolicMdp;
+
+                bool lpSolverAvailable = isLpSolverAvailable();
+                for (auto const& method : MIN_MAX_METHODS) {
+                    storm::solver::MinMaxMethod minMaxMethod = method.second;
+                    if (minMaxMethod == storm::solver::MinMaxMethod::LinearProgramming && !lpSolverAvailable) {
+                        continue;
+                    }
+                    
+                    if (input.explicitMethods.count(minMaxMethod) > 0) {
+                        addMacroBenchmark<SparseMdp>(suite, input, "sparse", method.first, buildSparse<SparseMdp>, [minMaxMethod] (SparseMdp const& mdp, ParsedInput const& parsedInput) {
+                            auto factory = std::make_unique<storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>>();
+                            factory->setMinMaxMethod(minMaxMethod);
+                            storm::modelchecker::SparseMdpPrctlModelChecker<SparseMdp> checker(mdp, std::move(factory));
+                            checker.check(createTask(parsedInput));
+                        });
+                        addMacroBenchmark<SymbolicMdp>(suite, input, "hybrid", method.first, buildSymbolic<SymbolicMdp>, [minMaxMethod] (SymbolicMdp const& mdp, ParsedInput const& parsedInput) {
+                            auto factory = std::make_unique<storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>>();
+                            factory->setMinMaxMethod(minMaxMethod);
+                            storm::modelchecker::HybridMdpPrctlModelChecker<SymbolicMdp> checker(mdp, std::move(factory));
+                            checker.check(createTask(parsedInput));
+                        });
+                    }
+                    
+                    if (input.symbolicMethods.count(minMaxMethod) > 0) {
+                        addMacroBenchmark<SymbolicMdp>(suite, input, "dd", method.first, buildSymbolic<SymbolicMdp>, [minMaxMethod] (SymbolicMdp const& mdp, ParsedInput const& parsedInput) {
+                            // The symbolic solvers take the method from the settings, so it is set temporarily.
+                            MinMaxMethodMemento memento(minMaxMethod);
+                            storm::modelchecker::SymbolicMdpPrctlModelChecker<SymbolicMdp> checker(mdp);
+                            checker.check(createTask(parsedInput));
+                        });
+                    }
+                }
+            }
+        }
+
+        void addMacroBenchmarks(BenchmarkSuite& suite) {
+            for (auto const& input : detail::DTMC_PROPERTY_INPUTS) {
+                detail::addDtmcBenchmarks(suite, input);
+            }
+            for (auto const& input : detail::MDP_PROPERTY_INPUTS) {
+                detail::addMdpBenchmarks(suite, input);
+            }
+        }
+
+    }
+}
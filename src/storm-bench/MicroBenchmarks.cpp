@@ -0,0 +1,268 @@
+#include "storm-bench/BenchmarkSuite.h"
+
+#include <algorithm>
+#include <random>
+#include <set>
+
+#include "storm-config.h"
+
+#include "storm/api/storm.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/NondeterministicModel.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/utility/graph.h"
+
+namespace storm {
+    namespace bench {
+        namespace detail {
+            // The seed of all pseudo-random inputs. The sequence of std::mt19937_64 is fixed by the standard, so the inputs
+            // are the same on all platforms.
+            static const uint64_t SEED = 42;
+
+            // A model from the bundled resources together with the label of the target states.
+            struct ModelInput {
+                std::string name;
+                std::string filename;
+                std::string targetLabel;
+            };
+
+            static const std::vector<ModelInput> DTMC_INPUTS = {
+                {"brp-16-2", STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", "target"},
+                {"crowds-5-5", STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", "observe0Greater1"},
+                {"leader-3-5", STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm", "elected"},
+                {"nand-5-2", STORM_TEST_RESOURCES_DIR "/dtmc/nand-5-2.pm", "target"}
+            };
+
+            static const std::vector<ModelInput> MDP_INPUTS = {
+                {"coin2-2", STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm", "finished"},
+                {"csma2-2", STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm", "all_delivered"},
+                {"firewire3-0.5", STORM_TEST_RESOURCES_DIR "/mdp/firewire3-0.5.nm", "elected"},
+                {"leader4", STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm", "elected"},
+                {"wlan0-2-2", STORM_TEST_RESOURCES_DIR "/mdp/wlan0-2-2.nm", "twoCollisions"}
+            };
+
+            // The dimensions of the synthetic inputs, which are larger than the bundled models and therefore do not fit
+            // into the caches.
+            static const uint64_t SYNTHETIC_STATES = 1000000;
+            static const uint64_t SYNTHETIC_CHOICES = 2;
+            static const uint64_t SYNTHETIC_SUCCESSORS = 4;
+
+            std::shared_ptr<storm::models::sparse::Model<double>> buildModel(std::string const& filename) {
+                storm::prism::Program program = storm::api::parseProgram(filename);
+                return storm::api::buildSparseModel<double>(program, storm::builder::BuilderOptions(false, true));
+            }
+
+            void addModelInformation(storm::storage::SparseMatrix<double> const& matrix, BenchmarkInformation& information) {
+                information["states"] = matrix.getRowGroupCount();
+                information["choices"] = matrix.getRowCount();
+                information["transitions"] = matrix.getEntryCount();
+            }
+
+            /*!
+             * Creates a matrix with the given number of row groups (states), rows (choices) per group and pseudo-random
+             * successors per row. If there is only one choice per state, the matrix has the trivial row grouping.
+             */
+            storm::storage::SparseMatrix<double> createSyntheticMatrix(uint64_t numberOfStates, uint64_t choicesPerState, uint64_t successorsPerChoice) {
+                std::mt19937_64 generator(SEED);
+                bool nondeterministic = choicesPerState > 1;
+                storm::storage::SparseMatrixBuilder<double> builder(numberOfStates * choicesPerState, numberOfStates, numberOfStates * choicesPerState * successorsPerChoice, true, nondeterministic, nondeterministic ? numberOfStates : 0);
+                uint64_t row = 0;
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    if (nondeterministic) {
+                        builder.newRowGroup(row);
+                    }
+                    for (uint64_t choice = 0; choice < choicesPerState; ++choice, ++row) {
+                        // Successors are mostly local (as in models of communicating processes) with a few jumps.
+                        std::set<uint64_t> successors;
+                        while (successors.size() < successorsPerChoice) {
+                            uint64_t random = generator();
+                            if (random % 8 == 0) {
+                                successors.insert((random >> 3) % numberOfStates);
+                            } else {
+                                successors.insert((state + (random >> 3) % 64) % numberOfStates);
+                            }
+                        }
+                        for (auto const& successor : successors) {
+                            builder.addNextValue(row, successor, 1.0 / successorsPerChoice);
+                        }
+                    }
+                }
+                return builder.build();
+            }
+
+            std::vector<double> createVector(uint64_t size) {
+                std::vector<double> result(size);
+                for (uint64_t index = 0; index < size; ++index) {
+                    result[index] = static_cast<double>(index % 100) / 100.0;
+                }
+                return result;
+            }
+
+            void addMatrixBenchmarks(BenchmarkSuite& suite, std::string const& inputName, std::function<storm::storage::SparseMatrix<double>()> const& matrixFunction, bool nondeterministic) {
+                if (nondeterministic) {
+                    suite.addBenchmark("micro/SparseMatrix::multiplyAndReduce/" + inputName, [matrixFunction] (BenchmarkInformation& information) {
+                        auto matrix = std::make_shared<storm::storage::SparseMatrix<double>>(matrixFunction());
+                        addModelInformation(*matrix, information);
+                        auto x = std::make_shared<std::vector<double>>(createVector(matrix->getColumnCount()));
+                        auto result = std::make_shared<std::vector<double>>(matrix->getRowGroupCount());
+                        return [matrix, x, result] () {
+                            matrix->multiplyAndReduce(storm::solver::OptimizationDirection::Maximize, matrix->getRowGroupIndices(), *x, nullptr, *result, nullptr);
+                        };
+                    });
+                } else {
+                    suite.addBenchmark("micro/SparseMatrix::multiplyWithVector/" + inputName, [matrixFunction] (BenchmarkInformation& information) {
+                        auto matrix = std::make_shared<storm::storage::SparseMatrix<double>>(matrixFunction());
+                        addModelInformation(*matrix, information);
+                        auto x = std::make_shared<std::vector<double>>(createVector(matrix->getColumnCount()));
+                        auto result = std::make_shared<std::vector<double>>(matrix->getRowCount());
+                        return [matrix, x, result] () {
+                            matrix->multiplyWithVector(*x, *result);
+                        };
+                    });
+                }
+
+                suite.addBenchmark("micro/SparseMatrix::transpose/" + inputName, [matrixFunction] (BenchmarkInformation& information) {
+                    auto matrix = std::make_shared<storm::storage::SparseMatrix<double>>(matrixFunction());
+                    addModelInformation(*matrix, information);
+                    return [matrix] () {
+                        matrix->transpose(true);
+                    };
+                });
+
+                suite.addBenchmark("micro/StronglyConnectedComponentDecomposition/" + inputName, [matrixFunction] (BenchmarkInformation& information) {
+                    auto matrix = std::make_shared<storm::storage::SparseMatrix<double>>(matrixFunction());
+                    addModelInformation(*matrix, information);
+                    return [matrix] () {
+                        storm::storage::StronglyConnectedComponentDecomposition<double> decomposition(*matrix);
+                    };
+                });
+            }
+
+            void addProb01Benchmarks(BenchmarkSuite& suite) {
+                for (auto const& input : DTMC_INPUTS) {
+                    suite.addBenchmark("micro/graph::performProb01/" + input.name, [input] (BenchmarkInformation& information) {
+                        auto model = buildModel(input.filename);
+                        addModelInformation(model->getTransitionMatrix(), information);
+                        auto backwardTransitions = std::make_shared<storm::storage::SparseMatrix<double>>(model->getBackwardTransitions());
+                        storm::storage::BitVector phiStates(model->getNumberOfStates(), true);
+                        storm::storage::BitVector psiStates = model->getStates(input.targetLabel);
+                        return [backwardTransitions, phiStates, psiStates] () {
+                            storm::utility::graph::performProb01(*backwardTransitions, phiStates, psiStates);
+                        };
+                    });
+                }
+                for (auto const& input : MDP_INPUTS) {
+                    for (auto const& direction : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+                        std::string name = direction == storm::solver::OptimizationDirection::Minimize ? "performProb01Min" : "performProb01Max";
+                        suite.addBenchmark("micro/graph::" + name + "/" + input.name, [input, direction] (BenchmarkInformation& information) {
+                            auto model = buildModel(input.filename)->as<storm::models::sparse::NondeterministicModel<double>>();
+                            addModelInformation(model->getTransitionMatrix(), information);
+                            auto backwardTransitions = std::make_shared<storm::storage::SparseMatrix<double>>(model->getBackwardTransitions());
+                            storm::storage::BitVector phiStates(model->getNumberOfStates(), true);
+                            storm::storage::BitVector psiStates = model->getStates(input.targetLabel);
+                            return [model, backwardTransitions, phiStates, psiStates, direction] () {
+                                if (direction == storm::solver::OptimizationDirection::Minimize) {
+                                    storm::utility::graph::performProb01Min(model->getTransitionMatrix(), model->getNondeterministicChoiceIndices(), *backwardTransitions, phiStates, psiStates);
+                                } else {
+                                    storm::utility::graph::performProb01Max(model->getTransitionMatrix(), model->getNondeterministicChoiceIndices(), *backwardTransitions, phiStates, psiStates);
+                                }
+                            };
+                        });
+                    }
+                }
+            }
+
+            void addBitVectorHashMapBenchmarks(BenchmarkSuite& suite) {
+                // Insert (and then find) as many keys as states are typically explored, using key sizes of small and
+                // large state encodings.
+                for (auto const& bitsPerKey : {32ull, 200ull}) {
+                    suite.addBenchmark("micro/BitVectorHashMap::findOrAdd/" + std::to_string(bitsPerKey) + "bit", [bitsPerKey] (BenchmarkInformation& information) {
+                        uint64_t numberOfKeys = 100000;
+                        information["keys"] = numberOfKeys;
+                        information["bits"] = bitsPerKey;
+
+                        std::mt19937_64 generator(SEED);
+                        auto keys = std::make_shared<std::vector<storm::storage::BitVector>>();
+                        keys->reserve(numberOfKeys);
+                        for (uint64_t key = 0; key < numberOfKeys; ++key) {
+                            storm::storage::BitVector bitVector(bitsPerKey);
+                            for (uint64_t bit = 0; bit < bitsPerKey; bit += 32) {
+                                uint64_t numberOfBits = std::min<uint64_t>(32, bitsPerKey - bit);
+                                bitVector.setFromInt(bit, numberOfBits, generator() & ((1ull << numberOfBits) - 1));
+                            }
+                            keys->push_back(std::move(bitVector));
+                        }
+
+                        return [keys, bitsPerKey] () {
+                            storm::storage::BitVectorHashMap<uint32_t> map(bitsPerKey);
+                            uint32_t index = 0;
+                            for (auto const& key : *keys) {
+                                map.findOrAdd(key, index++);
+                            }
+                            for (auto const& key : *keys) {
+                                map.findOrAdd(key, index);
+                            }
+                        };
+                    });
+                }
+            }
+
+            void addExpressionEvaluatorBenchmarks(BenchmarkSuite& suite) {
+                // Evaluates a guard and an update as they occur in PRISM models for many valuations, which is what the
+                // explicit model builder spends a large part of its time on.
+                suite.addBenchmark("micro/ExpressionEvaluator/guard-and-update", [] (BenchmarkInformation& information) {
+                    uint64_t numberOfValuations = 100000;
+                    information["valuations"] = numberOfValuations;
+
+                    auto manager = std::make_shared<storm::expressions::ExpressionManager>();
+                    storm::expressions::Variable x = manager->declareIntegerVariable("x");
+                    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+                    storm::expressions::Variable b = manager->declareBooleanVariable("b");
+                    storm::expressions::Variable p = manager->declareRationalVariable("p");
+                    storm::expressions::Expression guard = (storm::expressions::ite(b.getExpression(), x.getExpression() * manager->integer(3) + y.getExpression(), x.getExpression() - y.getExpression() * manager->integer(2)) > manager->integer(10)) && (x.getExpression() + y.getExpression() < manager->integer(100));
+                    storm::expressions::Expression update = storm::expressions::ite(x.getExpression() < y.getExpression(), p.getExpression(), manager->rational(1.0) - p.getExpression()) * manager->rational(0.5);
+                    auto evaluator = std::make_shared<storm::expressions::ExpressionEvaluator<double>>(*manager);
+
+                    return [manager, x, y, b, p, guard, update, evaluator, numberOfValuations] () {
+                        double sum = 0;
+                        for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                            evaluator->setIntegerValue(x, valuation % 50);
+                            evaluator->setIntegerValue(y, (valuation / 50) % 60);
+                            evaluator->setBooleanValue(b, valuation % 3 == 0);
+                            evaluator->setRationalValue(p, static_cast<double>(valuation % 10) / 10.0);
+                            if (evaluator->asBool(guard)) {
+                                sum += evaluator->asRational(update);
+                            }
+                        }
+                        // Prevent the evaluation from being optimized away.
+                        volatile double result = sum;
+                        (void) result;
+                    };
+                });
+            }
+        }
+
+        void addMicroBenchmarks(BenchmarkSuite& suite) {
+            for (auto const& input : detail::DTMC_INPUTS) {
+                detail::addMatrixBenchmarks(suite, input.name, [input] () { return detail::buildModel(input.filename)->getTransitionMatrix(); }, false);
+            }
+            detail::addMatrixBenchmarks(suite, "synthetic-dtmc", [] () { return detail::createSyntheticMatrix(detail::SYNTHETIC_STATES, 1, detail::SYNTHETIC_SUCCESSORS); }, false);
+            for (auto const& input : detail::MDP_INPUTS) {
+                detail::addMatrixBenchmarks(suite, input.name, [input] () { return detail::buildModel(input.filename)->getTransitionMatrix(); }, true);
+            }
+            detail::addMatrixBenchmarks(suite, "synthetic-mdp", [] () { return detail::createSyntheticMatrix(detail::SYNTHETIC_STATES, detail::SYNTHETIC_CHOICES, detail::SYNTHETIC_SUCCESSORS); }, true);
+
+            detail::addProb01Benchmarks(suite);
+            detail::addBitVectorHashMapBenchmarks(suite);
+            detail::addExpressionEvaluatorBenchmarks(suite);
+        }
+
+    }
+}
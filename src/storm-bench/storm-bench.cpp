@@ -0,0 +1,95 @@
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "storm-bench/BenchmarkSuite.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/file.h"
+#include "storm/utility/initialize.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/BaseException.h"
+
+namespace {
+    void printUsage() {
+        std::cout << "Usage: storm-bench [options] [storm options]" << std::endl << std::endl;
+        std::cout << "Runs the micro- and macro-benchmarks of Storm. Options that are not listed below are passed to Storm," << std::endl;
+        std::cout << "e.g. to compare the benchmarks with different solver settings. Benchmarks that cannot be run are reported" << std::endl;
+        std::cout << "as skipped." << std::endl << std::endl;
+        std::cout << "  --filter <regex>     only run the benchmarks whose name matches the regular expression" << std::endl;
+        std::cout << "  --list               list the names of the (matching) benchmarks instead of running them" << std::endl;
+        std::cout << "  --warmup <n>         the number of unmeasured runs before measuring (default: 1)" << std::endl;
+        std::cout << "  --repetitions <n>    the number of measured repetitions (default: 10)" << std::endl;
+        std::cout << "  --min-time <s>       the minimal time of a repetition in seconds (default: 0.1)" << std::endl;
+        std::cout << "  --json <filename>    write the results as JSON to the given file" << std::endl;
+        std::cout << "  --help               print this help" << std::endl;
+    }
+}
+
+/*!
+ * Main entry point of the executable storm-bench.
+ */
+int main(const int argc, const char** argv) {
+    try {
+        storm::utility::setUp();
+        storm::settings::initializeAll("Storm-bench", "storm-bench");
+
+        storm::bench::BenchmarkOptions options;
+        std::string jsonFilename;
+        bool list = false;
+        std::vector<std::string> stormArguments;
+        for (int i = 1; i < argc; ++i) {
+            std::string argument = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (argument == "--help") {
+                printUsage();
+                return 0;
+            } else if (argument == "--list") {
+                list = true;
+            } else if (argument == "--filter" && hasValue) {
+                options.filter = argv[++i];
+            } else if (argument == "--warmup" && hasValue) {
+                options.warmupRuns = std::stoull(argv[++i]);
+            } else if (argument == "--repetitions" && hasValue) {
+                options.repetitions = std::stoull(argv[++i]);
+            } else if (argument == "--min-time" && hasValue) {
+                options.minimalRepetitionTime = std::stod(argv[++i]);
+            } else if (argument == "--json" && hasValue) {
+                jsonFilename = argv[++i];
+            } else {
+                stormArguments.push_back(argument);
+            }
+        }
+        storm::settings::mutableManager().setFromExplodedString(stormArguments);
+
+        storm::bench::BenchmarkSuite suite;
+        storm::bench::addMicroBenchmarks(suite);
+        storm::bench::addMacroBenchmarks(suite);
+
+        if (list) {
+            for (auto const& name : suite.getBenchmarkNames(options.filter)) {
+                std::cout << name << std::endl;
+            }
+            return 0;
+        }
+
+        std::vector<storm::bench::BenchmarkResult> results = suite.run(options, std::cout);
+        if (!jsonFilename.empty()) {
+            std::ofstream stream;
+            storm::utility::openFile(jsonFilename, stream);
+            storm::bench::BenchmarkSuite::exportToJson(results, options, stream);
+            storm::utility::closeFile(stream);
+        }
+
+        storm::utility::cleanUp();
+        return 0;
+    } catch (storm::exceptions::BaseException const& exception) {
+        STORM_LOG_ERROR("An exception caused storm-bench to terminate. The message of the exception is: " << exception.what());
+        return 1;
+    } catch (std::exception const& exception) {
+        STORM_LOG_ERROR("An unexpected exception occurred and caused storm-bench to terminate. The message of this exception is: " << exception.what());
+        return 2;
+    }
+}
@@ -8,6 +8,9 @@
 
 #include "storm/utility/initialize.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/instrumentation.h"
+
+#include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
 #include <type_traits>
 #include <ctime>
@@ -59,6 +62,9 @@ namespace storm {
             if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
                 storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
             }
+            if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isProfileSet()) {
+                storm::utility::instrumentation::exportToJsonFile(storm::settings::getModule<storm::settings::modules::ResourceSettings>().getProfileFilename());
+            }
 
             storm::utility::cleanUp();
             return 0;
@@ -183,6 +189,16 @@ namespace storm {
             if (resources.isTimeoutSet()) {
                 storm::utility::resources::setCPULimit(resources.getTimeoutInSeconds());
             }
+            
+            // Likewise for the memory limit.
+            if (resources.isMemoryLimitSet()) {
+                storm::utility::resources::setMemoryLimit(resources.getMemoryLimitInMegabytes());
+            }
+            
+            // Start recording the phases as early as possible if a profile is requested.
+            if (resources.isProfileSet()) {
+                storm::utility::instrumentation::enable();
+            }
         }
         
         void setLogLevel() {
@@ -262,6 +278,7 @@ namespace storm {
                 std::cout << "  * wallclock time: " << (wallclockMilliseconds/1000) << "." << std::setw(3) << (wallclockMilliseconds % 1000) << "s" << std::endl;
             }
             std::cout.fill(oldFillChar);
+            storm::dd::InternalDdManager<storm::dd::DdType::Sylvan>::printStatistics(std::cout);
         }
         
     }
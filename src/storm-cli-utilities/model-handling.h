@@ -10,6 +10,7 @@
 #include "storm/utility/initialize.h"
 #include "storm/utility/Stopwatch.h"
 
+#include <new>
 #include <type_traits>
 
 
@@ -33,6 +34,12 @@
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
 #include "storm/settings/modules/JaniExportSettings.h"
+#include "storm/settings/modules/MinMaxEquationSolverSettings.h"
+
+#include "storm/exceptions/BaseException.h"
+
+#include "storm/utility/engine.h"
+#include "storm/utility/instrumentation.h"
 
 #include "storm/utility/Stopwatch.h"
 
@@ -115,7 +122,8 @@ namespace storm {
             // Check whether conversion for PRISM to JANI is requested or necessary.
             if (input.model && input.model.get().isPrismProgram()) {
                 bool transformToJani = ioSettings.isPrismToJaniSet();
-                bool transformToJaniForJit = coreSettings.getEngine() == storm::settings::modules::CoreSettings::Engine::Sparse && buildSettings.isJitSet();
+                // The automatic engine selection may pick the sparse engine, so the JIT-based builder may be used then as well.
+                bool transformToJaniForJit = (coreSettings.getEngine() == storm::settings::modules::CoreSettings::Engine::Sparse || coreSettings.getEngine() == storm::settings::modules::CoreSettings::Engine::Automatic) && buildSettings.isJitSet();
                 STORM_LOG_WARN_COND(transformToJani || !transformToJaniForJit, "The JIT-based model builder is only available for JANI models, automatically converting the PRISM input model.");
                 transformToJani |= transformToJaniForJit;
 
@@ -153,6 +161,7 @@ namespace storm {
         }
 
         SymbolicInput parseAndPreprocessSymbolicInput() {
+            storm::utility::instrumentation::ScopedPhase phase("parsing");
             SymbolicInput input = parseSymbolicInput();
             input = preprocessSymbolicInput(input);
             exportSymbolicInput(input);
@@ -207,6 +216,7 @@ namespace storm {
 
         template <storm::dd::DdType DdType, typename ValueType>
         std::shared_ptr<storm::models::ModelBase> buildModel(storm::settings::modules::CoreSettings::Engine const& engine, SymbolicInput const& input, storm::settings::modules::IOSettings const& ioSettings) {
+            storm::utility::instrumentation::ScopedPhase phase("model building");
             storm::utility::Stopwatch modelBuildingWatch(true);
             auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
 
@@ -324,6 +334,7 @@ namespace storm {
 
         template <storm::dd::DdType DdType, typename ValueType>
         std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
+            storm::utility::instrumentation::ScopedPhase phase("preprocessing");
             storm::utility::Stopwatch preprocessingWatch(true);
 
             std::pair<std::shared_ptr<storm::models::ModelBase>, bool> result = std::make_pair(model, false);
@@ -478,6 +489,7 @@ namespace storm {
         void verifyProperties(std::vector<storm::jani::Property> const& properties, std::function<std::unique_ptr<storm::modelchecker::CheckResult>(std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states)> const& verificationCallback, std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback = PostprocessingIdentity()) {
         for (auto const& property : properties) {
         printModelCheckingProperty(property);
+        storm::utility::instrumentation::ScopedPhase phase("verification");
         storm::utility::Stopwatch watch(true);
         std::unique_ptr<storm::modelchecker::CheckResult> result = verificationCallback(property.getRawFormula(), property.getFilter().getStatesFormula());
         watch.stop();
@@ -597,11 +609,83 @@ namespace storm {
         }
 
         template <storm::dd::DdType DdType, typename ValueType>
-        std::shared_ptr<storm::models::ModelBase> buildPreprocessExportModelWithValueTypeAndDdlib(SymbolicInput const& input, storm::settings::modules::CoreSettings::Engine engine) {
+        typename std::enable_if<DdType != storm::dd::DdType::CUDD || std::is_same<ValueType, double>::value, std::shared_ptr<storm::models::ModelBase>>::type selectEngineAutomatically(SymbolicInput const& input) {
+            storm::settings::modules::CoreSettings::Engine engine = storm::settings::modules::CoreSettings::Engine::Sparse;
+            std::shared_ptr<storm::models::ModelBase> result;
+            
+            if (!input.model) {
+                STORM_LOG_INFO("Selecting sparse engine, because the input model is given explicitly.");
+                storm::settings::mutableCoreSettings().setEngine(engine);
+                return result;
+            }
+            
+            // Probe the model by building it symbolically, which is typically cheap and yields the number of reachable
+            // states and the size of the transition matrix.
+            std::shared_ptr<storm::models::ModelBase> model;
+            storm::utility::instrumentation::ScopedPhase phase("engine selection");
+            storm::utility::Stopwatch probeWatch(true);
+            try {
+                model = buildModelDd<DdType, ValueType>(input);
+            } catch (storm::exceptions::BaseException const& e) {
+                STORM_LOG_INFO("Selecting sparse engine, because the model cannot be built symbolically: " << e.what());
+                storm::settings::mutableCoreSettings().setEngine(engine);
+                return result;
+            } catch (std::bad_alloc const&) {
+                STORM_LOG_WARN("Selecting sparse engine, because the memory was exhausted while building the model symbolically.");
+                storm::settings::mutableCoreSettings().setEngine(engine);
+                return result;
+            }
+            probeWatch.stop();
+            STORM_PRINT("Time for symbolic model construction (engine selection): " << probeWatch << "." << std::endl << std::endl);
+            
+            auto const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+            uint64_t memoryBudget = 0;
+            if (resourceSettings.isMemoryLimitSet()) {
+                memoryBudget = resourceSettings.getMemoryLimitInMegabytes() * 1024 * 1024;
+            } else if (storm::utility::resources::getMemoryLimit() != RLIM_INFINITY) {
+                memoryBudget = storm::utility::resources::getMemoryLimit();
+            }
+            if (memoryBudget > 0) {
+                // The memory taken by the probe (in particular the tables of the DD library) is not released, even if
+                // the model is built again with the sparse engine, so it is not available to the selected engine.
+                uint64_t usedMemory = storm::utility::resources::getUsedMemory();
+                memoryBudget = memoryBudget > usedMemory ? memoryBudget - usedMemory : 1;
+                STORM_LOG_INFO("Memory available for the selected engine: " << memoryBudget / (1024 * 1024) << "MB.");
+            }
+            uint64_t timeBudget = 0;
+            if (resourceSettings.isTimeoutSet() && resourceSettings.getTimeoutInSeconds() > 0) {
+                uint64_t usedTime = storm::utility::resources::usedCPU();
+                timeBudget = resourceSettings.getTimeoutInSeconds() > usedTime ? resourceSettings.getTimeoutInSeconds() - usedTime : 1;
+            }
+            
+            storm::utility::engine::ModelStatistics statistics = storm::utility::engine::getModelStatistics(*model->as<storm::models::symbolic::Model<DdType, ValueType>>());
+            storm::utility::engine::EngineSelection selection = storm::utility::engine::selectEngine(statistics, createFormulasToRespect(input.properties), memoryBudget, timeBudget);
+            engine = selection.engine;
+            storm::settings::mutableCoreSettings().setEngine(engine);
+            if (selection.minMaxMethod && storm::settings::getModule<storm::settings::modules::MinMaxEquationSolverSettings>().isMinMaxEquationSolvingMethodSetFromDefaultValue()) {
+                storm::settings::mutableMinMaxEquationSolverSettings().setMinMaxEquationSolvingMethod(selection.minMaxMethod.get());
+            }
+            
+            // The symbolic engines can reuse the model that was built for probing.
+            if (engine == storm::settings::modules::CoreSettings::Engine::Hybrid || engine == storm::settings::modules::CoreSettings::Engine::Dd) {
+                result = model;
+            }
+            return result;
+        }
+        
+        template <storm::dd::DdType DdType, typename ValueType>
+        typename std::enable_if<DdType == storm::dd::DdType::CUDD && !std::is_same<ValueType, double>::value, std::shared_ptr<storm::models::ModelBase>>::type selectEngineAutomatically(SymbolicInput const& input) {
+            STORM_LOG_INFO("Selecting sparse engine, because CUDD does not support the selected data-type.");
+            storm::settings::mutableCoreSettings().setEngine(storm::settings::modules::CoreSettings::Engine::Sparse);
+            return nullptr;
+        }
+
+        template <storm::dd::DdType DdType, typename ValueType>
+        std::shared_ptr<storm::models::ModelBase> buildPreprocessExportModelWithValueTypeAndDdlib(SymbolicInput const& input, storm::settings::modules::CoreSettings::Engine engine, std::shared_ptr<storm::models::ModelBase> const& builtModel = nullptr) {
             auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
             auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
-            std::shared_ptr<storm::models::ModelBase> model;
-            if (!buildSettings.isNoBuildModelSet()) {
+            std::shared_ptr<storm::models::ModelBase> model = builtModel;
+            if (!model && !buildSettings.isNoBuildModelSet()) {
                 model = buildModel<DdType, ValueType>(engine, input, ioSettings);
             }
 
@@ -624,6 +708,12 @@ namespace storm {
 
         template <storm::dd::DdType DdType, typename ValueType>
         void processInputWithValueTypeAndDdlib(SymbolicInput const& input) {
+            // If requested, select the engine first, as this may also adapt other settings.
+            std::shared_ptr<storm::models::ModelBase> builtModel;
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::settings::modules::CoreSettings::Engine::Automatic) {
+                builtModel = selectEngineAutomatically<DdType, ValueType>(input);
+            }
+            
             auto coreSettings = storm::settings::getModule<storm::settings::modules::CoreSettings>();
 
             // For several engines, no model building step is performed, but the verification is started right away.
@@ -633,7 +723,7 @@ namespace storm {
             } else if (engine == storm::settings::modules::CoreSettings::Engine::Exploration) {
                 verifyWithExplorationEngine<ValueType>(input);
             } else {
-                std::shared_ptr<storm::models::ModelBase> model = buildPreprocessExportModelWithValueTypeAndDdlib<DdType, ValueType>(input, engine);
+                std::shared_ptr<storm::models::ModelBase> model = buildPreprocessExportModelWithValueTypeAndDdlib<DdType, ValueType>(input, engine, builtModel);
 
                 if (model) {
                     if (coreSettings.isCounterexampleSet()) {
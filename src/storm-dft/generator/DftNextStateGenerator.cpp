@@ -78,7 +78,8 @@ namespace storm {
                 STORM_LOG_ASSERT(!mDft.hasFailed(state), "Dft has failed.");
 
                 // Construct new state as copy from original one
-                DFTStatePointer newState = state->copy();
+                copyToScratchState(scratchState, *state);
+                DFTStatePointer const& newState = scratchState;
                 std::pair<std::shared_ptr<storm::storage::DFTBE<ValueType> const>, bool> nextBEPair = newState->letNextBEFail(currentFailable);
                 std::shared_ptr<storm::storage::DFTBE<ValueType> const>& nextBE = nextBEPair.first;
                 STORM_LOG_ASSERT(nextBE, "NextBE is null.");
@@ -153,7 +154,8 @@ namespace storm {
 
                     if (!storm::utility::isOne(probability)) {
                         // Add transition to state where dependency was unsuccessful
-                        DFTStatePointer unsuccessfulState = state->copy();
+                        copyToScratchState(unsuccessfulScratchState, *state);
+                        DFTStatePointer const& unsuccessfulState = unsuccessfulScratchState;
                         unsuccessfulState->letDependencyBeUnsuccessful(currentFailable);
                         // Add state
                         StateType unsuccessfulStateId = stateToIdCallback(unsuccessfulState);
@@ -189,6 +191,16 @@ namespace storm {
             return result;
         }
 
+        template<typename ValueType, typename StateType>
+        void DftNextStateGenerator<ValueType, StateType>::copyToScratchState(DFTStatePointer& scratch, storm::storage::DFTState<ValueType> const& original) const {
+            if (scratch && scratch.use_count() == 1) {
+                // Nobody else refers to the scratch state, so we can overwrite it
+                scratch->copyFrom(original);
+            } else {
+                scratch = original.copy();
+            }
+        }
+
         template<typename ValueType, typename StateType>
         StateBehavior<ValueType, StateType> DftNextStateGenerator<ValueType, StateType>::createMergeFailedState(StateToIdCallback const& stateToIdCallback) {
             STORM_LOG_ASSERT(mergeFailedStates, "No unique failed state used.");
@@ -43,6 +43,16 @@ namespace storm {
             StateBehavior<ValueType, StateType> createMergeFailedState(StateToIdCallback const& stateToIdCallback);
 
         private:
+
+            /*!
+             * Copy the given state into the given scratch state.
+             * The memory of the scratch state is reused unless the scratch state was kept by someone else (e.g. because
+             * it was registered as a new state). In that case a fresh copy is allocated.
+             *
+             * @param scratch  Scratch state which is overwritten.
+             * @param original State to copy.
+             */
+            void copyToScratchState(DFTStatePointer& scratch, storm::storage::DFTState<ValueType> const& original) const;
             
             // The dft used for the generation of next states.
             storm::storage::DFT<ValueType> const& mDft;
@@ -53,6 +63,10 @@ namespace storm {
             // Current state
             DFTStatePointer state;
 
+            // Scratch states used to compute successors without allocating a new state for every successor.
+            DFTStatePointer scratchState;
+            DFTStatePointer unsuccessfulScratchState;
+
             // Flag indicating if dont care propagation is enabled.
             bool enableDC;
 
@@ -1,6 +1,15 @@
 #include "DFTModelChecker.h"
 
+#include <sstream>
+#include <type_traits>
+
+#include "storm-config.h"
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/tbb.h"
+#endif
+
 #include "storm/settings/modules/IOSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/builder/ParallelCompositionBuilder.h"
 #include "storm/utility/bitoperations.h"
 #include "storm/utility/DirectEncodingExporter.h"
@@ -86,51 +95,57 @@ namespace storm {
             // Perform modularisation
             if(dfts.size() > 1) {
                 STORM_LOG_TRACE("Recursive CHECK Call");
-                // TODO Matthias: compute simultaneously
-                dft_results results;
+                property_vector probabilityProperties;
                 for (auto property : properties) {
                     if (!property->isProbabilityOperatorFormula()) {
                         STORM_LOG_WARN("Could not check property: " << *property);
                     } else {
-                        // Recursively call model checking
-                        std::vector<ValueType> res;
-                        for(auto const ft : dfts) {
-                            // TODO Matthias: allow approximation in modularisation
-                            dft_results ftResults = checkHelper(ft, {property}, symred, true, enableDC, 0.0);
-                            STORM_LOG_ASSERT(ftResults.size() == 1, "Wrong number of results");
-                            res.push_back(boost::get<ValueType>(ftResults[0]));
-                        }
+                        probabilityProperties.push_back(property);
+                    }
+                }
+                if (probabilityProperties.empty()) {
+                    return dft_results();
+                }
 
-                        // Combine modularisation results
-                        STORM_LOG_TRACE("Combining all results... K=" << nrK << "; M=" << nrM << "; invResults=" << (invResults?"On":"Off"));
-                        ValueType result = storm::utility::zero<ValueType>();
-                        int limK = invResults ? -1 : nrM+1;
-                        int chK = invResults ? -1 : 1;
-                        // WARNING: there is a bug for computing permutations with more than 32 elements
-                        STORM_LOG_ASSERT(res.size() < 32, "Permutations work only for < 32 elements");
-                        for(int cK = nrK; cK != limK; cK += chK ) {
-                            STORM_LOG_ASSERT(cK >= 0, "ck negative.");
-                            size_t permutation = smallestIntWithNBitsSet(static_cast<size_t>(cK));
-                            do {
-                                STORM_LOG_TRACE("Permutation="<<permutation);
-                                ValueType permResult = storm::utility::one<ValueType>();
-                                for(size_t i = 0; i < res.size(); ++i) {
-                                    if(permutation & (1 << i)) {
-                                        permResult *= res[i];
-                                    } else {
-                                        permResult *= storm::utility::one<ValueType>() - res[i];
-                                    }
+                // Each module is built once and checked for all properties
+                std::vector<std::vector<ValueType>> moduleResults = checkModules(dfts, probabilityProperties, symred, enableDC);
+
+                dft_results results;
+                for (size_t propertyIndex = 0; propertyIndex < probabilityProperties.size(); ++propertyIndex) {
+                    std::vector<ValueType> res;
+                    for (auto const& ftResults : moduleResults) {
+                        res.push_back(ftResults[propertyIndex]);
+                    }
+
+                    // Combine modularisation results
+                    STORM_LOG_TRACE("Combining all results... K=" << nrK << "; M=" << nrM << "; invResults=" << (invResults?"On":"Off"));
+                    ValueType result = storm::utility::zero<ValueType>();
+                    int limK = invResults ? -1 : nrM+1;
+                    int chK = invResults ? -1 : 1;
+                    // WARNING: there is a bug for computing permutations with more than 32 elements
+                    STORM_LOG_ASSERT(res.size() < 32, "Permutations work only for < 32 elements");
+                    for(int cK = nrK; cK != limK; cK += chK ) {
+                        STORM_LOG_ASSERT(cK >= 0, "ck negative.");
+                        size_t permutation = smallestIntWithNBitsSet(static_cast<size_t>(cK));
+                        do {
+                            STORM_LOG_TRACE("Permutation="<<permutation);
+                            ValueType permResult = storm::utility::one<ValueType>();
+                            for(size_t i = 0; i < res.size(); ++i) {
+                                if(permutation & (1 << i)) {
+                                    permResult *= res[i];
+                                } else {
+                                    permResult *= storm::utility::one<ValueType>() - res[i];
                                 }
-                                STORM_LOG_TRACE("Result for permutation:"<<permResult);
-                                permutation = nextBitPermutation(permutation);
-                                result += permResult;
-                            } while(permutation < (1 << nrM) && permutation != 0);
-                        }
-                        if(invResults) {
-                            result = storm::utility::one<ValueType>() - result;
-                        }
-                        results.push_back(result);
+                            }
+                            STORM_LOG_TRACE("Result for permutation:"<<permResult);
+                            permutation = nextBitPermutation(permutation);
+                            result += permResult;
+                        } while(permutation < (1 << nrM) && permutation != 0);
+                    }
+                    if(invResults) {
+                        result = storm::utility::one<ValueType>() - result;
                     }
+                    results.push_back(result);
                 }
                 return results;
             } else {
@@ -139,6 +154,63 @@ namespace storm {
             }
         }
 
+        template<typename ValueType>
+        std::vector<std::vector<ValueType>> DFTModelChecker<ValueType>::checkModules(std::vector<storm::storage::DFT<ValueType>> const& dfts, property_vector const& properties, bool symred, bool enableDC) {
+            std::vector<std::vector<ValueType>> moduleResults(dfts.size());
+
+#ifdef STORM_HAVE_INTELTBB
+            // Parallel checking is restricted to doubles as rational functions are not thread-safe
+            if (allowParallelModules && std::is_same<ValueType, double>::value && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                auto const& faultTreeSettings = storm::settings::getModule<storm::settings::modules::FaultTreeSettings>();
+                uint_fast64_t numberOfThreads = faultTreeSettings.isNumberOfModuleThreadsSet() ? faultTreeSettings.getNumberOfModuleThreads() : tbb::task_scheduler_init::default_num_threads();
+                STORM_LOG_INFO("Checking " << dfts.size() << " modules with " << numberOfThreads << " threads.");
+                // Every module gets its own model checker such that the timers are not shared between threads
+                std::vector<DFTModelChecker<ValueType>> moduleCheckers(dfts.size());
+                // The output of the modules is collected and printed in order once all modules are checked
+                std::vector<std::stringstream> moduleOutputs(dfts.size());
+                tbb::task_arena arena(static_cast<int>(numberOfThreads));
+                arena.execute([&] {
+                    tbb::parallel_for(tbb::blocked_range<size_t>(0, dfts.size(), 1), [&](tbb::blocked_range<size_t> const& range) {
+                        for (size_t i = range.begin(); i < range.end(); ++i) {
+                            DFTModelChecker<ValueType>& moduleChecker = moduleCheckers[i];
+                            moduleChecker.allowParallelModules = false;
+                            moduleChecker.outputStream = &moduleOutputs[i];
+                            // TODO Matthias: allow approximation in modularisation
+                            dft_results ftResults = moduleChecker.checkHelper(dfts[i], properties, symred, true, enableDC, 0.0);
+                            STORM_LOG_ASSERT(ftResults.size() == properties.size(), "Wrong number of results");
+                            for (auto const& ftResult : ftResults) {
+                                moduleResults[i].push_back(boost::get<ValueType>(ftResult));
+                            }
+                        }
+                    });
+                });
+                for (size_t i = 0; i < dfts.size(); ++i) {
+                    *outputStream << moduleOutputs[i].str();
+                    addTimings(moduleCheckers[i]);
+                }
+                return moduleResults;
+            }
+#endif
+
+            for (size_t i = 0; i < dfts.size(); ++i) {
+                // TODO Matthias: allow approximation in modularisation
+                dft_results ftResults = checkHelper(dfts[i], properties, symred, true, enableDC, 0.0);
+                STORM_LOG_ASSERT(ftResults.size() == properties.size(), "Wrong number of results");
+                for (auto const& ftResult : ftResults) {
+                    moduleResults[i].push_back(boost::get<ValueType>(ftResult));
+                }
+            }
+            return moduleResults;
+        }
+
+        template<typename ValueType>
+        void DFTModelChecker<ValueType>::addTimings(DFTModelChecker<ValueType> const& other) {
+            buildingTimer.addToTime(std::chrono::nanoseconds(other.buildingTimer.getTimeInNanoseconds()));
+            explorationTimer.addToTime(std::chrono::nanoseconds(other.explorationTimer.getTimeInNanoseconds()));
+            bisimulationTimer.addToTime(std::chrono::nanoseconds(other.bisimulationTimer.getTimeInNanoseconds()));
+            modelCheckingTimer.addToTime(std::chrono::nanoseconds(other.modelCheckingTimer.getTimeInNanoseconds()));
+        }
+
         template<typename ValueType>
         std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> DFTModelChecker<ValueType>::buildModelViaComposition(storm::storage::DFT<ValueType> const& dft, property_vector const& properties, bool symred, bool allowModularisation, bool enableDC, double approximationError)  {
             // TODO Matthias: use approximation?
@@ -226,7 +298,7 @@ namespace storm {
                     }
 
                 }
-                composedModel->printModelInformationToStream(std::cout);
+                composedModel->printModelInformationToStream(*outputStream);
                 return composedModel;
             } else {
                 // No composition was possible
@@ -247,7 +319,7 @@ namespace storm {
                 typename storm::builder::ExplicitDFTModelBuilder<ValueType>::LabelOptions labeloptions(properties);
                 builder.buildModel(labeloptions, 0, 0.0);
                 std::shared_ptr<storm::models::sparse::Model<ValueType>> model = builder.getModel();
-                model->printModelInformationToStream(std::cout);
+                model->printModelInformationToStream(*outputStream);
                 explorationTimer.stop();
                 STORM_LOG_THROW(model->isOfType(storm::models::ModelType::Ctmc), storm::exceptions::NotSupportedException, "Parallel composition only applicable for CTMCs");
                 return model->template as<storm::models::sparse::Ctmc<ValueType>>();
@@ -273,8 +345,6 @@ namespace storm {
                 storm::utility::ConstantsComparator<ValueType> comparator;
                 // Build approximate Markov Automata for lower and upper bound
                 approximation_result approxResult = std::make_pair(storm::utility::zero<ValueType>(), storm::utility::zero<ValueType>());
-                std::shared_ptr<storm::models::sparse::Model<ValueType>> model;
-                std::vector<ValueType> newResult;
                 storm::builder::ExplicitDFTModelBuilder<ValueType> builder(dft, symmetries, enableDC);
                 typename storm::builder::ExplicitDFTModelBuilder<ValueType>::LabelOptions labeloptions(properties);
 
@@ -302,27 +372,20 @@ namespace storm {
 
                     // Build model for lower bound
                     STORM_LOG_INFO("Getting model for lower bound...");
-                    model = builder.getModelApproximation(true, !probabilityFormula);
+                    std::shared_ptr<storm::models::sparse::Model<ValueType>> lowerModel = builder.getModelApproximation(true, !probabilityFormula);
                     // We only output the info from the lower bound as the info for the upper bound is the same
-                    model->printModelInformationToStream(std::cout);
-                    buildingTimer.stop();
-
-                    // Check lower bounds
-                    newResult = checkModel(model, {property});
-                    STORM_LOG_ASSERT(newResult.size() == 1, "Wrong size for result vector.");
-                    STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(newResult[0], approxResult.first), "New under-approximation " << newResult[0] << " is smaller than old result " << approxResult.first);
-                    approxResult.first = newResult[0];
+                    lowerModel->printModelInformationToStream(*outputStream);
 
                     // Build model for upper bound
                     STORM_LOG_INFO("Getting model for upper bound...");
-                    buildingTimer.start();
-                    model = builder.getModelApproximation(false, !probabilityFormula);
+                    std::shared_ptr<storm::models::sparse::Model<ValueType>> upperModel = builder.getModelApproximation(false, !probabilityFormula);
                     buildingTimer.stop();
-                    // Check upper bound
-                    newResult = checkModel(model, {property});
-                    STORM_LOG_ASSERT(newResult.size() == 1, "Wrong size for result vector.");
-                    STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(approxResult.second, newResult[0]), "New over-approximation " << newResult[0] << " is greater than old result " << approxResult.second);
-                    approxResult.second = newResult[0];
+
+                    // Check lower and upper bound
+                    approximation_result newResult = checkApproximation(lowerModel, upperModel, property);
+                    STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(newResult.first, approxResult.first), "New under-approximation " << newResult.first << " is smaller than old result " << approxResult.first);
+                    STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(approxResult.second, newResult.second), "New over-approximation " << newResult.second << " is greater than old result " << approxResult.second);
+                    approxResult = newResult;
 
                     ++iteration;
                     STORM_LOG_ASSERT(comparator.isLess(approxResult.first, approxResult.second) || comparator.isEqual(approxResult.first, approxResult.second), "Under-approximation " << approxResult.first << " is greater than over-approximation " << approxResult.second);
@@ -344,7 +407,7 @@ namespace storm {
                 typename storm::builder::ExplicitDFTModelBuilder<ValueType>::LabelOptions labeloptions(properties, storm::settings::getModule<storm::settings::modules::IOSettings>().isExportExplicitSet());
                 builder.buildModel(labeloptions, 0, 0.0);
                 std::shared_ptr<storm::models::sparse::Model<ValueType>> model = builder.getModel();
-                model->printModelInformationToStream(std::cout);
+                model->printModelInformationToStream(*outputStream);
                 explorationTimer.stop();
 
                 // Export the model if required
@@ -390,21 +453,56 @@ namespace storm {
             for (auto property : properties) {
                 singleModelCheckingTimer.reset();
                 singleModelCheckingTimer.start();
-                STORM_PRINT_AND_LOG("Model checking property " << *property << " ..." << std::endl);
+                STORM_LOG_INFO("Model checking property " << *property << " ...");
+                *outputStream << "Model checking property " << *property << " ..." << std::endl;
                 std::unique_ptr<storm::modelchecker::CheckResult> result(storm::api::verifyWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(property, true)));
                 STORM_LOG_ASSERT(result, "Result does not exist.");
                 result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
                 ValueType resultValue = result->asExplicitQuantitativeCheckResult<ValueType>().getValueMap().begin()->second;
-                STORM_PRINT_AND_LOG("Result (initial states): " << resultValue << std::endl);
+                STORM_LOG_INFO("Result (initial states): " << resultValue);
+                *outputStream << "Result (initial states): " << resultValue << std::endl;
                 results.push_back(resultValue);
                 singleModelCheckingTimer.stop();
-                STORM_PRINT_AND_LOG("Time for model checking: " << singleModelCheckingTimer << "." << std::endl);
+                STORM_LOG_INFO("Time for model checking: " << singleModelCheckingTimer << ".");
+                *outputStream << "Time for model checking: " << singleModelCheckingTimer << "." << std::endl;
             }
             modelCheckingTimer.stop();
             STORM_LOG_INFO("Model checking done.");
             return results;
         }
 
+        template<typename ValueType>
+        typename DFTModelChecker<ValueType>::approximation_result DFTModelChecker<ValueType>::checkApproximation(std::shared_ptr<storm::models::sparse::Model<ValueType>>& lowerModel, std::shared_ptr<storm::models::sparse::Model<ValueType>>& upperModel, std::shared_ptr<storm::logic::Formula const> const& property) {
+            std::vector<ValueType> lowerResult;
+            std::vector<ValueType> upperResult;
+#ifdef STORM_HAVE_INTELTBB
+            // Parallel checking is restricted to doubles as rational functions are not thread-safe
+            if (std::is_same<ValueType, double>::value && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                // Use separate model checkers such that the timers and the output are not shared between threads
+                DFTModelChecker<ValueType> lowerChecker;
+                DFTModelChecker<ValueType> upperChecker;
+                std::stringstream lowerOutput;
+                std::stringstream upperOutput;
+                lowerChecker.outputStream = &lowerOutput;
+                upperChecker.outputStream = &upperOutput;
+                tbb::parallel_invoke([&] { lowerResult = lowerChecker.checkModel(lowerModel, {property}); },
+                                     [&] { upperResult = upperChecker.checkModel(upperModel, {property}); });
+                *outputStream << lowerOutput.str() << upperOutput.str();
+                addTimings(lowerChecker);
+                addTimings(upperChecker);
+            } else {
+                lowerResult = checkModel(lowerModel, {property});
+                upperResult = checkModel(upperModel, {property});
+            }
+#else
+            lowerResult = checkModel(lowerModel, {property});
+            upperResult = checkModel(upperModel, {property});
+#endif
+            STORM_LOG_ASSERT(lowerResult.size() == 1, "Wrong size for result vector.");
+            STORM_LOG_ASSERT(upperResult.size() == 1, "Wrong size for result vector.");
+            return std::make_pair(lowerResult[0], upperResult[0]);
+        }
+
         template<typename ValueType>
         bool DFTModelChecker<ValueType>::isApproximationSufficient(ValueType , ValueType , double , bool ) {
             STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Approximation works only for double.");
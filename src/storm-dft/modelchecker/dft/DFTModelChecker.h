@@ -17,16 +17,16 @@ namespace storm {
         template<typename ValueType>
         class DFTModelChecker {
 
+        public:
+
             typedef std::pair<ValueType, ValueType> approximation_result;
             typedef std::vector<boost::variant<ValueType, approximation_result>> dft_results;
             typedef std::vector<std::shared_ptr<storm::logic::Formula const>> property_vector;
 
-        public:
-
             /*!
              * Constructor.
              */
-            DFTModelChecker() {
+            DFTModelChecker() : allowParallelModules(true), outputStream(&std::cout) {
             }
 
             /*!
@@ -55,6 +55,15 @@ namespace storm {
              */
             void printResults(std::ostream& os = std::cout);
 
+            /*!
+             * Get the results of the last check.
+             *
+             * @return For each property, either the result or the bounds of the approximation
+             */
+            dft_results const& getResults() const {
+                return checkResults;
+            }
+
         private:
 
             // Timing values
@@ -70,6 +79,14 @@ namespace storm {
             // Allowed error bound for approximation
             double approximationError;
 
+            // Flag indicating whether independent modules may be checked in parallel.
+            // This is only done on the top level, i.e. submodules of modules are checked sequentially.
+            bool allowParallelModules;
+
+            // Stream to which information about the models and results is printed.
+            // Model checkers running on other threads write to a buffer that is printed afterwards.
+            std::ostream* outputStream;
+
             /*!
              * Internal helper for model checking a DFT.
              *
@@ -84,6 +101,25 @@ namespace storm {
              */
             dft_results checkHelper(storm::storage::DFT<ValueType> const& dft, property_vector const& properties, bool symred, bool allowModularisation, bool enableDC, double approximationError);
 
+            /*!
+             * Checks the given modules for the given properties. If enabled, the modules are checked in parallel.
+             *
+             * @param dfts       Independent modules
+             * @param properties Properties to check for
+             * @param symred     Flag indicating if symmetry reduction should be used
+             * @param enableDC   Flag indicating if dont care propagation should be used
+             *
+             * @return For each module, the results for all properties
+             */
+            std::vector<std::vector<ValueType>> checkModules(std::vector<storm::storage::DFT<ValueType>> const& dfts, property_vector const& properties, bool symred, bool enableDC);
+
+            /*!
+             * Adds the times measured by the given model checker to the timers of this model checker.
+             *
+             * @param other Model checker whose times are added
+             */
+            void addTimings(DFTModelChecker<ValueType> const& other);
+
             /*!
              * Internal helper for building a CTMC from a DFT via parallel composition.
              *
@@ -121,6 +157,20 @@ namespace storm {
              */
             std::vector<ValueType> checkModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>& model, property_vector const& properties);
 
+            /*!
+             * Check the models for the lower and upper bound of an approximation.
+             * If TBB is enabled, both models are checked in parallel. Note that only these checks run in parallel: the
+             * refinement of the approximation explores the frontier sequentially, as the state generator and state
+             * storage of the model builder are shared by all frontier states.
+             *
+             * @param lowerModel Model for the lower bound
+             * @param upperModel Model for the upper bound
+             * @param property   Property to check for
+             *
+             * @return Pair of lower and upper bound
+             */
+            approximation_result checkApproximation(std::shared_ptr<storm::models::sparse::Model<ValueType>>& lowerModel, std::shared_ptr<storm::models::sparse::Model<ValueType>>& upperModel, std::shared_ptr<storm::logic::Formula const> const& property);
+
             /*!
              * Checks if the computed approximation is sufficient, i.e.
              * upperBound - lowerBound <= approximationError * mean(lowerBound, upperBound).
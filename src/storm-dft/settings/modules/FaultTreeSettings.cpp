@@ -21,6 +21,7 @@ namespace storm {
             const std::string FaultTreeSettings::approximationErrorOptionShortName = "approx";
             const std::string FaultTreeSettings::approximationHeuristicOptionName = "approximationheuristic";
             const std::string FaultTreeSettings::firstDependencyOptionName = "firstdep";
+            const std::string FaultTreeSettings::moduleThreadsOptionName = "modulethreads";
 #ifdef STORM_HAVE_Z3
             const std::string FaultTreeSettings::solveWithSmtOptionName = "smt";
 #endif
@@ -30,6 +31,7 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, modularisationOptionName, false, "Use modularisation (not applicable for expected time).").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, disableDCOptionName, false, "Disable Dont Care propagation.").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, firstDependencyOptionName, false, "Avoid non-determinism by always taking the first possible dependency.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, moduleThreadsOptionName, true, "Sets the number of threads used to check independent modules in parallel if Intel TBB is enabled.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threads", "The number of threads.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, approximationErrorOptionName, false, "Approximation error allowed.").setShortName(approximationErrorOptionShortName).addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("error", "The relative approximation error to use.").addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterEqualValidator(0.0)).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, approximationHeuristicOptionName, false, "Set the heuristic used for approximation.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("heuristic", "Sets which heuristic is used for approximation. Must be in {depth, probability}. Default is").setDefaultValueString("depth").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator({"depth", "rateratio"})).build()).build());
 #ifdef STORM_HAVE_Z3
@@ -75,6 +77,14 @@ namespace storm {
                 return this->getOption(firstDependencyOptionName).getHasOptionBeenSet();
             }
 
+            bool FaultTreeSettings::isNumberOfModuleThreadsSet() const {
+                return this->getOption(moduleThreadsOptionName).getHasOptionBeenSet();
+            }
+
+            uint_fast64_t FaultTreeSettings::getNumberOfModuleThreads() const {
+                return this->getOption(moduleThreadsOptionName).getArgumentByName("threads").getValueAsUnsignedInteger();
+            }
+
 #ifdef STORM_HAVE_Z3
             bool FaultTreeSettings::solveWithSMT() const {
                 return this->getOption(solveWithSmtOptionName).getHasOptionBeenSet();
@@ -67,6 +67,21 @@ namespace storm {
                  * @return True iff the option was set.
                  */
                 bool isTakeFirstDependency() const;
+
+                /*!
+                 * Retrieves whether the number of threads used to check independent modules was set.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isNumberOfModuleThreadsSet() const;
+
+                /*!
+                 * Retrieves the number of threads used to check independent modules in parallel (if Intel TBB is enabled).
+                 * This is only a thread count and does not limit the memory used by the models of the modules.
+                 *
+                 * @return The number of threads.
+                 */
+                uint_fast64_t getNumberOfModuleThreads() const;
                 
 #ifdef STORM_HAVE_Z3
                 /*!
@@ -93,6 +108,7 @@ namespace storm {
                 static const std::string approximationErrorOptionShortName;
                 static const std::string approximationHeuristicOptionName;
                 static const std::string firstDependencyOptionName;
+                static const std::string moduleThreadsOptionName;
 #ifdef STORM_HAVE_Z3
                 static const std::string solveWithSmtOptionName;
 #endif
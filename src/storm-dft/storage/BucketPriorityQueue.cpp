@@ -9,7 +9,7 @@ namespace storm {
 
         template<typename ValueType>
         BucketPriorityQueue<ValueType>::BucketPriorityQueue(size_t nrBuckets, double lowerValue, double ratio) : lowerValue(lowerValue), logBase(std::log(ratio)), nrBuckets(nrBuckets), nrUnsortedItems(0), buckets(nrBuckets), currentBucket(nrBuckets) {
-            compare = ([this](HeuristicPointer a, HeuristicPointer b) {
+            compare = ([](HeuristicPointer const& a, HeuristicPointer const& b) {
                 return *a < *b;
             });
         }
@@ -31,7 +31,7 @@ namespace storm {
         template<typename ValueType>
         std::size_t BucketPriorityQueue<ValueType>::size() const {
             size_t size = immediateBucket.size();
-            for (size_t i = currentBucket; currentBucket < nrBuckets; ++i) {
+            for (size_t i = currentBucket; i < nrBuckets; ++i) {
                 size += buckets[i].size();
             }
             return size;
@@ -63,7 +63,7 @@ namespace storm {
             // Index of first bucket which contains items
             size_t currentBucket;
 
-            std::function<bool(HeuristicPointer, HeuristicPointer)> compare;
+            std::function<bool(HeuristicPointer const&, HeuristicPointer const&)> compare;
 
         };
 
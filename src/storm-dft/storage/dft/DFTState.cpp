@@ -71,6 +71,18 @@ namespace storm {
             return std::make_shared<storm::storage::DFTState<ValueType>>(*this);
         }
 
+        template<typename ValueType>
+        void DFTState<ValueType>::copyFrom(DFTState<ValueType> const& other) {
+            STORM_LOG_ASSERT(&mDft == &other.mDft, "States belong to different DFTs.");
+            mStatus = other.mStatus;
+            mId = other.mId;
+            mCurrentlyFailableBE = other.mCurrentlyFailableBE;
+            mFailableDependencies = other.mFailableDependencies;
+            mUsedRepresentants = other.mUsedRepresentants;
+            mPseudoState = other.mPseudoState;
+            mValid = other.mValid;
+        }
+
         template<typename ValueType>
         DFTElementState DFTState<ValueType>::getElementState(size_t id) const {
             return static_cast<DFTElementState>(getElementStateInt(id));
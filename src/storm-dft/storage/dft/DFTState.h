@@ -61,6 +61,14 @@ namespace storm {
 
             std::shared_ptr<DFTState<ValueType>> copy() const;
 
+            /**
+             * Overwrite this state with the given state of the same DFT.
+             * In contrast to copy(), the already allocated memory of this state is reused.
+             *
+             * @param other State to copy from.
+             */
+            void copyFrom(DFTState<ValueType> const& other);
+
             DFTElementState getElementState(size_t id) const;
             
             DFTDependencyState getDependencyState(size_t id) const;
@@ -1,9 +1,21 @@
 #include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
 
+#include <algorithm>
+#include <type_traits>
+#include <unordered_map>
+
+#include "storm-pars/utility/CompiledFunctions.h"
 #include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/NativeLinearEquationSolver.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -12,7 +24,7 @@ namespace storm {
     namespace modelchecker {
         
         template <typename SparseModelType, typename ConstantType>
-        SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::SparseDtmcInstantiationModelChecker(SparseModelType const& parametricModel) : SparseInstantiationModelChecker<SparseModelType, ConstantType>(parametricModel), modelInstantiator(parametricModel) {
+        SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::SparseDtmcInstantiationModelChecker(SparseModelType const& parametricModel) : SparseInstantiationModelChecker<SparseModelType, ConstantType>(parametricModel), modelInstantiator(parametricModel, true) {
             //Intentionally left empty
         }
 
@@ -35,6 +47,230 @@ namespace storm {
             }
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+            
+            // Solving several systems at once is done iteratively, so exact computations check the valuations one after another.
+            if (std::is_same<ConstantType, double>::value && valuations.size() > 1) {
+                storm::logic::Formula const& formula = this->currentCheckTask->getFormula();
+                if (formula.isInFragment(storm::logic::reachability())) {
+                    return checkReachabilityFormulaBatch(valuations);
+                } else if (formula.isInFragment(storm::logic::propositional().setRewardOperatorsAllowed(true).setReachabilityRewardFormulasAllowed(true).setOperatorAtTopLevelRequired(true).setNestedOperatorsAllowed(false)) && formula.asRewardOperatorFormula().getMeasureType() == storm::logic::RewardMeasureType::Expectation) {
+                    return checkReachabilityFormulaBatch(valuations);
+                }
+            }
+            return SparseInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(valuations);
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityFormulaBatch(std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            typedef typename SparseModelType::ValueType ParametricType;
+            
+            // Only the block-iterative solvers can handle system-specific matrix values. If no solver was selected explicitly,
+            // we switch to the native solver.
+            std::unique_ptr<storm::solver::LinearEquationSolver<ConstantType>> solver = storm::solver::GeneralLinearEquationSolverFactory<ConstantType>().create();
+            if (!solver->supportsSystemSpecificMatrixValues() && storm::settings::getModule<storm::settings::modules::CoreSettings>().isEquationSolverSetFromDefaultValue()) {
+                solver = storm::solver::NativeLinearEquationSolverFactory<ConstantType>().create();
+            }
+            if (!solver->supportsSystemSpecificMatrixValues()) {
+                STORM_LOG_INFO("The selected equation solver can not solve several instantiations at once. Checking the valuations individually.");
+                return SparseInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(valuations);
+            }
+            bool equationSystemFormat = solver->getEquationProblemFormat() == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+            
+            storm::logic::OperatorFormula const& operatorFormula = this->currentCheckTask->getFormula().asOperatorFormula();
+            bool computeRewards = operatorFormula.isRewardOperatorFormula();
+            storm::storage::SparseMatrix<ParametricType> const& transitionMatrix = this->parametricModel.getTransitionMatrix();
+            uint64_t numberOfStates = transitionMatrix.getRowCount();
+            
+            // Compute the states whose value is the same for all valuations that preserve the graph of the model.
+            storm::modelchecker::SparsePropositionalModelChecker<SparseModelType> propositionalModelChecker(this->parametricModel);
+            storm::storage::BitVector phiStates(numberOfStates, true);
+            storm::storage::BitVector psiStates;
+            if (operatorFormula.getSubformula().isUntilFormula()) {
+                storm::logic::UntilFormula const& untilFormula = operatorFormula.getSubformula().asUntilFormula();
+                phiStates = propositionalModelChecker.check(untilFormula.getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                psiStates = propositionalModelChecker.check(untilFormula.getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            } else {
+                psiStates = propositionalModelChecker.check(operatorFormula.getSubformula().asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            }
+            storm::storage::SparseMatrix<ParametricType> backwardTransitions = this->parametricModel.getBackwardTransitions();
+            storm::storage::BitVector maybeStates;
+            storm::storage::BitVector statesWithProbability1;
+            storm::storage::BitVector infinityStates;
+            if (computeRewards) {
+                infinityStates = ~storm::utility::graph::performProb1(backwardTransitions, phiStates, psiStates);
+                maybeStates = ~(psiStates | infinityStates);
+            } else {
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+                statesWithProbability1 = std::move(statesWithProbability01.second);
+                maybeStates = ~(statesWithProbability01.first | statesWithProbability1);
+            }
+            
+            // Compile the occurring functions. The i-th entry of the functions vectors holds the index of the compiled function.
+            storm::utility::parametric::CompiledFunctions<ParametricType, ConstantType> compiledFunctions;
+            std::unordered_map<ParametricType, uint64_t> functionToIndexMap;
+            auto getFunctionIndex = [&compiledFunctions, &functionToIndexMap] (ParametricType const& function) {
+                auto functionIt = functionToIndexMap.find(function);
+                if (functionIt == functionToIndexMap.end()) {
+                    functionIt = functionToIndexMap.emplace(function, compiledFunctions.addFunction(function)).first;
+                }
+                return functionIt->second;
+            };
+            
+            // A valuation for which a transition function becomes zero changes the graph of the model, which invalidates the
+            // qualitative analysis above.
+            std::vector<uint64_t> transitionFunctions;
+            if (!this->getInstantiationsAreGraphPreserving()) {
+                for (auto const& entry : transitionMatrix) {
+                    if (!storm::utility::isConstant(entry.getValue())) {
+                        transitionFunctions.push_back(getFunctionIndex(entry.getValue()));
+                    }
+                }
+                std::sort(transitionFunctions.begin(), transitionFunctions.end());
+                transitionFunctions.erase(std::unique(transitionFunctions.begin(), transitionFunctions.end()), transitionFunctions.end());
+            }
+            
+            // The solver gets the structure of the system over the maybe states; the values are given separately for each valuation.
+            storm::storage::SparseMatrix<ParametricType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, equationSystemFormat);
+            std::vector<uint64_t> entryFunctions;
+            storm::storage::BitVector diagonalEntries(submatrix.getEntryCount(), false);
+            storm::storage::SparseMatrixBuilder<ConstantType> matrixBuilder(submatrix.getRowCount(), submatrix.getColumnCount(), submatrix.getEntryCount());
+            entryFunctions.reserve(submatrix.getEntryCount());
+            for (uint64_t row = 0; row < submatrix.getRowCount(); ++row) {
+                for (auto const& entry : submatrix.getRow(row)) {
+                    diagonalEntries.set(entryFunctions.size(), entry.getColumn() == row);
+                    entryFunctions.push_back(getFunctionIndex(entry.getValue()));
+                    matrixBuilder.addNextValue(row, entry.getColumn(), storm::utility::one<ConstantType>());
+                }
+            }
+            solver->setMatrix(matrixBuilder.build());
+            solver->setLowerBound(storm::utility::zero<ConstantType>());
+            if (!computeRewards) {
+                solver->setUpperBound(storm::utility::one<ConstantType>());
+            }
+            
+            // The right-hand side of a row is the sum of the given functions: the probabilities to directly reach a state with
+            // probability one or the reward of the state, respectively.
+            std::vector<uint64_t> rightHandSideIndications(1, 0);
+            std::vector<uint64_t> rightHandSideFunctions;
+            std::vector<ParametricType> totalRewards;
+            if (computeRewards) {
+                storm::logic::RewardOperatorFormula const& rewardOperatorFormula = operatorFormula.asRewardOperatorFormula();
+                std::string rewardModelName = rewardOperatorFormula.hasRewardModelName() ? rewardOperatorFormula.getRewardModelName() : (this->currentCheckTask->isRewardModelSet() ? this->currentCheckTask->getRewardModel() : "");
+                totalRewards = this->parametricModel.getRewardModel(rewardModelName).getTotalRewardVector(transitionMatrix);
+            }
+            for (auto const& state : maybeStates) {
+                if (computeRewards) {
+                    rightHandSideFunctions.push_back(getFunctionIndex(totalRewards[state]));
+                } else {
+                    for (auto const& entry : transitionMatrix.getRow(state)) {
+                        if (statesWithProbability1.get(entry.getColumn())) {
+                            rightHandSideFunctions.push_back(getFunctionIndex(entry.getValue()));
+                        }
+                    }
+                }
+                rightHandSideIndications.push_back(rightHandSideFunctions.size());
+            }
+            
+            std::vector<std::unique_ptr<CheckResult>> result(valuations.size());
+            std::vector<uint64_t> order = this->getProcessingOrder(valuations);
+            uint64_t const blockSize = 16;
+            uint64_t numberOfMaybeStates = maybeStates.getNumberOfSetBits();
+            std::vector<std::vector<ConstantType>> previousPoints;
+            std::vector<std::vector<ConstantType>> previousSolutions;
+            std::vector<ConstantType> functionValues;
+            for (uint64_t blockStart = 0; blockStart < order.size(); blockStart += blockSize) {
+                uint64_t blockEnd = std::min<uint64_t>(blockStart + blockSize, order.size());
+                
+                // Evaluate all functions for the valuations of this block.
+                std::vector<uint64_t> systemValuations;
+                std::vector<std::vector<ConstantType>> points;
+                std::vector<std::vector<ConstantType>> systemFunctionValues;
+                for (uint64_t orderIndex = blockStart; orderIndex < blockEnd; ++orderIndex) {
+                    uint64_t valuationIndex = order[orderIndex];
+                    std::vector<ConstantType> point = compiledFunctions.getPoint(valuations[valuationIndex]);
+                    compiledFunctions.evaluateAll(point, functionValues);
+                    if (std::any_of(transitionFunctions.begin(), transitionFunctions.end(), [&functionValues] (uint64_t const& function) { return storm::utility::isZero(functionValues[function]); })) {
+                        result[valuationIndex] = this->check(valuations[valuationIndex]);
+                    } else {
+                        systemValuations.push_back(valuationIndex);
+                        points.push_back(std::move(point));
+                        systemFunctionValues.push_back(functionValues);
+                    }
+                }
+                uint64_t numberOfSystems = systemValuations.size();
+                if (numberOfSystems == 0) {
+                    continue;
+                }
+                
+                // Assemble the block of systems. Each system starts from the solution of the closest valuation of the previous block.
+                std::vector<ConstantType> x(numberOfMaybeStates * numberOfSystems, storm::utility::zero<ConstantType>());
+                std::vector<ConstantType> b(numberOfMaybeStates * numberOfSystems, storm::utility::zero<ConstantType>());
+                std::vector<ConstantType> matrixValues(entryFunctions.size() * numberOfSystems);
+                for (uint64_t system = 0; system < numberOfSystems; ++system) {
+                    std::vector<ConstantType> const& values = systemFunctionValues[system];
+                    for (uint64_t entry = 0; entry < entryFunctions.size(); ++entry) {
+                        ConstantType const& value = values[entryFunctions[entry]];
+                        if (equationSystemFormat) {
+                            matrixValues[entry * numberOfSystems + system] = diagonalEntries.get(entry) ? storm::utility::one<ConstantType>() - value : -value;
+                        } else {
+                            matrixValues[entry * numberOfSystems + system] = value;
+                        }
+                    }
+                    for (uint64_t row = 0; row < numberOfMaybeStates; ++row) {
+                        for (uint64_t index = rightHandSideIndications[row]; index < rightHandSideIndications[row + 1]; ++index) {
+                            b[row * numberOfSystems + system] += values[rightHandSideFunctions[index]];
+                        }
+                    }
+                    
+                    if (!previousPoints.empty()) {
+                        auto distance = [&points, &system] (std::vector<ConstantType> const& otherPoint) {
+                            ConstantType squaredDistance = storm::utility::zero<ConstantType>();
+                            for (uint64_t i = 0; i < otherPoint.size(); ++i) {
+                                ConstantType difference = points[system][i] - otherPoint[i];
+                                squaredDistance += difference * difference;
+                            }
+                            return squaredDistance;
+                        };
+                        uint64_t closest = std::min_element(previousPoints.begin(), previousPoints.end(), [&distance] (std::vector<ConstantType> const& lhs, std::vector<ConstantType> const& rhs) { return distance(lhs) < distance(rhs); }) - previousPoints.begin();
+                        for (uint64_t row = 0; row < numberOfMaybeStates; ++row) {
+                            x[row * numberOfSystems + system] = previousSolutions[closest][row];
+                        }
+                    }
+                }
+                
+                if (numberOfMaybeStates > 0) {
+                    solver->solveEquationsMultiple(x, b, numberOfSystems, matrixValues);
+                }
+                
+                // Translate the solutions to results for all states.
+                previousPoints = std::move(points);
+                previousSolutions.assign(numberOfSystems, std::vector<ConstantType>(numberOfMaybeStates));
+                for (uint64_t system = 0; system < numberOfSystems; ++system) {
+                    for (uint64_t row = 0; row < numberOfMaybeStates; ++row) {
+                        previousSolutions[system][row] = x[row * numberOfSystems + system];
+                    }
+                    std::vector<ConstantType> values(numberOfStates, storm::utility::zero<ConstantType>());
+                    if (computeRewards) {
+                        storm::utility::vector::setVectorValues(values, infinityStates, storm::utility::infinity<ConstantType>());
+                    } else {
+                        storm::utility::vector::setVectorValues(values, statesWithProbability1, storm::utility::one<ConstantType>());
+                    }
+                    storm::utility::vector::setVectorValues(values, maybeStates, previousSolutions[system]);
+                    
+                    std::unique_ptr<CheckResult> quantitativeResult = std::make_unique<ExplicitQuantitativeCheckResult<ConstantType>>(std::move(values));
+                    if (operatorFormula.hasQuantitativeResult()) {
+                        result[systemValuations[system]] = std::move(quantitativeResult);
+                    } else {
+                        result[systemValuations[system]] = quantitativeResult->template asExplicitQuantitativeCheckResult<ConstantType>().compareAgainstBound(operatorFormula.getComparisonType(), operatorFormula.template getThresholdAs<ConstantType>());
+                    }
+                }
+            }
+            return result;
+        }
+        
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityProbabilityFormula(storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker) {
             
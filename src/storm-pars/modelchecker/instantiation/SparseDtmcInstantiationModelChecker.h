@@ -21,6 +21,14 @@ namespace storm {
             SparseDtmcInstantiationModelChecker(SparseModelType const& parametricModel);
             
             virtual std::unique_ptr<CheckResult> check(storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
+            
+            /*!
+             * Checks the formula for each of the given valuations. For unbounded reachability probabilities and rewards, the
+             * equation systems of close valuations are solved together as one block (see
+             * LinearEquationSolver::solveEquationsMultiple), where each system starts from the solution of the closest
+             * valuation of the previous block. Valuations that change the graph of the model are checked individually.
+             */
+            virtual std::vector<std::unique_ptr<CheckResult>> checkBatch(std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) override;
 
         protected:
             
@@ -29,6 +37,9 @@ namespace storm {
             std::unique_ptr<CheckResult> checkReachabilityRewardFormula(storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
             std::unique_ptr<CheckResult> checkBoundedUntilFormula(storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
             
+            // Solves the systems of the given valuations in blocks. Requires an unbounded reachability probability or reward formula.
+            std::vector<std::unique_ptr<CheckResult>> checkReachabilityFormulaBatch(std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
+            
             storm::utility::ModelInstantiator<SparseModelType, storm::models::sparse::Dtmc<ConstantType>> modelInstantiator;
         };
     }
@@ -1,9 +1,15 @@
 #include "storm-pars/modelchecker/instantiation/SparseInstantiationModelChecker.h"
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
 
@@ -22,6 +28,82 @@ namespace storm {
             currentCheckTask = std::make_unique<storm::modelchecker::CheckTask<storm::logic::Formula, ConstantType>>(checkTask.substituteFormula(*currentFormula).template convertValueType<ConstantType>());
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            std::vector<std::unique_ptr<CheckResult>> result(valuations.size());
+            // The result of each check is kept as a hint for the next one, so processing nearby valuations one after another
+            // lets every check start from the solution of a close neighbour.
+            for (auto const& valuationIndex : getProcessingOrder(valuations)) {
+                result[valuationIndex] = check(valuations[valuationIndex]);
+            }
+            return result;
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<uint64_t> SparseInstantiationModelChecker<SparseModelType, ConstantType>::getProcessingOrder(std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) const {
+            std::vector<uint64_t> order(valuations.size());
+            std::iota(order.begin(), order.end(), 0);
+            if (valuations.size() <= 2) {
+                return order;
+            }
+            
+            // Get the coordinates of the valuations as well as their bounding box.
+            auto const& firstValuation = valuations.front();
+            uint64_t dimension = firstValuation.size();
+            std::vector<double> lowerBounds(dimension, std::numeric_limits<double>::infinity());
+            std::vector<double> upperBounds(dimension, -std::numeric_limits<double>::infinity());
+            std::vector<std::vector<double>> coordinates;
+            coordinates.reserve(valuations.size());
+            for (auto const& valuation : valuations) {
+                STORM_LOG_THROW(valuation.size() == dimension, storm::exceptions::InvalidArgumentException, "The given valuations do not instantiate the same parameters.");
+                std::vector<double> point;
+                point.reserve(dimension);
+                auto firstValuationIt = firstValuation.begin();
+                for (auto const& variableValuePair : valuation) {
+                    STORM_LOG_THROW(variableValuePair.first == firstValuationIt->first, storm::exceptions::InvalidArgumentException, "The given valuations do not instantiate the same parameters.");
+                    double value = storm::utility::convertNumber<double>(variableValuePair.second);
+                    lowerBounds[point.size()] = std::min(lowerBounds[point.size()], value);
+                    upperBounds[point.size()] = std::max(upperBounds[point.size()], value);
+                    point.push_back(value);
+                    ++firstValuationIt;
+                }
+                coordinates.push_back(std::move(point));
+            }
+            
+            // Discretize the coordinates to a grid within the bounding box.
+            double const gridSize = static_cast<double>(std::numeric_limits<uint32_t>::max());
+            std::vector<std::vector<uint64_t>> gridPoints;
+            gridPoints.reserve(valuations.size());
+            for (auto const& point : coordinates) {
+                std::vector<uint64_t> gridPoint(dimension, 0);
+                for (uint64_t i = 0; i < dimension; ++i) {
+                    if (upperBounds[i] > lowerBounds[i]) {
+                        gridPoint[i] = static_cast<uint64_t>((point[i] - lowerBounds[i]) / (upperBounds[i] - lowerBounds[i]) * gridSize);
+                    }
+                }
+                gridPoints.push_back(std::move(gridPoint));
+            }
+            
+            // Sort the grid points along the Z-order curve. Instead of interleaving the bits, we compare two points in the
+            // dimension in which they differ at the most significant bit.
+            auto lessMostSignificantBit = [] (uint64_t const& x, uint64_t const& y) { return x < y && x < (x ^ y); };
+            std::sort(order.begin(), order.end(), [&gridPoints, &lessMostSignificantBit, &dimension] (uint64_t const& lhs, uint64_t const& rhs) {
+                auto const& lhsPoint = gridPoints[lhs];
+                auto const& rhsPoint = gridPoints[rhs];
+                uint64_t mostSignificantDimension = 0;
+                uint64_t mostSignificantDifference = 0;
+                for (uint64_t i = 0; i < dimension; ++i) {
+                    uint64_t difference = lhsPoint[i] ^ rhsPoint[i];
+                    if (lessMostSignificantBit(mostSignificantDifference, difference)) {
+                        mostSignificantDimension = i;
+                        mostSignificantDifference = difference;
+                    }
+                }
+                return lhsPoint[mostSignificantDimension] < rhsPoint[mostSignificantDimension];
+            });
+            return order;
+        }
+        
         template <typename SparseModelType, typename ConstantType>
         void SparseInstantiationModelChecker<SparseModelType, ConstantType>::setInstantiationsAreGraphPreserving(bool value) {
             instantiationsAreGraphPreserving = value;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "storm-pars/utility/parametric.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/CheckTask.h"
@@ -22,12 +24,25 @@ namespace storm {
             
             virtual std::unique_ptr<CheckResult> check(storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) = 0;
             
+            /*!
+             * Checks the formula for each of the given valuations. The i-th result belongs to the i-th valuation.
+             * By default, the valuations are checked one after another in an order in which consecutive valuations are
+             * close to each other, so that the result of one check is a good starting point for the next one. Subclasses
+             * may instead solve the systems of several valuations at once.
+             */
+            virtual std::vector<std::unique_ptr<CheckResult>> checkBatch(std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
+            
             // If set, it is assumed that all considered model instantiations have the same underlying graph structure.
             // This bypasses the graph analysis for the different instantiations.
             void setInstantiationsAreGraphPreserving(bool value);
             bool getInstantiationsAreGraphPreserving() const;
             
         protected:
+            /*!
+             * Computes the order in which the given valuations are checked. The valuations are sorted along a Z-order curve
+             * of their (discretized) coordinates, which keeps valuations that are close to each other close in the order.
+             */
+            std::vector<uint64_t> getProcessingOrder(std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) const;
             
             SparseModelType const& parametricModel;
             std::unique_ptr<CheckTask<storm::logic::Formula, ConstantType>> currentCheckTask;
@@ -1,3 +1,4 @@
+#include <limits>
 #include <sstream>
 #include <queue>
 
@@ -50,6 +51,11 @@ namespace storm {
                 return storm::utility::zero<ParametricType>();
             }
         
+            template <typename ParametricType>
+            boost::optional<double> RegionModelChecker<ParametricType>::getDistanceToThresholdOfLastAnalysis() const {
+                return boost::none;
+            }
+        
             template <typename ParametricType>
             std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> RegionModelChecker<ParametricType>::performRegionRefinement(storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis) {
                 STORM_LOG_INFO("Applying refinement on region: " << region.toString(true) << " .");
@@ -63,11 +69,30 @@ namespace storm {
                 // The resulting (sub-)regions
                 std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
                 
-                // FIFO queues storing the data for the regions that we still need to process.
-                std::queue<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> unprocessedRegions;
-                std::queue<uint64_t> refinementDepths;
-                unprocessedRegions.emplace(region, RegionResult::Unknown);
-                refinementDepths.push(0);
+                // A queue storing the regions that we still need to process. Larger regions are processed first. Among regions of
+                // equal area, we prefer the subregions of the regions whose bound came closest to the threshold, as these are
+                // the most likely to be conclusive. Hence, if a coverage threshold is given, it tends to be reached earlier.
+                // Remaining ties are broken by the order in which the regions were created.
+                struct UnprocessedRegion {
+                    storm::storage::ParameterRegion<ParametricType> region;
+                    RegionResult result;
+                    uint64_t depth;
+                    CoefficientType area;
+                    double distanceOfParentToThreshold;
+                    uint64_t index;
+                };
+                auto compareRegions = [] (UnprocessedRegion const& lhs, UnprocessedRegion const& rhs) {
+                    if (lhs.area != rhs.area) {
+                        return lhs.area < rhs.area;
+                    }
+                    if (lhs.distanceOfParentToThreshold != rhs.distanceOfParentToThreshold) {
+                        return lhs.distanceOfParentToThreshold > rhs.distanceOfParentToThreshold;
+                    }
+                    return lhs.index > rhs.index;
+                };
+                std::priority_queue<UnprocessedRegion, std::vector<UnprocessedRegion>, decltype(compareRegions)> unprocessedRegions(compareRegions);
+                uint64_t numOfCreatedRegions = 0;
+                unprocessedRegions.push(UnprocessedRegion {region, RegionResult::Unknown, 0, region.area(), 0.0, numOfCreatedRegions++});
                 
                 uint_fast64_t numOfAnalyzedRegions = 0;
                 CoefficientType displayedProgress = storm::utility::zero<CoefficientType>();
@@ -86,44 +111,44 @@ namespace storm {
                 }
 
                 while (fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
-                    assert(unprocessedRegions.size() == refinementDepths.size());
-                    uint64_t currentDepth = refinementDepths.front();
-                    STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
-                    auto& currentRegion = unprocessedRegions.front().first;
-                    auto& res = unprocessedRegions.front().second;
+                    // Note that the top element of a priority queue can not be moved out, so we copy it.
+                    UnprocessedRegion current = unprocessedRegions.top();
+                    unprocessedRegions.pop();
+                    STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << current.depth << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+                    auto& currentRegion = current.region;
+                    auto& res = current.result;
                     res = analyzeRegion(currentRegion, hypothesis, res, false);
                     switch (res) {
                         case RegionResult::AllSat:
-                            fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
-                            fractionOfAllSatArea += currentRegion.area() / areaOfParameterSpace;
-                            result.push_back(std::move(unprocessedRegions.front()));
+                            fractionOfUndiscoveredArea -= current.area / areaOfParameterSpace;
+                            fractionOfAllSatArea += current.area / areaOfParameterSpace;
+                            result.emplace_back(std::move(currentRegion), res);
                             break;
                         case RegionResult::AllViolated:
-                            fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
-                            fractionOfAllViolatedArea += currentRegion.area() / areaOfParameterSpace;
-                            result.push_back(std::move(unprocessedRegions.front()));
+                            fractionOfUndiscoveredArea -= current.area / areaOfParameterSpace;
+                            fractionOfAllViolatedArea += current.area / areaOfParameterSpace;
+                            result.emplace_back(std::move(currentRegion), res);
                             break;
                         default:
                             // Split the region as long as the desired refinement depth is not reached.
-                            if (!depthThreshold || currentDepth < depthThreshold.get()) {
+                            if (!depthThreshold || current.depth < depthThreshold.get()) {
                                 std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
                                 currentRegion.split(currentRegion.getCenterPoint(), newRegions);
                                 RegionResult initResForNewRegions = (res == RegionResult::CenterSat) ? RegionResult::ExistsSat :
                                                                          ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
                                                                           RegionResult::Unknown);
+                                double distanceToThreshold = getDistanceToThresholdOfLastAnalysis().get_value_or(std::numeric_limits<double>::infinity());
                                 for (auto& newRegion : newRegions) {
-                                    unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions);
-                                    refinementDepths.push(currentDepth + 1);
+                                    CoefficientType newArea = newRegion.area();
+                                    unprocessedRegions.push(UnprocessedRegion {std::move(newRegion), initResForNewRegions, current.depth + 1, std::move(newArea), distanceToThreshold, numOfCreatedRegions++});
                                 }
                             } else {
                                 // If the region is not further refined, it is still added to the result
-                                result.push_back(std::move(unprocessedRegions.front()));
+                                result.emplace_back(std::move(currentRegion), res);
                             }
                             break;
                     }
                     ++numOfAnalyzedRegions;
-                    unprocessedRegions.pop();
-                    refinementDepths.pop();
                     if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
                         while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
                             STORM_PRINT_AND_LOG("#");
@@ -134,7 +159,7 @@ namespace storm {
                 
                 // Add the still unprocessed regions to the result
                 while (!unprocessedRegions.empty()) {
-                    result.push_back(std::move(unprocessedRegions.front()));
+                    result.emplace_back(unprocessedRegions.top().region, unprocessedRegions.top().result);
                     unprocessedRegions.pop();
                 }
                 
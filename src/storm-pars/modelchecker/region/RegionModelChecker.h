@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <boost/optional.hpp>
 
 #include "storm-pars/modelchecker/results/RegionCheckResult.h"
 #include "storm-pars/modelchecker/results/RegionRefinementCheckResult.h"
@@ -44,8 +45,17 @@ namespace storm {
             
             virtual ParametricType getBoundAtInitState(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters);
             
+            /*!
+             * Retrieves the distance between the threshold of the property and the bound at the initial state that was computed
+             * during the last call of analyzeRegion. If that analysis was inconclusive, a small distance indicates that the
+             * subregions of the region are likely to be conclusive. Checkers that do not compute such bounds return none.
+             */
+            virtual boost::optional<double> getDistanceToThresholdOfLastAnalysis() const;
+            
             /*!
              * Iteratively refines the region until the region analysis yields a conclusive result (AllSat or AllViolated).
+             * Larger regions are analyzed first. Among regions of equal area, the subregions of regions whose analysis came
+             * closest to a conclusive result (see getDistanceToThresholdOfLastAnalysis) are analyzed first.
              * @param region the considered region
              * @param coverageThreshold if given, the refinement stops as soon as the fraction of the area of the subregions with inconclusive result is less then this threshold
              * @param depthThreshold if given, the refinement stops at the given depth. depth=0 means no refinement.
@@ -4,6 +4,7 @@
 #include "storm/logic/FragmentSpecification.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
@@ -55,6 +56,7 @@ namespace storm {
             STORM_LOG_THROW(this->parametricModel->getInitialStates().getNumberOfSetBits() == 1, storm::exceptions::NotSupportedException, "Analyzing regions with parameter lifting requires a model with a single initial state.");
             
             RegionResult result = initialResult;
+            distanceToThresholdOfLastAnalysis = boost::none;
 
             // Check if we need to check the formula on one point to decide whether to show AllSat or AllViolated
             if (hypothesis == RegionResultHypothesis::Unknown && result == RegionResult::Unknown) {
@@ -65,7 +67,7 @@ namespace storm {
             if (hypothesis == RegionResultHypothesis::AllSat || result == RegionResult::ExistsSat || result == RegionResult::CenterSat) {
                 // show AllSat:
                 storm::solver::OptimizationDirection parameterOptimizationDirection = isLowerBound(this->currentCheckTask->getBound().comparisonType) ? storm::solver::OptimizationDirection::Minimize : storm::solver::OptimizationDirection::Maximize;
-                if (this->check(region, parameterOptimizationDirection)->asExplicitQualitativeCheckResult()[*this->parametricModel->getInitialStates().begin()]) {
+                if (checkAtInitialState(region, parameterOptimizationDirection)) {
                     result = RegionResult::AllSat;
                 } else if (sampleVerticesOfRegion) {
                     result = sampleVertices(region, result);
@@ -73,7 +75,7 @@ namespace storm {
             } else if (hypothesis == RegionResultHypothesis::AllViolated || result == RegionResult::ExistsViolated || result == RegionResult::CenterViolated) {
                 // show AllViolated:
                 storm::solver::OptimizationDirection parameterOptimizationDirection = isLowerBound(this->currentCheckTask->getBound().comparisonType) ? storm::solver::OptimizationDirection::Maximize : storm::solver::OptimizationDirection::Minimize;
-                if (!this->check(region, parameterOptimizationDirection)->asExplicitQualitativeCheckResult()[*this->parametricModel->getInitialStates().begin()]) {
+                if (!checkAtInitialState(region, parameterOptimizationDirection)) {
                     result = RegionResult::AllViolated;
                 } else if (sampleVerticesOfRegion) {
                     result = sampleVertices(region, result);
@@ -131,6 +133,22 @@ namespace storm {
             }
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        bool SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::checkAtInitialState(storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
+            uint64_t initialState = *this->parametricModel->getInitialStates().begin();
+            auto const& operatorFormula = this->currentCheckTask->getFormula().asOperatorFormula();
+            ConstantType threshold = operatorFormula.template getThresholdAs<ConstantType>();
+            auto quantitativeResult = computeQuantitativeValues(region, dirForParameters);
+            auto const& explicitQuantitativeResult = quantitativeResult->template asExplicitQuantitativeCheckResult<ConstantType>();
+            distanceToThresholdOfLastAnalysis = storm::utility::convertNumber<double>(storm::utility::abs<ConstantType>(explicitQuantitativeResult[initialState] - threshold));
+            return explicitQuantitativeResult.compareAgainstBound(operatorFormula.getComparisonType(), threshold)->asExplicitQualitativeCheckResult()[initialState];
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        boost::optional<double> SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::getDistanceToThresholdOfLastAnalysis() const {
+            return distanceToThresholdOfLastAnalysis;
+        }
+        
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<QuantitativeCheckResult<ConstantType>> SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::getBound(storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
             STORM_LOG_WARN_COND(this->currentCheckTask->getFormula().hasQuantitativeResult(), "Computing quantitative bounds for a qualitative formula...");
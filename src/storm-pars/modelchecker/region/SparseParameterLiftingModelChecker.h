@@ -47,6 +47,7 @@ namespace storm {
             
             std::unique_ptr<QuantitativeCheckResult<ConstantType>> getBound(storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters);
             virtual typename SparseModelType::ValueType getBoundAtInitState(storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters) override;
+            virtual boost::optional<double> getDistanceToThresholdOfLastAnalysis() const override;
 
             
             SparseModelType const& getConsideredParametricModel() const;
@@ -74,9 +75,18 @@ namespace storm {
             std::unique_ptr<CheckTask<storm::logic::Formula, ConstantType>> currentCheckTask;
 
         private:
+            /*!
+             * Checks the specified formula at the initial state on the given region (see check) and stores the distance
+             * between the computed bound and the threshold.
+             */
+            bool checkAtInitialState(storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters);
+            
             // store the current formula. Note that currentCheckTask only stores a reference to the formula.
             std::shared_ptr<storm::logic::Formula const> currentFormula;
             
+            // The distance between the threshold and the bound computed during the last analysis of a region.
+            boost::optional<double> distanceToThresholdOfLastAnalysis;
+            
         };
     }
 }
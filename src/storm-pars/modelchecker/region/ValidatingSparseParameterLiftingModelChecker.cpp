@@ -69,6 +69,11 @@ namespace storm {
             return currentResult;
         }
 
+        template <typename SparseModelType, typename ImpreciseType, typename PreciseType>
+        boost::optional<double> ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::getDistanceToThresholdOfLastAnalysis() const {
+            return getImpreciseChecker().getDistanceToThresholdOfLastAnalysis();
+        }
+
         template class ValidatingSparseParameterLiftingModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double, storm::RationalNumber>;
         template class ValidatingSparseParameterLiftingModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, double, storm::RationalNumber>;
 
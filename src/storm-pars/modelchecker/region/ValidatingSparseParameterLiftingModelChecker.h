@@ -24,6 +24,11 @@ namespace storm {
              * by means of exact and soud methods.
              */
             virtual RegionResult analyzeRegion(storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown, RegionResult const& initialResult = RegionResult::Unknown, bool sampleVerticesOfRegion = false) override;
+            
+            /*!
+             * Retrieves the distance of the bound computed by the imprecise checker during the last analysis.
+             */
+            virtual boost::optional<double> getDistanceToThresholdOfLastAnalysis() const override;
 
         protected:
             
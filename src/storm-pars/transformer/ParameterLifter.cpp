@@ -65,8 +65,8 @@ namespace storm {
                                 builder.addNextValue(newRowIndex, oldToNewColumnIndexMapping[entry.getColumn()], storm::utility::convertNumber<ConstantType>(entry.getValue()));
                             } else {
                                 builder.addNextValue(newRowIndex, oldToNewColumnIndexMapping[entry.getColumn()], storm::utility::one<ConstantType>());
-                                ConstantType& placeholder = functionValuationCollector.add(entry.getValue(), val);
-                                matrixAssignment.push_back(std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType&>(typename storm::storage::SparseMatrix<ConstantType>::iterator(), placeholder));
+                                uint_fast64_t placeholder = functionValuationCollector.add(entry.getValue(), val);
+                                matrixAssignment.push_back(std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, uint_fast64_t>(typename storm::storage::SparseMatrix<ConstantType>::iterator(), placeholder));
                             }
                         }
                     }
@@ -82,8 +82,8 @@ namespace storm {
                                 vectorVal.addParameterUnspecified(vectorVar);
                             }
                         }
-                        ConstantType& placeholder = functionValuationCollector.add(pVectorEntry, vectorVal);
-                        vectorAssignment.push_back(std::pair<typename std::vector<ConstantType>::iterator, ConstantType&>(typename std::vector<ConstantType>::iterator(), placeholder));
+                        uint_fast64_t placeholder = functionValuationCollector.add(pVectorEntry, vectorVal);
+                        vectorAssignment.push_back(std::pair<typename std::vector<ConstantType>::iterator, uint_fast64_t>(typename std::vector<ConstantType>::iterator(), placeholder));
                     }
 
                     ++newRowIndex;
@@ -129,13 +129,13 @@ namespace storm {
             functionValuationCollector.evaluateCollectedFunctions(region, dirForParameters);
             
             //apply the matrix and vector assignments to write the contents of the placeholder into the matrix/vector
-                            
+            std::vector<ConstantType> const& placeholders = functionValuationCollector.getPlaceholders();
             for(auto& assignment : matrixAssignment) {
-                STORM_LOG_WARN_COND(!storm::utility::isZero(assignment.second), "Parameter lifting on region " << region.toString() << " affects the underlying graph structure (the region is not strictly well defined). The result for this region might be incorrect.");
-                assignment.first->setValue(assignment.second);
+                STORM_LOG_WARN_COND(!storm::utility::isZero(placeholders[assignment.second]), "Parameter lifting on region " << region.toString() << " affects the underlying graph structure (the region is not strictly well defined). The result for this region might be incorrect.");
+                assignment.first->setValue(placeholders[assignment.second]);
             }
             for(auto& assignment : vectorAssignment) {
-                *assignment.first = assignment.second;
+                *assignment.first = placeholders[assignment.second];
             }
         }
     
@@ -223,6 +223,21 @@ namespace storm {
             return result;
         }
             
+        template<typename ParametricType, typename ConstantType>
+        std::set<typename ParameterLifter<ParametricType, ConstantType>::VariableType> const& ParameterLifter<ParametricType, ConstantType>::AbstractValuation::getLowerParameters() const {
+            return lowerPars;
+        }
+        
+        template<typename ParametricType, typename ConstantType>
+        std::set<typename ParameterLifter<ParametricType, ConstantType>::VariableType> const& ParameterLifter<ParametricType, ConstantType>::AbstractValuation::getUpperParameters() const {
+            return upperPars;
+        }
+        
+        template<typename ParametricType, typename ConstantType>
+        std::set<typename ParameterLifter<ParametricType, ConstantType>::VariableType> const& ParameterLifter<ParametricType, ConstantType>::AbstractValuation::getUnspecifiedParameters() const {
+            return unspecifiedPars;
+        }
+        
         template<typename ParametricType, typename ConstantType>
         std::vector<storm::utility::parametric::Valuation<ParametricType>> ParameterLifter<ParametricType, ConstantType>::AbstractValuation::getConcreteValuations(storm::storage::ParameterRegion<ParametricType> const& region) const {
             auto result = region.getVerticesOfRegion(unspecifiedPars);
@@ -238,39 +253,89 @@ namespace storm {
         }
         
         template<typename ParametricType, typename ConstantType>
-        ConstantType& ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::add(ParametricType const& function, AbstractValuation const& valuation) {
+        uint_fast64_t ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::add(ParametricType const& function, AbstractValuation const& valuation) {
             ParametricType simplifiedFunction = function;
             storm::utility::simplify(simplifiedFunction);
             std::set<VariableType> variablesInFunction;
             storm::utility::parametric::gatherOccurringVariables(simplifiedFunction, variablesInFunction);
             AbstractValuation simplifiedValuation = valuation.getSubValuation(variablesInFunction);
+            
             // insert the function and the valuation
-            //Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
-            auto insertionRes = collectedFunctions.insert(std::pair<FunctionValuation, ConstantType>(FunctionValuation(std::move(simplifiedFunction), std::move(simplifiedValuation)), storm::utility::one<ConstantType>()));
+            auto insertionRes = collectedFunctions.insert(std::pair<FunctionValuation, uint_fast64_t>(FunctionValuation(simplifiedFunction, simplifiedValuation), compiledFunctionValuations.size()));
+            if (insertionRes.second) {
+                // The pair is new, so we need to compile it. Functions occurring with different valuations are compiled only once.
+                auto functionIndexIt = compiledFunctionIndices.find(simplifiedFunction);
+                if (functionIndexIt == compiledFunctionIndices.end()) {
+                    uint_fast64_t functionIndex = compiledFunctions.addFunction(simplifiedFunction);
+                    functionIndexIt = compiledFunctionIndices.emplace(std::move(simplifiedFunction), functionIndex).first;
+                }
+                CompiledFunctionValuation compiledValuation;
+                compiledValuation.function = functionIndexIt->second;
+                for (auto const& var : simplifiedValuation.getLowerParameters()) {
+                    compiledValuation.lowerVariables.push_back(compiledFunctions.getVariableIndex(var));
+                }
+                for (auto const& var : simplifiedValuation.getUpperParameters()) {
+                    compiledValuation.upperVariables.push_back(compiledFunctions.getVariableIndex(var));
+                }
+                for (auto const& var : simplifiedValuation.getUnspecifiedParameters()) {
+                    compiledValuation.unspecifiedVariables.push_back(compiledFunctions.getVariableIndex(var));
+                }
+                compiledFunctionValuations.push_back(std::move(compiledValuation));
+                placeholders.push_back(storm::utility::one<ConstantType>());
+            }
             return insertionRes.first->second;
         }
     
         template<typename ParametricType, typename ConstantType>
         void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
-            for (auto& collectedFunctionValuationPlaceholder : collectedFunctions) {
-                ParametricType const& function = collectedFunctionValuationPlaceholder.first.first;
-                AbstractValuation const& abstrValuation = collectedFunctionValuationPlaceholder.first.second;
-                ConstantType& placeholder = collectedFunctionValuationPlaceholder.second;
+            // Translate the region into bounds for the variables of the compiled functions.
+            auto const& variables = compiledFunctions.getVariables();
+            std::vector<ConstantType> lowerBounds, upperBounds;
+            lowerBounds.reserve(variables.size());
+            upperBounds.reserve(variables.size());
+            for (auto const& var : variables) {
+                lowerBounds.push_back(storm::utility::convertNumber<ConstantType>(region.getLowerBoundary(var)));
+                upperBounds.push_back(storm::utility::convertNumber<ConstantType>(region.getUpperBoundary(var)));
+            }
+            
+            // Only the entries for the variables of the currently evaluated function are relevant.
+            std::vector<ConstantType> point(variables.size(), storm::utility::zero<ConstantType>());
+            auto placeholderIt = placeholders.begin();
+            for (auto const& compiledValuation : compiledFunctionValuations) {
+                for (auto const& var : compiledValuation.lowerVariables) {
+                    point[var] = lowerBounds[var];
+                }
+                for (auto const& var : compiledValuation.upperVariables) {
+                    point[var] = upperBounds[var];
+                }
                 
-                auto concreteValuations = abstrValuation.getConcreteValuations(region);
-                auto concreteValuationIt = concreteValuations.begin();
-                placeholder = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
-                for(++concreteValuationIt; concreteValuationIt != concreteValuations.end(); ++concreteValuationIt) {
-                    ConstantType currentResult = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
-                    if(storm::solver::minimize(dirForUnspecifiedParameters)) {
-                        placeholder = std::min(placeholder, currentResult);
+                // Iterate over all vertices induced by the unspecified variables, where the i-th bit of the vertex id
+                // indicates whether the i-th unspecified variable is set to its upper bound.
+                uint_fast64_t numOfVertices = 1ull << compiledValuation.unspecifiedVariables.size();
+                for (uint_fast64_t vertexId = 0; vertexId < numOfVertices; ++vertexId) {
+                    uint_fast64_t variableIndex = 0;
+                    for (auto const& var : compiledValuation.unspecifiedVariables) {
+                        point[var] = ((vertexId >> variableIndex) % 2 == 0) ? lowerBounds[var] : upperBounds[var];
+                        ++variableIndex;
+                    }
+                    ConstantType currentResult = compiledFunctions.evaluate(compiledValuation.function, point);
+                    if (vertexId == 0) {
+                        *placeholderIt = std::move(currentResult);
+                    } else if(storm::solver::minimize(dirForUnspecifiedParameters)) {
+                        *placeholderIt = std::min(*placeholderIt, currentResult);
                     } else {
-                        placeholder = std::max(placeholder, currentResult);
+                        *placeholderIt = std::max(*placeholderIt, currentResult);
                     }
                 }
+                ++placeholderIt;
             }
         }
         
+        template<typename ParametricType, typename ConstantType>
+        std::vector<ConstantType> const& ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::getPlaceholders() const {
+            return placeholders;
+        }
+        
         template class ParameterLifter<storm::RationalFunction, double>;
         template class ParameterLifter<storm::RationalFunction, storm::RationalNumber>;
     }
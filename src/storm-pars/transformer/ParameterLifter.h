@@ -7,6 +7,7 @@
 
 
 #include "storm-pars/storage/ParameterRegion.h"
+#include "storm-pars/utility/CompiledFunctions.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
@@ -54,6 +55,7 @@ namespace storm {
             /*
              * We minimize the number of function evaluations by only calling evaluate() once for each unique pair of function and valuation.
              * The result of each evaluation is then written to all positions in the matrix (and the vector) where the corresponding (function,valuation) occurred.
+             * Moreover, the distinct functions are compiled once, such that evaluating them for a region does not involve the polynomial data structures.
              */
             
             /*
@@ -72,6 +74,9 @@ namespace storm {
                 
                 std::size_t getHashValue() const;
                 AbstractValuation getSubValuation(std::set<VariableType> const& pars) const;
+                std::set<VariableType> const& getLowerParameters() const;
+                std::set<VariableType> const& getUpperParameters() const;
+                std::set<VariableType> const& getUnspecifiedParameters() const;
                 
                 /*!
                  * Returns the concrete valuation(s) (w.r.t. the provided region) represented by this abstract valuation.
@@ -93,12 +98,15 @@ namespace storm {
                 
                 /*!
                  * Adds the provided function and valuation.
-                 * Returns a reference to a placeholder in which the evaluation result will be written upon calling evaluateCollectedFunctions)
+                 * Returns the index of the placeholder in which the evaluation result will be written upon calling evaluateCollectedFunctions)
                  */
-                ConstantType& add(ParametricType const& function, AbstractValuation const& valuation);
+                uint_fast64_t add(ParametricType const& function, AbstractValuation const& valuation);
                 
                 void evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
                 
+                // Returns the placeholders. Their content is only meaningful after calling evaluateCollectedFunctions.
+                std::vector<ConstantType> const& getPlaceholders() const;
+                
             private:
                 // Stores a function and a valuation. The valuation is stored as an index of the collectedValuations-vector.
                 typedef std::pair<ParametricType, AbstractValuation> FunctionValuation;
@@ -112,8 +120,25 @@ namespace storm {
                         }
                 };
                 
-                // Stores the collected functions with the valuations together with a placeholder for the result.
-                std::unordered_map<FunctionValuation, ConstantType, FuncValHash> collectedFunctions;
+                // Stores the collected functions with the valuations together with the index of the placeholder for the result.
+                std::unordered_map<FunctionValuation, uint_fast64_t, FuncValHash> collectedFunctions;
+                
+                // The distinct collected functions, compiled into a program. The index of each function within the program is stored in the map.
+                storm::utility::parametric::CompiledFunctions<ParametricType, ConstantType> compiledFunctions;
+                std::unordered_map<ParametricType, uint_fast64_t> compiledFunctionIndices;
+                
+                // The compiled counterpart of a function valuation pair: the index of the compiled function together with the
+                // indices of the variables that are set to the lower bound, the upper bound or that are unspecified.
+                struct CompiledFunctionValuation {
+                    uint_fast64_t function;
+                    std::vector<uint_fast64_t> lowerVariables;
+                    std::vector<uint_fast64_t> upperVariables;
+                    std::vector<uint_fast64_t> unspecifiedVariables;
+                };
+                std::vector<CompiledFunctionValuation> compiledFunctionValuations;
+                
+                // The placeholders for the results. The i-th placeholder belongs to the i-th compiled function valuation.
+                std::vector<ConstantType> placeholders;
             };
             
             FunctionValuationCollector functionValuationCollector;
@@ -123,10 +148,10 @@ namespace storm {
             
             
             storm::storage::SparseMatrix<ConstantType> matrix; //The resulting matrix;
-            std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType&>> matrixAssignment; // Connection of matrix entries with placeholders
+            std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, uint_fast64_t>> matrixAssignment; // Connection of matrix entries with (indices of) placeholders
             
             std::vector<ConstantType> vector; //The resulting vector
-            std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType&>> vectorAssignment; // Connection of vector entries with placeholders
+            std::vector<std::pair<typename std::vector<ConstantType>::iterator, uint_fast64_t>> vectorAssignment; // Connection of vector entries with (indices of) placeholders
                 
         };
 
@@ -0,0 +1,133 @@
+#include "storm-pars/utility/CompiledFunctions.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace utility {
+        namespace parametric {
+
+            template<typename ParametricType, typename ConstantType>
+            CompiledFunctions<ParametricType, ConstantType>::CompiledFunctions() : functionTerms(1, 0), termFactors(1, 0) {
+                // Intentionally left empty.
+            }
+
+            template<typename ParametricType, typename ConstantType>
+            uint64_t CompiledFunctions<ParametricType, ConstantType>::addFunction(ParametricType const& function) {
+                uint64_t functionIndex = getNumberOfFunctions();
+                if (storm::utility::isConstant(function)) {
+                    termCoefficients.push_back(storm::utility::convertNumber<ConstantType>(function));
+                    termFactors.push_back(factors.size());
+                    functionTerms.push_back(termCoefficients.size());
+                    termCoefficients.push_back(storm::utility::one<ConstantType>());
+                    termFactors.push_back(factors.size());
+                    functionTerms.push_back(termCoefficients.size());
+                } else {
+                    addPolynomial(function.nominator());
+                    functionTerms.push_back(termCoefficients.size());
+                    addPolynomial(function.denominator());
+                    functionTerms.push_back(termCoefficients.size());
+                }
+                return functionIndex;
+            }
+
+            template<typename ParametricType, typename ConstantType>
+            template<typename PolynomialType>
+            void CompiledFunctions<ParametricType, ConstantType>::addPolynomial(PolynomialType const& polynomial) {
+                if (polynomial.isConstant()) {
+                    termCoefficients.push_back(storm::utility::convertNumber<ConstantType>(polynomial.constantPart()));
+                    termFactors.push_back(factors.size());
+                    return;
+                }
+
+                // The factorized polynomial stores a common coefficient separately from the actual polynomial.
+                ConstantType commonCoefficient = storm::utility::convertNumber<ConstantType>(polynomial.coefficient());
+                for (auto const& term : polynomial.polynomial()) {
+                    termCoefficients.push_back(commonCoefficient * storm::utility::convertNumber<ConstantType>(term.coeff()));
+                    if (term.monomial()) {
+                        for (auto const& variableExponentPair : *term.monomial()) {
+                            auto variableIndexIt = variableToIndexMap.find(variableExponentPair.first);
+                            if (variableIndexIt == variableToIndexMap.end()) {
+                                variableIndexIt = variableToIndexMap.emplace(variableExponentPair.first, variables.size()).first;
+                                variables.push_back(variableExponentPair.first);
+                            }
+                            factors.emplace_back(variableIndexIt->second, variableExponentPair.second);
+                        }
+                    }
+                    termFactors.push_back(factors.size());
+                }
+            }
+
+            template<typename ParametricType, typename ConstantType>
+            uint64_t CompiledFunctions<ParametricType, ConstantType>::getNumberOfFunctions() const {
+                return (functionTerms.size() - 1) / 2;
+            }
+
+            template<typename ParametricType, typename ConstantType>
+            std::vector<typename CompiledFunctions<ParametricType, ConstantType>::VariableType> const& CompiledFunctions<ParametricType, ConstantType>::getVariables() const {
+                return variables;
+            }
+
+            template<typename ParametricType, typename ConstantType>
+            uint64_t CompiledFunctions<ParametricType, ConstantType>::getVariableIndex(VariableType const& variable) const {
+                auto variableIndexIt = variableToIndexMap.find(variable);
+                STORM_LOG_THROW(variableIndexIt != variableToIndexMap.end(), storm::exceptions::InvalidArgumentException, "The variable " << variable << " does not occur in the compiled functions.");
+                return variableIndexIt->second;
+            }
+
+            template<typename ParametricType, typename ConstantType>
+            std::vector<ConstantType> CompiledFunctions<ParametricType, ConstantType>::getPoint(Valuation<ParametricType> const& valuation) const {
+                std::vector<ConstantType> result;
+                result.reserve(variables.size());
+                for (auto const& variable : variables) {
+                    auto valuationIt = valuation.find(variable);
+                    STORM_LOG_THROW(valuationIt != valuation.end(), storm::exceptions::InvalidArgumentException, "The given valuation does not assign a value to variable " << variable << ".");
+                    result.push_back(storm::utility::convertNumber<ConstantType>(valuationIt->second));
+                }
+                return result;
+            }
+
+            template<typename ParametricType, typename ConstantType>
+            ConstantType CompiledFunctions<ParametricType, ConstantType>::evaluateTerms(uint64_t firstTerm, uint64_t lastTerm, std::vector<ConstantType> const& point) const {
+                ConstantType result = storm::utility::zero<ConstantType>();
+                for (uint64_t term = firstTerm; term < lastTerm; ++term) {
+                    ConstantType termValue = termCoefficients[term];
+                    for (uint64_t factor = termFactors[term]; factor < termFactors[term + 1]; ++factor) {
+                        ConstantType const& variableValue = point[factors[factor].first];
+                        for (uint64_t exponent = 0; exponent < factors[factor].second; ++exponent) {
+                            termValue *= variableValue;
+                        }
+                    }
+                    result += termValue;
+                }
+                return result;
+            }
+
+            template<typename ParametricType, typename ConstantType>
+            ConstantType CompiledFunctions<ParametricType, ConstantType>::evaluate(uint64_t function, std::vector<ConstantType> const& point) const {
+                STORM_LOG_ASSERT(point.size() == variables.size(), "The dimension of the point does not match the number of variables.");
+                uint64_t numeratorStart = functionTerms[2 * function];
+                uint64_t denominatorStart = functionTerms[2 * function + 1];
+                uint64_t denominatorEnd = functionTerms[2 * function + 2];
+                return evaluateTerms(numeratorStart, denominatorStart, point) / evaluateTerms(denominatorStart, denominatorEnd, point);
+            }
+
+            template<typename ParametricType, typename ConstantType>
+            void CompiledFunctions<ParametricType, ConstantType>::evaluateAll(std::vector<ConstantType> const& point, std::vector<ConstantType>& result) const {
+                uint64_t numberOfFunctions = getNumberOfFunctions();
+                result.resize(numberOfFunctions);
+                for (uint64_t function = 0; function < numberOfFunctions; ++function) {
+                    result[function] = evaluate(function, point);
+                }
+            }
+
+            template class CompiledFunctions<storm::RationalFunction, double>;
+            template class CompiledFunctions<storm::RationalFunction, storm::RationalNumber>;
+        }
+    }
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+
+namespace storm {
+    namespace utility {
+        namespace parametric {
+
+            /*!
+             * This class compiles a collection of rational functions into a flat program that can be evaluated without
+             * touching the (comparatively slow) polynomial data structures.
+             * Every function is stored as a numerator and a denominator, each of which is a sum of terms. A term consists
+             * of a coefficient and a list of factors, where each factor is a variable (given by its index) and an exponent.
+             * All of this is kept in a few contiguous vectors, so evaluating all functions at a point boils down to a
+             * tight loop over these vectors.
+             *
+             * Points are given as vectors that contain the value of the i-th variable (see getVariables()) at position i.
+             */
+            template<typename ParametricType, typename ConstantType>
+            class CompiledFunctions {
+            public:
+                typedef typename storm::utility::parametric::VariableType<ParametricType>::type VariableType;
+
+                CompiledFunctions();
+
+                /*!
+                 * Compiles the given function and appends it to the program.
+                 *
+                 * @return The index of the function within this program.
+                 */
+                uint64_t addFunction(ParametricType const& function);
+
+                /*!
+                 * Retrieves the number of compiled functions.
+                 */
+                uint64_t getNumberOfFunctions() const;
+
+                /*!
+                 * Retrieves the variables occurring in the compiled functions. The position of a variable within the
+                 * returned vector is its index.
+                 */
+                std::vector<VariableType> const& getVariables() const;
+
+                /*!
+                 * Retrieves the index of the given variable. The variable has to occur in some compiled function.
+                 */
+                uint64_t getVariableIndex(VariableType const& variable) const;
+
+                /*!
+                 * Translates the given valuation into a point, i.e., a vector whose i-th entry is the value of the i-th variable.
+                 * The valuation has to assign a value to every variable of the program.
+                 */
+                std::vector<ConstantType> getPoint(Valuation<ParametricType> const& valuation) const;
+
+                /*!
+                 * Evaluates the function with the given index at the given point.
+                 */
+                ConstantType evaluate(uint64_t function, std::vector<ConstantType> const& point) const;
+
+                /*!
+                 * Evaluates all functions at the given point. The result of the i-th function is written to result[i].
+                 */
+                void evaluateAll(std::vector<ConstantType> const& point, std::vector<ConstantType>& result) const;
+
+            private:
+                /*!
+                 * Appends the terms of the given polynomial to the program.
+                 */
+                template<typename PolynomialType>
+                void addPolynomial(PolynomialType const& polynomial);
+
+                /*!
+                 * Evaluates the sum of the terms in the range [firstTerm, lastTerm) at the given point.
+                 */
+                ConstantType evaluateTerms(uint64_t firstTerm, uint64_t lastTerm, std::vector<ConstantType> const& point) const;
+
+                // For the i-th function, the terms of the numerator are [functionTerms[2i], functionTerms[2i+1]) and the terms
+                // of the denominator are [functionTerms[2i+1], functionTerms[2i+2]).
+                std::vector<uint64_t> functionTerms;
+
+                // The coefficient of each term.
+                std::vector<ConstantType> termCoefficients;
+
+                // The factors of the i-th term are [termFactors[i], termFactors[i+1]).
+                std::vector<uint64_t> termFactors;
+
+                // The factors, each given as a pair of the index of the variable and its exponent.
+                std::vector<std::pair<uint64_t, uint64_t>> factors;
+
+                // The occurring variables and their indices.
+                std::vector<VariableType> variables;
+                std::map<VariableType, uint64_t> variableToIndexMap;
+            };
+
+        }
+    }
+}
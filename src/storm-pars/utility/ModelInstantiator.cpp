@@ -5,7 +5,7 @@ namespace storm {
     namespace utility {
         
             template<typename ParametricSparseModelType, typename ConstantSparseModelType>
-            ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::ModelInstantiator(ParametricSparseModelType const& parametricModel){
+            ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::ModelInstantiator(ParametricSparseModelType const& parametricModel, bool compileFunctions){
                 //Now pre-compute the information for the equation system.
                 initializeModelSpecificData(parametricModel);
                 initializeMatrixMapping(this->instantiatedModel->getTransitionMatrix(), this->functions, this->matrixMapping, parametricModel.getTransitionMatrix());
@@ -21,6 +21,19 @@ namespace storm {
                         initializeMatrixMapping(rewModel.second.getTransitionRewardMatrix(), this->functions, this->matrixMapping, parametricModel.getRewardModel(rewModel.first).getTransitionRewardMatrix());
                     }
                 }
+                
+                if (compileFunctions) {
+                    // Compile the occurring functions such that the i-th compiled function corresponds to the i-th placeholder.
+                    std::vector<ParametricType const*> functionsByPlaceholder(this->functions.size(), nullptr);
+                    for (auto const& functionPlaceholderPair : this->functions) {
+                        functionsByPlaceholder[functionPlaceholderPair.second] = &functionPlaceholderPair.first;
+                    }
+                    this->compiledFunctions.emplace();
+                    for (auto const& function : functionsByPlaceholder) {
+                        this->compiledFunctions->addFunction(*function);
+                    }
+                }
+                this->placeholders.resize(this->functions.size(), storm::utility::one<ConstantType>());
             }
             
             template<typename ParametricSparseModelType, typename ConstantType>
@@ -86,10 +99,9 @@ namespace storm {
             
             template<typename ParametricSparseModelType, typename ConstantSparseModelType>
             void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::initializeMatrixMapping(storm::storage::SparseMatrix<ConstantType>& constantMatrix,
-                                             std::unordered_map<ParametricType, ConstantType>& functions,
-                                             std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>>& mapping,
+                                             std::unordered_map<ParametricType, uint_fast64_t>& functions,
+                                             std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, uint_fast64_t>>& mapping,
                                              storm::storage::SparseMatrix<ParametricType> const& parametricMatrix) const{
-                ConstantType dummyValue = storm::utility::one<ConstantType>();
                 auto constantEntryIt = constantMatrix.begin();
                 auto parametricEntryIt = parametricMatrix.begin();
                 while(parametricEntryIt != parametricMatrix.end()){
@@ -99,9 +111,8 @@ namespace storm {
                         constantEntryIt->setValue(storm::utility::convertNumber<ConstantType>(parametricEntryIt->getValue()));
                     } else {
                         //insert the new function and store that the current constantMatrix entry needs to be set to the value of this function
-                        auto functionsIt = functions.insert(std::make_pair(parametricEntryIt->getValue(), dummyValue)).first;
-                        mapping.emplace_back(std::make_pair(constantEntryIt, &(functionsIt->second)));
-                        //Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
+                        auto functionsIt = functions.insert(std::make_pair(parametricEntryIt->getValue(), functions.size())).first;
+                        mapping.emplace_back(std::make_pair(constantEntryIt, functionsIt->second));
                     }
                     ++constantEntryIt;
                     ++parametricEntryIt;
@@ -112,10 +123,9 @@ namespace storm {
             
             template<typename ParametricSparseModelType, typename ConstantSparseModelType>
             void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::initializeVectorMapping(std::vector<ConstantType>& constantVector,
-                                             std::unordered_map<ParametricType, ConstantType>& functions,
-                                             std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>>& mapping,
+                                             std::unordered_map<ParametricType, uint_fast64_t>& functions,
+                                             std::vector<std::pair<typename std::vector<ConstantType>::iterator, uint_fast64_t>>& mapping,
                                              std::vector<ParametricType> const& parametricVector) const{
-                ConstantType dummyValue = storm::utility::one<ConstantType>();
                 auto constantEntryIt = constantVector.begin();
                 auto parametricEntryIt = parametricVector.begin();
                 while(parametricEntryIt != parametricVector.end()){
@@ -124,9 +134,8 @@ namespace storm {
                         *constantEntryIt = storm::utility::convertNumber<ConstantType>(*parametricEntryIt);
                     } else {
                         //insert the new function and store that the current constantVector entry needs to be set to the value of this function
-                        auto functionsIt = functions.insert(std::make_pair(*parametricEntryIt, dummyValue)).first;
-                        mapping.emplace_back(std::make_pair(constantEntryIt, &(functionsIt->second)));
-                        //Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
+                        auto functionsIt = functions.insert(std::make_pair(*parametricEntryIt, functions.size())).first;
+                        mapping.emplace_back(std::make_pair(constantEntryIt, functionsIt->second));
                     }
                     ++constantEntryIt;
                     ++parametricEntryIt;
@@ -137,17 +146,21 @@ namespace storm {
             template<typename ParametricSparseModelType, typename ConstantSparseModelType>
             ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation){
                 //Write results into the placeholders
-                for(auto& functionResult : this->functions){
-                    functionResult.second=storm::utility::convertNumber<ConstantType>(
-                            storm::utility::parametric::evaluate(functionResult.first, valuation));
+                if (this->compiledFunctions) {
+                    this->compiledFunctions->evaluateAll(this->compiledFunctions->getPoint(valuation), this->placeholders);
+                } else {
+                    for(auto const& functionPlaceholderPair : this->functions){
+                        this->placeholders[functionPlaceholderPair.second] = storm::utility::convertNumber<ConstantType>(
+                                storm::utility::parametric::evaluate(functionPlaceholderPair.first, valuation));
+                    }
                 }
                 
                 //Write the instantiated values to the matrices and vectors according to the stored mappings
                 for(auto& entryValuePair : this->matrixMapping){
-                    entryValuePair.first->setValue(*(entryValuePair.second));
+                    entryValuePair.first->setValue(this->placeholders[entryValuePair.second]);
                 }
                 for(auto& entryValuePair : this->vectorMapping){
-                    *(entryValuePair.first)=*(entryValuePair.second);
+                    *(entryValuePair.first)=this->placeholders[entryValuePair.second];
                 }
                 
                 return *this->instantiatedModel;
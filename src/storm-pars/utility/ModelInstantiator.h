@@ -4,7 +4,9 @@
 #include <unordered_map>
 #include <memory>
 #include <type_traits>
+#include <boost/optional.hpp>
 
+#include "storm-pars/utility/CompiledFunctions.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
@@ -21,6 +23,8 @@ namespace storm {
          * This class allows efficient instantiation of the given parametric model.
          * The key to efficiency is to evaluate every distinct transition- (or reward-) function only once
          * instead of evaluating the same function for each occurrence in the model. 
+         * Optionally, the distinct functions are compiled once such that their evaluation does not involve the polynomial data structures.
+         * The compiled functions are evaluated in ConstantType arithmetic, so the results may differ from the rounded exact values in the last bits.
          */
         template<typename ParametricSparseModelType, typename ConstantSparseModelType>
             class ModelInstantiator {
@@ -33,8 +37,10 @@ namespace storm {
                 /*!
                  * Constructs a ModelInstantiator
                  * @param parametricModel The model that is to be instantiated
+                 * @param compileFunctions If set, the occurring functions are compiled (see CompiledFunctions). Otherwise,
+                 * they are evaluated exactly and the results are converted to ConstantType.
                  */
-                ModelInstantiator(ParametricSparseModelType const& parametricModel);
+                ModelInstantiator(ParametricSparseModelType const& parametricModel, bool compileFunctions = false);
                 
                 /*!
                  * Destructs the ModelInstantiator
@@ -135,13 +141,13 @@ namespace storm {
                  * @note constantMatrix and parametricMatrix should have entries at the same positions
                  * 
                  * @param constantMatrix The matrix to which the evaluation results are written
-                 * @param functions Occurring functions are inserted in this map
+                 * @param functions Occurring functions are inserted in this map together with the index of their placeholder
                  * @param mapping The connections of functions to matrix entries are push_backed  into this
                  * @param parametricMatrix the source matrix with the functions to consider.
                  */
                 void initializeMatrixMapping(storm::storage::SparseMatrix<ConstantType>& constantMatrix,
-                                             std::unordered_map<ParametricType, ConstantType>& functions,
-                                             std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>>& mapping,
+                                             std::unordered_map<ParametricType, uint_fast64_t>& functions,
+                                             std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, uint_fast64_t>>& mapping,
                                              storm::storage::SparseMatrix<ParametricType> const& parametricMatrix) const;
                 
                 /*!
@@ -150,23 +156,27 @@ namespace storm {
                  * @note constantVector and parametricVector should have the same size
                  * 
                  * @param constantVector The vector to which the evaluation results are written
-                 * @param functions Occurring functions with their placeholders are inserted in this map
+                 * @param functions Occurring functions are inserted in this map together with the index of their placeholder
                  * @param mapping The connections of functions to vector entries are push_backed  into this
                  * @param parametricVector the source vector with the functions to consider.
                  */
                 void initializeVectorMapping(std::vector<ConstantType>& constantVector,
-                                             std::unordered_map<ParametricType, ConstantType>& functions,
-                                             std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>>& mapping,
+                                             std::unordered_map<ParametricType, uint_fast64_t>& functions,
+                                             std::vector<std::pair<typename std::vector<ConstantType>::iterator, uint_fast64_t>>& mapping,
                                              std::vector<ParametricType> const& parametricVector) const;
                 
                 /// The resulting model
                 std::shared_ptr<ConstantSparseModelType> instantiatedModel;
-                /// the occurring functions together with the corresponding placeholders for their evaluated result
-                std::unordered_map<ParametricType, ConstantType> functions; 
+                /// the occurring functions together with the index of the corresponding placeholder for their evaluated result
+                std::unordered_map<ParametricType, uint_fast64_t> functions; 
+                /// the occurring functions, compiled such that the i-th function writes its result into the i-th placeholder (if compilation is enabled)
+                boost::optional<storm::utility::parametric::CompiledFunctions<ParametricType, ConstantType>> compiledFunctions;
+                /// the placeholders for the evaluated results
+                std::vector<ConstantType> placeholders;
                 /// Connection of matrix entries with placeholders
-                std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping; 
+                std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, uint_fast64_t>> matrixMapping; 
                 /// Connection of Vector entries with placeholders
-                std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping; 
+                std::vector<std::pair<typename std::vector<ConstantType>::iterator, uint_fast64_t>> vectorMapping; 
                 
                 
             };
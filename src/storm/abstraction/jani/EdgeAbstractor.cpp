@@ -23,7 +23,7 @@ namespace storm {
     namespace abstraction {
         namespace jani {
             template <storm::dd::DdType DdType, typename ValueType>
-            EdgeAbstractor<DdType, ValueType>::EdgeAbstractor(uint64_t edgeId, storm::jani::Edge const& edge, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition) : smtSolver(smtSolverFactory->create(abstractionInformation.getExpressionManager())), abstractionInformation(abstractionInformation), edgeId(edgeId), edge(edge), localExpressionInformation(abstractionInformation), evaluator(abstractionInformation.getExpressionManager()), relevantPredicatesAndVariables(), cachedDd(abstractionInformation.getDdManager().getBddZero(), 0), decisionVariables(), useDecomposition(useDecomposition), skipBottomStates(false), forceRecomputation(true), abstractGuard(abstractionInformation.getDdManager().getBddZero()), bottomStateAbstractor(abstractionInformation, {!edge.getGuard()}, smtSolverFactory) {
+            EdgeAbstractor<DdType, ValueType>::EdgeAbstractor(uint64_t edgeId, storm::jani::Edge const& edge, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition) : smtSolver(smtSolverFactory->create(abstractionInformation.getExpressionManager())), abstractionInformation(abstractionInformation), edgeId(edgeId), edge(edge), localExpressionInformation(abstractionInformation), evaluator(abstractionInformation.getExpressionManager()), relevantPredicatesAndVariables(), cachedDd(abstractionInformation.getDdManager().getBddZero(), 0), decisionVariables(), useDecomposition(useDecomposition), skipBottomStates(false), forceRecomputation(true), enumeratedSolutions(), solutionsEnumerated(false), abstractGuard(abstractionInformation.getDdManager().getBddZero()), bottomStateAbstractor(abstractionInformation, {!edge.getGuard()}, smtSolverFactory) {
                 
                 // Make the second component of relevant predicates have the right size.
                 relevantPredicatesAndVariables.second.resize(edge.getNumberOfDestinations());
@@ -53,6 +53,9 @@ namespace storm {
                 bool relevantPredicatesChanged = this->relevantPredicatesChanged(newRelevantPredicates);
                 if (relevantPredicatesChanged) {
                     addMissingPredicates(newRelevantPredicates);
+                    
+                    // Solutions that were enumerated before are not over the new decision variables.
+                    solutionsEnumerated = false;
                 }
                 forceRecomputation |= relevantPredicatesChanged;
                 
@@ -372,14 +375,20 @@ namespace storm {
                 STORM_LOG_TRACE("Recomputing BDD for edge with id " << edgeId << " and guard " << edge.get().getGuard());
                 auto start = std::chrono::high_resolution_clock::now();
                 
+                // Enumerate the solutions unless this was already done (possibly in parallel to other edges).
+                if (!solutionsEnumerated) {
+                    enumerateSolutionsWithoutDecomposition();
+                }
+                
                 // Create a mapping from source state DDs to their distributions.
                 std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
-                uint64_t numberOfSolutions = 0;
-                smtSolver->allSat(decisionVariables, [&sourceToDistributionsMap,this,&numberOfSolutions] (storm::solver::SmtSolver::ModelReference const& model) {
-                    sourceToDistributionsMap[getSourceStateBdd(model, relevantPredicatesAndVariables.first)].push_back(getDistributionBdd(model, relevantPredicatesAndVariables.second));
-                    ++numberOfSolutions;
-                    return true;
-                });
+                uint64_t numberOfSolutions = enumeratedSolutions.size();
+                for (auto const& solution : enumeratedSolutions) {
+                    sourceToDistributionsMap[getSourceStateBdd(solution)].push_back(getDistributionBdd(solution));
+                }
+                enumeratedSolutions.clear();
+                enumeratedSolutions.shrink_to_fit();
+                solutionsEnumerated = false;
                 
                 // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
                 // need to encode the nondeterminism.
@@ -554,6 +563,50 @@ namespace storm {
                 return result;
             }
             
+            template <storm::dd::DdType DdType, typename ValueType>
+            storm::dd::Bdd<DdType> EdgeAbstractor<DdType, ValueType>::getSourceStateBdd(storm::storage::BitVector const& solution) const {
+                storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddOne();
+                uint64_t position = 0;
+                for (auto const& variableIndexPair : relevantPredicatesAndVariables.first) {
+                    if (solution.get(position)) {
+                        result &= this->getAbstractionInformation().encodePredicateAsSource(variableIndexPair.second);
+                    } else {
+                        result &= !this->getAbstractionInformation().encodePredicateAsSource(variableIndexPair.second);
+                    }
+                    ++position;
+                }
+                
+                STORM_LOG_ASSERT(!result.isZero(), "Source must not be empty.");
+                return result;
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            storm::dd::Bdd<DdType> EdgeAbstractor<DdType, ValueType>::getDistributionBdd(storm::storage::BitVector const& solution) const {
+                storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddZero();
+                
+                // The successor predicates are stored after the source predicates.
+                uint64_t position = relevantPredicatesAndVariables.first.size();
+                for (uint_fast64_t destinationIndex = 0; destinationIndex < edge.get().getNumberOfDestinations(); ++destinationIndex) {
+                    storm::dd::Bdd<DdType> updateBdd = this->getAbstractionInformation().getDdManager().getBddOne();
+                    
+                    // Translate block variables for this destination into a successor block.
+                    for (auto const& variableIndexPair : relevantPredicatesAndVariables.second[destinationIndex]) {
+                        if (solution.get(position)) {
+                            updateBdd &= this->getAbstractionInformation().encodePredicateAsSuccessor(variableIndexPair.second);
+                        } else {
+                            updateBdd &= !this->getAbstractionInformation().encodePredicateAsSuccessor(variableIndexPair.second);
+                        }
+                        updateBdd &= this->getAbstractionInformation().encodeAux(destinationIndex, 0, this->getAbstractionInformation().getAuxVariableCount());
+                        ++position;
+                    }
+                    
+                    result |= updateBdd;
+                }
+                
+                STORM_LOG_ASSERT(!result.isZero(), "Distribution must not be empty.");
+                return result;
+            }
+            
             template <storm::dd::DdType DdType, typename ValueType>
             storm::dd::Bdd<DdType> EdgeAbstractor<DdType, ValueType>::computeMissingIdentities() const {
                 storm::dd::Bdd<DdType> identities = computeMissingGlobalIdentities();
@@ -608,6 +661,41 @@ namespace storm {
                 return result;
             }
             
+            template <storm::dd::DdType DdType, typename ValueType>
+            void EdgeAbstractor<DdType, ValueType>::enumerateSolutions() {
+                if (forceRecomputation && !useDecomposition && !solutionsEnumerated) {
+                    enumerateSolutionsWithoutDecomposition();
+                }
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            void EdgeAbstractor<DdType, ValueType>::enumerateSolutionsWithoutDecomposition() {
+                uint64_t numberOfRelevantPredicates = relevantPredicatesAndVariables.first.size();
+                for (auto const& destinationVariablesAndPredicates : relevantPredicatesAndVariables.second) {
+                    numberOfRelevantPredicates += destinationVariablesAndPredicates.size();
+                }
+                
+                // Only store the values of the variables, because building the DDs right away is not thread-safe.
+                enumeratedSolutions.clear();
+                smtSolver->allSat(decisionVariables, [this,numberOfRelevantPredicates] (storm::solver::SmtSolver::ModelReference const& model) {
+                    storm::storage::BitVector solution(numberOfRelevantPredicates);
+                    uint64_t position = 0;
+                    for (auto const& variableIndexPair : relevantPredicatesAndVariables.first) {
+                        solution.set(position, model.getBooleanValue(variableIndexPair.first));
+                        ++position;
+                    }
+                    for (auto const& destinationVariablesAndPredicates : relevantPredicatesAndVariables.second) {
+                        for (auto const& variableIndexPair : destinationVariablesAndPredicates) {
+                            solution.set(position, model.getBooleanValue(variableIndexPair.first));
+                            ++position;
+                        }
+                    }
+                    enumeratedSolutions.push_back(std::move(solution));
+                    return true;
+                });
+                solutionsEnumerated = true;
+            }
+            
             template <storm::dd::DdType DdType, typename ValueType>
             GameBddResult<DdType> EdgeAbstractor<DdType, ValueType>::abstract() {
                 if (forceRecomputation) {
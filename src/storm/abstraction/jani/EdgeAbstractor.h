@@ -10,6 +10,7 @@
 #include "storm/abstraction/GameBddResult.h"
 
 #include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/BitVector.h"
 
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/expressions/Expression.h"
@@ -86,6 +87,14 @@ namespace storm {
                  */
                 GameBddResult<DdType> abstract();
                 
+                /*!
+                 * If the abstraction of the edge needs to be recomputed and the decomposition is not used, this
+                 * enumerates the solutions of the SMT solver and stores them until the next call to abstract() turns
+                 * them into the BDD. Since this does not touch the DD manager, it may be called for several edges
+                 * concurrently.
+                 */
+                void enumerateSolutions();
+                
                 /*!
                  * Retrieves the transitions to bottom states of this edge.
                  *
@@ -161,6 +170,27 @@ namespace storm {
                  */
                 storm::dd::Bdd<DdType> getDistributionBdd(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const;
                 
+                /*!
+                 * Translates the given enumerated solution to a source state DD.
+                 *
+                 * @param solution The solution to translate.
+                 * @return The source state encoded as a DD.
+                 */
+                storm::dd::Bdd<DdType> getSourceStateBdd(storm::storage::BitVector const& solution) const;
+                
+                /*!
+                 * Translates the given enumerated solution to a distribution over successor states.
+                 *
+                 * @param solution The solution to translate.
+                 * @return The distribution encoded as a DD.
+                 */
+                storm::dd::Bdd<DdType> getDistributionBdd(storm::storage::BitVector const& solution) const;
+                
+                /*!
+                 * Enumerates all solutions over the decision variables and stores them in the enumerated solutions.
+                 */
+                void enumerateSolutionsWithoutDecomposition();
+                
                 /*!
                  * Recomputes the cached BDD. This needs to be triggered if any relevant predicates change.
                  */
@@ -254,6 +284,14 @@ namespace storm {
                 // A flag remembering whether we need to force recomputation of the BDD.
                 bool forceRecomputation;
                 
+                // The solutions enumerated by the SMT solver that are yet to be translated to the cached BDD. Every
+                // solution stores the values of the relevant source predicates followed by the values of the relevant
+                // successor predicates of each destination.
+                std::vector<storm::storage::BitVector> enumeratedSolutions;
+                
+                // A flag indicating whether the enumerated solutions are up-to-date.
+                bool solutionsEnumerated;
+                
                 // The abstract guard of the edge. This is only used if the guard is not a predicate, because it can
                 // then be used to constrain the bottom state abstractor.
                 storm::dd::Bdd<DdType> abstractGuard;
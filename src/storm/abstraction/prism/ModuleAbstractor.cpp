@@ -10,12 +10,17 @@
 #include "storm/storage/prism/Module.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm-config.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/macros.h"
 
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/tbb.h"
+#endif
+
 namespace storm {
     namespace abstraction {
         namespace prism {
@@ -52,6 +57,18 @@ namespace storm {
             
             template <storm::dd::DdType DdType, typename ValueType>
             GameBddResult<DdType> ModuleAbstractor<DdType, ValueType>::abstract() {
+#ifdef STORM_HAVE_INTELTBB
+                // The SMT-based part of the abstraction does not touch the DD manager, so it can be performed for all
+                // commands in parallel (each of them owns its SMT solver). The BDDs are then built sequentially below.
+                if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, commands.size()), [this] (tbb::blocked_range<uint_fast64_t> const& range) {
+                        for (uint_fast64_t index = range.begin(); index < range.end(); ++index) {
+                            commands[index].enumerateSolutions();
+                        }
+                    });
+                }
+#endif
+                
                 // First, we retrieve the abstractions of all commands.
                 std::vector<GameBddResult<DdType>> commandDdsAndUsedOptionVariableCounts;
                 uint_fast64_t maximalNumberOfUsedOptionVariables = 0;
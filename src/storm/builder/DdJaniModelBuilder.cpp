@@ -30,6 +30,8 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 
+#include "storm/builder/DdVariableOrdering.h"
+
 #include "storm/utility/macros.h"
 #include "storm/utility/jani.h"
 #include "storm/utility/dd.h"
@@ -327,12 +329,14 @@ namespace storm {
                     result.allNondeterminismVariables.insert(result.markovNondeterminismVariable);
                 }
                 
+                createMetaVariablesInOrder(result);
+                
                 for (auto const& automatonName : this->automata) {
                     storm::jani::Automaton const& automaton =  this->model.getAutomaton(automatonName);
                     
                     // Start by creating a meta variable for the location of the automaton.
                     storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair = variableToMetaVariablesMap.at(locationExpressionVariable);
                     result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
                     result.rowColumnMetaVariablePairs.push_back(variablePair);
 
@@ -397,6 +401,55 @@ namespace storm {
                 return result;
             }
             
+            /*!
+             * Creates the meta variables of the location variables and the non-transient variables in the order that is
+             * chosen by the variable ordering. The remaining methods look up the created meta variables.
+             */
+            void createMetaVariablesInOrder(CompositionVariables<Type, ValueType>& result) {
+                std::vector<storm::expressions::Variable> variables;
+                std::unordered_map<storm::expressions::Variable, std::pair<int_fast64_t, int_fast64_t>> integerVariableToBoundsMap;
+                for (auto const& automatonName : this->automata) {
+                    storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
+                    variables.push_back(automaton.getLocationExpressionVariable());
+                    integerVariableToBoundsMap.emplace(automaton.getLocationExpressionVariable(), std::pair<int_fast64_t, int_fast64_t>(0, automaton.getNumberOfLocations() - 1));
+                }
+                auto addVariable = [&] (storm::jani::Variable const& variable) {
+                    if (variable.isTransient()) {
+                        return;
+                    }
+                    variables.push_back(variable.getExpressionVariable());
+                    if (variable.isBoundedIntegerVariable()) {
+                        integerVariableToBoundsMap.emplace(variable.getExpressionVariable(), std::make_pair(variable.asBoundedIntegerVariable().getLowerBound().evaluateAsInt(), variable.asBoundedIntegerVariable().getUpperBound().evaluateAsInt()));
+                    }
+                };
+                for (auto const& variable : this->model.getGlobalVariables()) {
+                    addVariable(variable);
+                }
+                for (auto const& automaton : this->model.getAutomata()) {
+                    for (auto const& variable : automaton.getVariables()) {
+                        addVariable(variable);
+                    }
+                }
+                
+                // The location variables are named after their automata.
+                std::unordered_map<storm::expressions::Variable, std::string> locationVariableToNameMap;
+                for (auto const& automatonName : this->automata) {
+                    locationVariableToNameMap.emplace(this->model.getAutomaton(automatonName).getLocationExpressionVariable(), "l_" + automatonName);
+                }
+                
+                variableToMetaVariablesMap.clear();
+                for (auto const& variable : storm::builder::DdVariableOrdering::create(this->model, variables).computeOrderFromSettings()) {
+                    auto nameIt = locationVariableToNameMap.find(variable);
+                    std::string const& name = nameIt != locationVariableToNameMap.end() ? nameIt->second : variable.getName();
+                    auto boundsIt = integerVariableToBoundsMap.find(variable);
+                    if (boundsIt != integerVariableToBoundsMap.end()) {
+                        variableToMetaVariablesMap.emplace(variable, result.manager->addMetaVariable(name, boundsIt->second.first, boundsIt->second.second));
+                    } else {
+                        variableToMetaVariablesMap.emplace(variable, result.manager->addMetaVariable(name));
+                    }
+                }
+            }
+            
             void createVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
                 if (variable.isBooleanVariable()) {
                     createVariable(variable.asBooleanVariable(), result);
@@ -408,9 +461,7 @@ namespace storm {
             }
             
             void createVariable(storm::jani::BoundedIntegerVariable const& variable, CompositionVariables<Type, ValueType>& result) {
-                int_fast64_t low = variable.getLowerBound().evaluateAsInt();
-                int_fast64_t high = variable.getUpperBound().evaluateAsInt();
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable(variable.getExpressionVariable().getName(), low, high);
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair = variableToMetaVariablesMap.at(variable.getExpressionVariable());
                 
                 STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << " and " << variablePair.second.getName() << ".");
                 
@@ -430,7 +481,7 @@ namespace storm {
             }
             
             void createVariable(storm::jani::BooleanVariable const& variable, CompositionVariables<Type, ValueType>& result) {
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable(variable.getExpressionVariable().getName());
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair = variableToMetaVariablesMap.at(variable.getExpressionVariable());
                 
                 STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << " and " << variablePair.second.getName() << ".");
                 
@@ -453,15 +504,23 @@ namespace storm {
             storm::jani::Model const& model;
             std::set<std::string> automata;
             storm::jani::CompositionInformation actionInformation;
+            
+            // The meta variables of the location variables and the non-transient variables.
+            std::unordered_map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> variableToMetaVariablesMap;
         };
         
         template <storm::dd::DdType Type, typename ValueType>
         struct ComposerResult {
-            ComposerResult(storm::dd::Add<Type, ValueType> const& transitions, std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> const& transientLocationAssignments, std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> const& transientEdgeAssignments, storm::dd::Bdd<Type> const& illegalFragment, uint64_t numberOfNondeterminismVariables = 0) : transitions(transitions), transientLocationAssignments(transientLocationAssignments), transientEdgeAssignments(transientEdgeAssignments), illegalFragment(illegalFragment), numberOfNondeterminismVariables(numberOfNondeterminismVariables) {
+            ComposerResult(storm::dd::Add<Type, ValueType> const& transitions, std::vector<storm::dd::Bdd<Type>> const& transitionRelationParts, std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> const& transientLocationAssignments, std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> const& transientEdgeAssignments, storm::dd::Bdd<Type> const& illegalFragment, uint64_t numberOfNondeterminismVariables = 0) : transitions(transitions), transitionRelationParts(transitionRelationParts), transientLocationAssignments(transientLocationAssignments), transientEdgeAssignments(transientEdgeAssignments), illegalFragment(illegalFragment), numberOfNondeterminismVariables(numberOfNondeterminismVariables) {
                 // Intentionally left empty.
             }
             
             storm::dd::Add<Type, ValueType> transitions;
+            
+            // The transition relation split into one part per action (with the nondeterminism variables abstracted).
+            // The disjunction of the parts is the support of the transitions.
+            std::vector<storm::dd::Bdd<Type>> transitionRelationParts;
+
             std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientLocationAssignments;
             std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
             storm::dd::Bdd<Type> illegalFragment;
@@ -1639,6 +1698,7 @@ namespace storm {
                 // If the model is an MDP, we need to encode the nondeterminism using additional variables.
                 if (this->model.getModelType() == storm::jani::ModelType::MDP || this->model.getModelType() == storm::jani::ModelType::LTS) {
                     storm::dd::Add<Type, ValueType> result = this->variables.manager->template getAddZero<ValueType>();
+                    std::vector<storm::dd::Bdd<Type>> transitionRelationParts;
                     storm::dd::Bdd<Type> illegalFragment = this->variables.manager->getBddZero();
                     
                     // First, determine the highest number of nondeterminism variables that is used in any action and make
@@ -1663,13 +1723,15 @@ namespace storm {
                         }
                         
                         result += extendedTransitions;
+                        transitionRelationParts.push_back(action.second.transitions.notZero().existsAbstract(this->variables.allNondeterminismVariables));
                     }
                     
-                    return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, numberOfUsedNondeterminismVariables);
+                    return ComposerResult<Type, ValueType>(result, transitionRelationParts, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, numberOfUsedNondeterminismVariables);
                 } else if (this->model.getModelType() == storm::jani::ModelType::DTMC || this->model.getModelType() == storm::jani::ModelType::CTMC) {
                     // Simply add all actions, but make sure to include the missing global variable identities.
 
                     storm::dd::Add<Type, ValueType> result = this->variables.manager->template getAddZero<ValueType>();
+                    std::vector<storm::dd::Bdd<Type>> transitionRelationParts;
                     storm::dd::Bdd<Type> illegalFragment = this->variables.manager->getBddZero();
                     std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
                     std::unordered_set<uint64_t> actionIndices;
@@ -1680,9 +1742,10 @@ namespace storm {
                         addMissingGlobalVariableIdentities(action.second);
                         addToTransientAssignmentMap(transientEdgeAssignments, action.second.transientEdgeAssignments);
                         result += action.second.transitions;
+                        transitionRelationParts.push_back(action.second.transitions.notZero());
                     }
 
-                    return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0);
+                    return ComposerResult<Type, ValueType>(result, transitionRelationParts, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0);
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Model type '" << this->model.getModelType() << "' not supported.");
                 }
@@ -1770,6 +1833,9 @@ namespace storm {
                 }
                 
                 system.transitions *= (!terminalStatesBdd).template toAdd<ValueType>();
+                for (auto& part : system.transitionRelationParts) {
+                    part &= !terminalStatesBdd;
+                }
                 return terminalStatesBdd;
             }
             return variables.manager->getBddZero();
@@ -1796,9 +1862,8 @@ namespace storm {
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        storm::dd::Bdd<Type> fixDeadlocks(storm::jani::ModelType const& modelType, storm::dd::Add<Type, ValueType>& transitionMatrix, storm::dd::Bdd<Type> const& transitionMatrixBdd, storm::dd::Bdd<Type> const& reachableStates, CompositionVariables<Type, ValueType> const& variables) {
+        storm::dd::Bdd<Type> fixDeadlocks(storm::jani::ModelType const& modelType, storm::dd::Add<Type, ValueType>& transitionMatrix, storm::dd::Bdd<Type> const& statesWithTransition, storm::dd::Bdd<Type> const& reachableStates, CompositionVariables<Type, ValueType> const& variables) {
             // Detect deadlocks and 1) fix them if requested 2) throw an error otherwise.
-            storm::dd::Bdd<Type> statesWithTransition = transitionMatrixBdd.existsAbstract(variables.columnMetaVariables);
             storm::dd::Bdd<Type> deadlockStates = reachableStates && !statesWithTransition;
             
             if (!deadlockStates.isZero()) {
@@ -1976,12 +2041,14 @@ namespace storm {
             // Build initial states.
             modelComponents.initialStates = computeInitialStates(preparedModel, variables);
             
-            // Perform reachability analysis to obtain reachable states.
-            storm::dd::Bdd<Type> transitionMatrixBdd = system.transitions.notZero();
-            if (preparedModel.getModelType() == storm::jani::ModelType::MDP || preparedModel.getModelType() == storm::jani::ModelType::LTS) {
-                transitionMatrixBdd = transitionMatrixBdd.existsAbstract(variables.allNondeterminismVariables);
+            // Perform reachability analysis to obtain reachable states. As for PRISM programs, the transition relation
+            // is explored action by action, which avoids building the monolithic transition relation.
+            modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, system.transitionRelationParts, variables.rowMetaVariables, variables.columnMetaVariables, storm::utility::dd::ReachabilityOrder::Chaining);
+            storm::dd::Bdd<Type> statesWithTransition = variables.manager->getBddZero();
+            for (auto const& part : system.transitionRelationParts) {
+                statesWithTransition |= part.existsAbstract(variables.columnMetaVariables);
             }
-            modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd, variables.rowMetaVariables, variables.columnMetaVariables);
+            system.transitionRelationParts.clear();
             
             // Check that the reachable fragment does not overlap with the illegal fragment.
             storm::dd::Bdd<Type> reachableIllegalFragment = modelComponents.reachableStates && system.illegalFragment;
@@ -1992,7 +2059,7 @@ namespace storm {
             modelComponents.transitionMatrix = system.transitions * reachableStatesAdd;
 
             // Fix deadlocks if existing.
-            modelComponents.deadlockStates = fixDeadlocks(preparedModel.getModelType(), modelComponents.transitionMatrix, transitionMatrixBdd, modelComponents.reachableStates, variables);
+            modelComponents.deadlockStates = fixDeadlocks(preparedModel.getModelType(), modelComponents.transitionMatrix, statesWithTransition, modelComponents.reachableStates, variables);
             
             // Cut the deadlock states by removing all states that we 'converted' to deadlock states by making them terminal.
             modelComponents.deadlockStates = modelComponents.deadlockStates && !terminalStates;
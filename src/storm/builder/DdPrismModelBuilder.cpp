@@ -17,6 +17,8 @@
 #include "storm/utility/math.h"
 #include "storm/utility/dd.h"
 
+#include "storm/builder/DdVariableOrdering.h"
+
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/prism/Compositions.h"
@@ -175,11 +177,30 @@ namespace storm {
                     allNondeterminismVariables.insert(variablePair.first);
                 }
                 
+                // Create the meta variables of the program variables in the order that is chosen by the variable
+                // ordering, such that the meta variables can be looked up by the code below.
+                std::unordered_map<storm::expressions::Variable, std::pair<int_fast64_t, int_fast64_t>> integerVariableToBoundsMap;
+                for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
+                    integerVariableToBoundsMap.emplace(integerVariable.getExpressionVariable(), std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(), integerVariable.getUpperBoundExpression().evaluateAsInt()));
+                }
+                for (storm::prism::Module const& module : program.getModules()) {
+                    for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+                        integerVariableToBoundsMap.emplace(integerVariable.getExpressionVariable(), std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(), integerVariable.getUpperBoundExpression().evaluateAsInt()));
+                    }
+                }
+                std::unordered_map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> variableToMetaVariablesMap;
+                for (auto const& variable : storm::builder::DdVariableOrdering::create(program).computeOrderFromSettings()) {
+                    auto boundsIt = integerVariableToBoundsMap.find(variable);
+                    if (boundsIt != integerVariableToBoundsMap.end()) {
+                        variableToMetaVariablesMap.emplace(variable, manager->addMetaVariable(variable.getName(), boundsIt->second.first, boundsIt->second.second));
+                    } else {
+                        variableToMetaVariablesMap.emplace(variable, manager->addMetaVariable(variable.getName()));
+                    }
+                }
+                
                 // Create meta variables for global program variables.
                 for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
-                    int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                    int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair = variableToMetaVariablesMap.at(integerVariable.getExpressionVariable());
                     
                     STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                     
@@ -196,7 +217,7 @@ namespace storm {
                     allGlobalVariables.insert(integerVariable.getExpressionVariable());
                 }
                 for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair = variableToMetaVariablesMap.at(booleanVariable.getExpressionVariable());
                     
                     STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                     
@@ -219,9 +240,7 @@ namespace storm {
                     storm::dd::Bdd<Type> moduleRange = manager->getBddOne();
                     
                     for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
-                        int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                        int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
+                        std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair = variableToMetaVariablesMap.at(integerVariable.getExpressionVariable());
                         STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                         
                         rowMetaVariables.insert(variablePair.first);
@@ -238,7 +257,7 @@ namespace storm {
                         rowColumnMetaVariablePairs.push_back(variablePair);
                     }
                     for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+                        std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair = variableToMetaVariablesMap.at(booleanVariable.getExpressionVariable());
                         STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                         
                         rowMetaVariables.insert(variablePair.first);
@@ -1155,6 +1174,38 @@ namespace storm {
             return result;
         }
         
+        template <storm::dd::DdType Type, typename ValueType>
+        std::vector<storm::dd::Bdd<Type>> DdPrismModelBuilder<Type, ValueType>::createTransitionRelationParts(GenerationInformation const& generationInfo, ModuleDecisionDiagram const& module, storm::dd::Bdd<Type> const& terminalStates) {
+            std::vector<storm::dd::Bdd<Type>> result;
+            
+            // Creates the part of the transition relation that stems from the given action.
+            auto createPart = [&] (ActionDecisionDiagram const& action) {
+                // Make sure that the global variables that are not written by the action keep their values.
+                storm::dd::Bdd<Type> part = action.transitionsDd.notZero();
+                for (auto const& variable : generationInfo.allGlobalVariables) {
+                    if (action.assignedGlobalVariables.find(variable) == action.assignedGlobalVariables.end()) {
+                        part &= generationInfo.variableToIdentityMap.at(variable).notZero();
+                    }
+                }
+                if (generationInfo.program.getModelType() == storm::prism::Program::ModelType::MDP) {
+                    part = part.existsAbstract(generationInfo.allNondeterminismVariables);
+                }
+                
+                // Terminal states are not explored further.
+                part &= !terminalStates;
+                if (!part.isZero()) {
+                    result.push_back(part);
+                }
+            };
+            
+            createPart(module.independentAction);
+            for (auto const& synchronizingAction : module.synchronizingActionToDecisionDiagramMap) {
+                createPart(synchronizingAction.second);
+            }
+            
+            return result;
+        }
+        
         template <storm::dd::DdType Type, typename ValueType>
         typename DdPrismModelBuilder<Type, ValueType>::SystemResult DdPrismModelBuilder<Type, ValueType>::createSystemDecisionDiagram(GenerationInformation& generationInfo) {
             ModuleComposer<Type, ValueType> composer(generationInfo);
@@ -1403,12 +1454,10 @@ namespace storm {
             // Cut the transitions and rewards to the reachable fragment of the state space.
             storm::dd::Bdd<Type> initialStates = createInitialStatesDecisionDiagram(generationInfo);
             
-            storm::dd::Bdd<Type> transitionMatrixBdd = transitionMatrix.notZero();
-            if (program.getModelType() == storm::prism::Program::ModelType::MDP) {
-                transitionMatrixBdd = transitionMatrixBdd.existsAbstract(generationInfo.allNondeterminismVariables);
-            }
-            
-            storm::dd::Bdd<Type> reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables, generationInfo.columnMetaVariables);
+            // The reachable states are explored using the transition relation partitioned by actions, which avoids
+            // building the (potentially much larger) monolithic transition relation.
+            std::vector<storm::dd::Bdd<Type>> transitionRelationParts = createTransitionRelationParts(generationInfo, globalModule, terminalStatesBdd);
+            storm::dd::Bdd<Type> reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionRelationParts, generationInfo.rowMetaVariables, generationInfo.columnMetaVariables, storm::utility::dd::ReachabilityOrder::Chaining);
             storm::dd::Add<Type, ValueType> reachableStatesAdd = reachableStates.template toAdd<ValueType>();
             transitionMatrix *= reachableStatesAdd;
             if (system.stateActionDd) {
@@ -1416,7 +1465,11 @@ namespace storm {
             }
             
             // Detect deadlocks and 1) fix them if requested 2) throw an error otherwise.
-            storm::dd::Bdd<Type> statesWithTransition = transitionMatrixBdd.existsAbstract(generationInfo.columnMetaVariables);
+            storm::dd::Bdd<Type> statesWithTransition = generationInfo.manager->getBddZero();
+            for (auto const& part : transitionRelationParts) {
+                statesWithTransition |= part.existsAbstract(generationInfo.columnMetaVariables);
+            }
+            transitionRelationParts.clear();
             storm::dd::Bdd<Type> deadlockStates = reachableStates && !statesWithTransition;
                         
             // If there are deadlocks, either fix them or raise an error.
@@ -0,0 +1,321 @@
+#include "storm/builder/DdVariableOrdering.h"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <numeric>
+#include <sstream>
+
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/jani/Model.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+
+#include "storm/utility/file.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace builder {
+
+        std::ostream& operator<<(std::ostream& out, DdVariableOrderingHeuristic const& heuristic) {
+            switch (heuristic) {
+                case DdVariableOrderingHeuristic::Declaration:
+                    out << "declaration";
+                    break;
+                case DdVariableOrderingHeuristic::Force:
+                    out << "force";
+                    break;
+                default:
+                    out << "undefined";
+                    break;
+            }
+            return out;
+        }
+
+        namespace detail {
+            void addVariables(storm::expressions::Expression const& expression, std::set<storm::expressions::Variable>& variables) {
+                if (expression.isInitialized()) {
+                    std::set<storm::expressions::Variable> expressionVariables = expression.getVariables();
+                    variables.insert(expressionVariables.begin(), expressionVariables.end());
+                }
+            }
+
+            void addVariables(storm::jani::OrderedAssignments const& assignments, std::set<storm::expressions::Variable>& variables) {
+                for (auto const& assignment : assignments) {
+                    variables.insert(assignment.getExpressionVariable());
+                    addVariables(assignment.getAssignedExpression(), variables);
+                }
+            }
+        }
+
+        const uint64_t DdVariableOrdering::FORCE_ITERATIONS = 20;
+
+        DdVariableOrdering::DdVariableOrdering(std::vector<storm::expressions::Variable> const& variables) : variables(variables) {
+            for (uint64_t index = 0; index < variables.size(); ++index) {
+                variableToIndexMap.emplace(variables[index], index);
+            }
+        }
+
+        DdVariableOrdering DdVariableOrdering::create(storm::prism::Program const& program) {
+            std::vector<storm::expressions::Variable> variables;
+            for (auto const& integerVariable : program.getGlobalIntegerVariables()) {
+                variables.push_back(integerVariable.getExpressionVariable());
+            }
+            for (auto const& booleanVariable : program.getGlobalBooleanVariables()) {
+                variables.push_back(booleanVariable.getExpressionVariable());
+            }
+            for (auto const& module : program.getModules()) {
+                for (auto const& integerVariable : module.getIntegerVariables()) {
+                    variables.push_back(integerVariable.getExpressionVariable());
+                }
+                for (auto const& booleanVariable : module.getBooleanVariables()) {
+                    variables.push_back(booleanVariable.getExpressionVariable());
+                }
+            }
+            DdVariableOrdering result(variables);
+
+            // Every command relates the variables of its guard and its updates and all commands that synchronize over
+            // an action are combined into one transition that relates all their variables.
+            std::map<uint_fast64_t, std::set<storm::expressions::Variable>> actionIndexToVariables;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    std::set<storm::expressions::Variable> commandVariables;
+                    detail::addVariables(command.getGuardExpression(), commandVariables);
+                    for (auto const& update : command.getUpdates()) {
+                        detail::addVariables(update.getLikelihoodExpression(), commandVariables);
+                        for (auto const& assignment : update.getAssignments()) {
+                            commandVariables.insert(assignment.getVariable());
+                            detail::addVariables(assignment.getExpression(), commandVariables);
+                        }
+                    }
+                    if (command.isLabeled()) {
+                        actionIndexToVariables[command.getActionIndex()].insert(commandVariables.begin(), commandVariables.end());
+                    }
+                    result.addInteraction(commandVariables);
+                }
+            }
+            for (auto const& actionVariablesPair : actionIndexToVariables) {
+                result.addInteraction(actionVariablesPair.second);
+            }
+
+            return result;
+        }
+
+        DdVariableOrdering DdVariableOrdering::create(storm::jani::Model const& model, std::vector<storm::expressions::Variable> const& variables) {
+            DdVariableOrdering result(variables);
+
+            std::map<uint64_t, std::set<storm::expressions::Variable>> actionIndexToVariables;
+            for (auto const& automaton : model.getAutomata()) {
+                for (auto const& edge : automaton.getEdges()) {
+                    // An edge always relates the location variable of its automaton with the variables it refers to.
+                    std::set<storm::expressions::Variable> edgeVariables = {automaton.getLocationExpressionVariable()};
+                    detail::addVariables(edge.getGuard(), edgeVariables);
+                    if (edge.hasRate()) {
+                        detail::addVariables(edge.getRate(), edgeVariables);
+                    }
+                    detail::addVariables(edge.getAssignments(), edgeVariables);
+                    for (auto const& destination : edge.getDestinations()) {
+                        detail::addVariables(destination.getProbability(), edgeVariables);
+                        detail::addVariables(destination.getOrderedAssignments(), edgeVariables);
+                    }
+                    if (edge.getActionIndex() != storm::jani::Model::SILENT_ACTION_INDEX) {
+                        actionIndexToVariables[edge.getActionIndex()].insert(edgeVariables.begin(), edgeVariables.end());
+                    }
+                    result.addInteraction(edgeVariables);
+                }
+            }
+            for (auto const& actionVariablesPair : actionIndexToVariables) {
+                result.addInteraction(actionVariablesPair.second);
+            }
+
+            return result;
+        }
+
+        void DdVariableOrdering::addInteraction(std::set<storm::expressions::Variable> const& interactingVariables) {
+            std::vector<uint64_t> interaction;
+            for (auto const& variable : interactingVariables) {
+                auto indexIt = variableToIndexMap.find(variable);
+                if (indexIt != variableToIndexMap.end()) {
+                    interaction.push_back(indexIt->second);
+                }
+            }
+
+            // Interactions of less than two variables do not influence the order.
+            if (interaction.size() > 1) {
+                std::sort(interaction.begin(), interaction.end());
+                interactions.push_back(std::move(interaction));
+            }
+        }
+
+        std::vector<storm::expressions::Variable> DdVariableOrdering::computeOrder(DdVariableOrderingHeuristic const& heuristic) const {
+            if (heuristic == DdVariableOrderingHeuristic::Declaration) {
+                return variables;
+            }
+
+            std::vector<storm::expressions::Variable> result;
+            for (auto const& index : computeForceOrder()) {
+                result.push_back(variables[index]);
+            }
+            STORM_LOG_DEBUG("Reduced total span of variable interactions from " << getTotalSpan(variables) << " to " << getTotalSpan(result) << ".");
+            return result;
+        }
+
+        std::vector<storm::expressions::Variable> DdVariableOrdering::computeOrderFromSettings() const {
+            auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+
+            std::vector<storm::expressions::Variable> result;
+            if (buildSettings.isImportDdVariableOrderSet()) {
+                result = importOrder(buildSettings.getImportDdVariableOrderFilename());
+            } else {
+                result = computeOrder(buildSettings.getDdVariableOrderingHeuristic());
+            }
+
+            if (buildSettings.isExportDdVariableOrderSet()) {
+                exportOrder(result, buildSettings.getExportDdVariableOrderFilename());
+            }
+
+            if (result != variables) {
+                std::stringstream stream;
+                bool first = true;
+                for (auto const& variable : result) {
+                    if (!first) {
+                        stream << ", ";
+                    }
+                    first = false;
+                    stream << variable.getName();
+                }
+                STORM_LOG_INFO("Using variable order " << stream.str() << ".");
+            }
+            return result;
+        }
+
+        uint64_t DdVariableOrdering::getTotalSpan(std::vector<storm::expressions::Variable> const& order) const {
+            std::vector<uint64_t> position(variables.size());
+            for (uint64_t index = 0; index < order.size(); ++index) {
+                position[variableToIndexMap.at(order[index])] = index;
+            }
+            return getTotalSpan(position);
+        }
+
+        uint64_t DdVariableOrdering::getTotalSpan(std::vector<uint64_t> const& position) const {
+            uint64_t result = 0;
+            for (auto const& interaction : interactions) {
+                uint64_t minimalPosition = position[interaction.front()];
+                uint64_t maximalPosition = minimalPosition;
+                for (auto const& index : interaction) {
+                    minimalPosition = std::min(minimalPosition, position[index]);
+                    maximalPosition = std::max(maximalPosition, position[index]);
+                }
+                result += maximalPosition - minimalPosition;
+            }
+            return result;
+        }
+
+        std::vector<uint64_t> DdVariableOrdering::computeForceOrder() const {
+            // The interactions each variable takes part in.
+            std::vector<std::vector<uint64_t>> variableToInteractions(variables.size());
+            for (uint64_t interactionIndex = 0; interactionIndex < interactions.size(); ++interactionIndex) {
+                for (auto const& index : interactions[interactionIndex]) {
+                    variableToInteractions[index].push_back(interactionIndex);
+                }
+            }
+
+            // Start from the declaration order.
+            std::vector<uint64_t> order(variables.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::vector<uint64_t> position = order;
+
+            std::vector<uint64_t> bestOrder = order;
+            uint64_t bestSpan = getTotalSpan(position);
+
+            std::vector<double> centers(interactions.size());
+            std::vector<double> newPositions(variables.size());
+            for (uint64_t iteration = 0; iteration < FORCE_ITERATIONS && bestSpan > 0; ++iteration) {
+                // Compute the centers of gravity of the interactions.
+                for (uint64_t interactionIndex = 0; interactionIndex < interactions.size(); ++interactionIndex) {
+                    double sum = 0;
+                    for (auto const& index : interactions[interactionIndex]) {
+                        sum += position[index];
+                    }
+                    centers[interactionIndex] = sum / interactions[interactionIndex].size();
+                }
+
+                // Move every variable to the average center of its interactions.
+                for (uint64_t index = 0; index < variables.size(); ++index) {
+                    if (variableToInteractions[index].empty()) {
+                        newPositions[index] = position[index];
+                    } else {
+                        double sum = 0;
+                        for (auto const& interactionIndex : variableToInteractions[index]) {
+                            sum += centers[interactionIndex];
+                        }
+                        newPositions[index] = sum / variableToInteractions[index].size();
+                    }
+                }
+
+                // Derive the new order from the tentative positions.
+                std::stable_sort(order.begin(), order.end(), [&newPositions] (uint64_t const& first, uint64_t const& second) { return newPositions[first] < newPositions[second]; });
+                for (uint64_t newPosition = 0; newPosition < order.size(); ++newPosition) {
+                    position[order[newPosition]] = newPosition;
+                }
+
+                uint64_t span = getTotalSpan(position);
+                STORM_LOG_TRACE("Total span of variable interactions after iteration " << iteration << " of FORCE is " << span << ".");
+                if (span < bestSpan) {
+                    bestSpan = span;
+                    bestOrder = order;
+                }
+            }
+
+            return bestOrder;
+        }
+
+        std::vector<storm::expressions::Variable> DdVariableOrdering::importOrder(std::string const& filename) const {
+            std::unordered_map<std::string, uint64_t> nameToIndexMap;
+            for (uint64_t index = 0; index < variables.size(); ++index) {
+                nameToIndexMap.emplace(variables[index].getName(), index);
+            }
+
+            std::vector<storm::expressions::Variable> result;
+            std::vector<bool> ordered(variables.size(), false);
+
+            std::ifstream stream;
+            storm::utility::openFile(filename, stream);
+            std::string line;
+            while (std::getline(stream, line)) {
+                line.erase(0, line.find_first_not_of(" \t\r"));
+                line.erase(line.find_last_not_of(" \t\r") + 1);
+                if (line.empty()) {
+                    continue;
+                }
+                auto indexIt = nameToIndexMap.find(line);
+                if (indexIt == nameToIndexMap.end()) {
+                    STORM_LOG_WARN("Ignoring unknown variable '" << line << "' in variable order.");
+                } else if (!ordered[indexIt->second]) {
+                    ordered[indexIt->second] = true;
+                    result.push_back(variables[indexIt->second]);
+                }
+            }
+            storm::utility::closeFile(stream);
+
+            for (uint64_t index = 0; index < variables.size(); ++index) {
+                if (!ordered[index]) {
+                    STORM_LOG_WARN("Variable '" << variables[index].getName() << "' is missing in the variable order and is placed at the end.");
+                    result.push_back(variables[index]);
+                }
+            }
+            return result;
+        }
+
+        void DdVariableOrdering::exportOrder(std::vector<storm::expressions::Variable> const& order, std::string const& filename) {
+            std::ofstream stream;
+            storm::utility::openFile(filename, stream);
+            for (auto const& variable : order) {
+                stream << variable.getName() << std::endl;
+            }
+            storm::utility::closeFile(stream);
+        }
+
+    }
+}
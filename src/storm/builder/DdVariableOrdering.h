@@ -0,0 +1,117 @@
+#ifndef STORM_BUILDER_DDVARIABLEORDERING_H_
+#define STORM_BUILDER_DDVARIABLEORDERING_H_
+
+#include <ostream>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+    }
+
+    namespace jani {
+        class Model;
+    }
+
+    namespace builder {
+
+        // An enum that contains all currently supported heuristics to order the variables of symbolic models.
+        enum class DdVariableOrderingHeuristic { Declaration, Force };
+
+        std::ostream& operator<<(std::ostream& out, DdVariableOrderingHeuristic const& heuristic);
+
+        /*!
+         * Computes a static order of the variables of a model that is to be built symbolically. The order is derived
+         * from the interactions of the variables, i.e. the sets of variables that are related by one transition (guard,
+         * probabilities and updates) or by the synchronization of transitions. Placing interacting variables close to
+         * each other typically reduces the size of the decision diagrams considerably.
+         */
+        class DdVariableOrdering {
+        public:
+            /*!
+             * Creates an ordering for the given variables (without any interactions).
+             *
+             * @param variables The variables to order in the order in which they were declared.
+             */
+            DdVariableOrdering(std::vector<storm::expressions::Variable> const& variables);
+
+            /*!
+             * Creates an ordering for the variables of the given program whose interactions are derived from the
+             * commands and synchronizing actions of the program.
+             */
+            static DdVariableOrdering create(storm::prism::Program const& program);
+
+            /*!
+             * Creates an ordering for the given variables of the given model whose interactions are derived from the
+             * edges of the automata and the actions of the model.
+             */
+            static DdVariableOrdering create(storm::jani::Model const& model, std::vector<storm::expressions::Variable> const& variables);
+
+            /*!
+             * Adds an interaction among the given variables. Variables that are not to be ordered are ignored.
+             */
+            void addInteraction(std::set<storm::expressions::Variable> const& variables);
+
+            /*!
+             * Computes an order of the variables using the given heuristic.
+             */
+            std::vector<storm::expressions::Variable> computeOrder(DdVariableOrderingHeuristic const& heuristic) const;
+
+            /*!
+             * Computes an order of the variables as specified by the build settings. That is, the order is imported from
+             * a file or computed with the selected heuristic and then exported, if requested.
+             */
+            std::vector<storm::expressions::Variable> computeOrderFromSettings() const;
+
+            /*!
+             * Retrieves the total span of the interactions in the given order, i.e. the sum over the distances of the
+             * first and the last variable of every interaction.
+             */
+            uint64_t getTotalSpan(std::vector<storm::expressions::Variable> const& order) const;
+
+            /*!
+             * Reads an order (given by the names of the variables, one per line) from the given file. Variables that
+             * do not appear in the file are appended in the order of their declaration.
+             */
+            std::vector<storm::expressions::Variable> importOrder(std::string const& filename) const;
+
+            /*!
+             * Writes the given order to the given file, such that it can be imported later.
+             */
+            static void exportOrder(std::vector<storm::expressions::Variable> const& order, std::string const& filename);
+
+            // The number of iterations the FORCE heuristic is allowed to perform.
+            static const uint64_t FORCE_ITERATIONS;
+
+        private:
+            /*!
+             * Computes an order using the FORCE heuristic, which iteratively moves every variable to the average center
+             * of gravity of the interactions it takes part in.
+             */
+            std::vector<uint64_t> computeForceOrder() const;
+
+            /*!
+             * Retrieves the total span of the interactions if the variables (given by their index in the declaration
+             * order) are placed at the given positions.
+             */
+            uint64_t getTotalSpan(std::vector<uint64_t> const& position) const;
+
+            // The variables to order in the order of their declaration.
+            std::vector<storm::expressions::Variable> variables;
+
+            // A mapping from the variables to their index in the declaration order.
+            std::unordered_map<storm::expressions::Variable, uint64_t> variableToIndexMap;
+
+            // The interactions, each given by the (sorted) indices of the interacting variables.
+            std::vector<std::vector<uint64_t>> interactions;
+        };
+
+    }
+}
+
+#endif /* STORM_BUILDER_DDVARIABLEORDERING_H_ */
@@ -3,6 +3,12 @@
 
 #include <queue>
 #include <chrono>
+#include <type_traits>
+
+#include "storm-config.h"
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/tbb.h"
+#endif
 
 #include "storm/solver/Z3SmtSolver.h"
 
@@ -13,6 +19,7 @@
 #include "storm/storage/sparse/PrismChoiceOrigins.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
@@ -83,6 +90,21 @@ namespace storm {
                 std::vector<storm::expressions::Variable> stateOrderVariables;
             };
             
+            struct SubsystemInformation {
+                // A mapping from labels to the choices whose label set contains the label.
+                std::map<uint_fast64_t, std::vector<uint_fast64_t>> labelToChoicesMap;
+                
+                // For each choice, the number of labels of the choice that are not contained in the current label set.
+                std::vector<uint_fast64_t> missingLabelCounts;
+                
+                // The current label set and the choices that are enabled by it.
+                boost::container::flat_set<uint_fast64_t> currentLabelSet;
+                storm::storage::BitVector enabledChoices;
+                
+                // The enabled choices of the most recently checked sub-MDPs together with their reachability probabilities.
+                std::vector<std::pair<storm::storage::BitVector, std::vector<T>>> checkedSubsystems;
+            };
+            
             /*!
              * Computes the set of relevant labels in the model. Relevant labels are choice labels such that there exists
              * a scheduler that satisfies phi until psi with a nonzero probability.
@@ -1355,6 +1377,45 @@ namespace storm {
                 return getUsedLabelSet(*solver.getModel(), variableInformation);
             }
             
+            /*!
+             * Retrieves further sets of labels that satisfy the constraint system of the solver under the current bound.
+             * The label sets are obtained by temporarily ruling out the ones found so far, so the constraint system of
+             * the solver is left unchanged.
+             *
+             * @param solver The solver to use for the satisfiability evaluation.
+             * @param variableInformation A structure with information about the variables of the solver.
+             * @param commandSets The label sets found so far (containing at least the one found by findSmallestCommandSet).
+             * Further label sets are appended to this vector.
+             * @param maximalNumberOfCommandSets The number of label sets that is to be reached.
+             */
+            static void findFurtherCommandSets(storm::solver::SmtSolver& solver, VariableInformation const& variableInformation, std::vector<boost::container::flat_set<uint_fast64_t>>& commandSets, uint_fast64_t maximalNumberOfCommandSets) {
+                if (commandSets.size() >= maximalNumberOfCommandSets) {
+                    return;
+                }
+                
+                storm::expressions::Expression assumption = !variableInformation.auxiliaryVariables.back();
+                solver.push();
+                while (commandSets.size() < maximalNumberOfCommandSets) {
+                    // Rule out the label set that was found last.
+                    std::vector<storm::expressions::Expression> formulae;
+                    for (auto const& labelIndexPair : variableInformation.labelToIndexMap) {
+                        storm::expressions::Variable const& labelVariable = variableInformation.labelVariables.at(labelIndexPair.second);
+                        if (commandSets.back().find(labelIndexPair.first) != commandSets.back().end()) {
+                            formulae.push_back(!labelVariable);
+                        } else {
+                            formulae.push_back(labelVariable.getExpression());
+                        }
+                    }
+                    assertDisjunction(solver, formulae, *variableInformation.manager);
+                    
+                    if (solver.checkWithAssumptions({assumption}) != storm::solver::SmtSolver::CheckResult::Sat) {
+                        break;
+                    }
+                    commandSets.push_back(getUsedLabelSet(*solver.getModel(), variableInformation));
+                }
+                solver.pop();
+            }
+            
             /*!
              * Analyzes the given sub-MDP that has a maximal reachability of zero (i.e. no psi states are reachable) and tries to construct assertions that aim to make at least one psi state reachable.
              *
@@ -1585,36 +1646,97 @@ namespace storm {
 #endif
         
             
+            /*!
+             * Creates the information needed to incrementally determine the choices that are enabled by a label set.
+             * Initially, the label set is empty.
+             */
+            static SubsystemInformation createSubsystemInformation(std::vector<boost::container::flat_set<uint_fast64_t>> const& labelSets) {
+                SubsystemInformation result;
+                result.missingLabelCounts.reserve(labelSets.size());
+                result.enabledChoices = storm::storage::BitVector(labelSets.size());
+                for (uint_fast64_t choice = 0; choice < labelSets.size(); ++choice) {
+                    for (auto const& label : labelSets[choice]) {
+                        result.labelToChoicesMap[label].push_back(choice);
+                    }
+                    result.missingLabelCounts.push_back(labelSets[choice].size());
+                    if (labelSets[choice].empty()) {
+                        result.enabledChoices.set(choice);
+                    }
+                }
+                return result;
+            }
+            
+            /*!
+             * Updates the enabled choices of the given subsystem information to the given label set. Only the choices
+             * containing a label that was added or removed with respect to the previous label set are touched.
+             */
+            static void updateEnabledChoices(SubsystemInformation& subsystemInformation, boost::container::flat_set<uint_fast64_t> const& labelSet) {
+                for (auto const& label : subsystemInformation.currentLabelSet) {
+                    if (labelSet.find(label) == labelSet.end()) {
+                        for (auto const& choice : subsystemInformation.labelToChoicesMap[label]) {
+                            if (subsystemInformation.missingLabelCounts[choice]++ == 0) {
+                                subsystemInformation.enabledChoices.set(choice, false);
+                            }
+                        }
+                    }
+                }
+                for (auto const& label : labelSet) {
+                    if (subsystemInformation.currentLabelSet.find(label) == subsystemInformation.currentLabelSet.end()) {
+                        auto labelChoicesIt = subsystemInformation.labelToChoicesMap.find(label);
+                        if (labelChoicesIt != subsystemInformation.labelToChoicesMap.end()) {
+                            for (auto const& choice : labelChoicesIt->second) {
+                                if (--subsystemInformation.missingLabelCounts[choice] == 0) {
+                                    subsystemInformation.enabledChoices.set(choice, true);
+                                }
+                            }
+                        }
+                    }
+                }
+                subsystemInformation.currentLabelSet = labelSet;
+            }
+            
             /*!
              * Returns the submdp obtained from removing all choices that do not originate from the specified filterLabelSet.
              * Also returns the Labelsets of the submdp
              */
             static std::pair<storm::models::sparse::Mdp<T>, std::vector<boost::container::flat_set<uint_fast64_t>>> restrictMdpToLabelSet(storm::models::sparse::Mdp<T> const& mdp,  std::vector<boost::container::flat_set<uint_fast64_t>> const& labelSets, boost::container::flat_set<uint_fast64_t> const& filterLabelSet) {
+                STORM_LOG_THROW(mdp.getNumberOfChoices() == labelSets.size(), storm::exceptions::InvalidArgumentException, "The given number of labels does not match the number of choices.");
+
+                // Check for each choice, whether the choice commands are fully contained in the given command set.
+                storm::storage::BitVector enabledChoices(labelSets.size());
+                for (uint_fast64_t choice = 0; choice < labelSets.size(); ++choice) {
+                    if (std::includes(filterLabelSet.begin(), filterLabelSet.end(), labelSets[choice].begin(), labelSets[choice].end())) {
+                        enabledChoices.set(choice);
+                    }
+                }
+                return restrictMdpToChoices(mdp, labelSets, enabledChoices);
+            }
+            
+            /*!
+             * Returns the submdp obtained from removing all choices that are not enabled. States without an enabled choice
+             * get a self-loop instead. Also returns the Labelsets of the submdp
+             */
+            static std::pair<storm::models::sparse::Mdp<T>, std::vector<boost::container::flat_set<uint_fast64_t>>> restrictMdpToChoices(storm::models::sparse::Mdp<T> const& mdp,  std::vector<boost::container::flat_set<uint_fast64_t>> const& labelSets, storm::storage::BitVector const& enabledChoices) {
 
                 STORM_LOG_THROW(mdp.getNumberOfChoices() == labelSets.size(), storm::exceptions::InvalidArgumentException, "The given number of labels does not match the number of choices.");
 
                 std::vector<boost::container::flat_set<uint_fast64_t>> resultLabelSet;
                 storm::storage::SparseMatrixBuilder<T> transitionMatrixBuilder(0, mdp.getTransitionMatrix().getColumnCount(), 0, true, true, mdp.getTransitionMatrix().getRowGroupCount());
 
-                // Check for each choice of each state, whether the choice commands are fully contained in the given command set.
                 uint_fast64_t currentRow = 0;
                 for(uint_fast64_t state = 0; state < mdp.getNumberOfStates(); ++state) {
                     bool stateHasValidChoice = false;
-                    for (uint_fast64_t choice = mdp.getTransitionMatrix().getRowGroupIndices()[state]; choice < mdp.getTransitionMatrix().getRowGroupIndices()[state + 1]; ++choice) {
-                        bool choiceValid = std::includes(filterLabelSet.begin(), filterLabelSet.end(), labelSets[choice].begin(), labelSets[choice].end());
-
+                    for (uint_fast64_t choice = enabledChoices.getNextSetIndex(mdp.getTransitionMatrix().getRowGroupIndices()[state]); choice < mdp.getTransitionMatrix().getRowGroupIndices()[state + 1]; choice = enabledChoices.getNextSetIndex(choice + 1)) {
                         // If the choice is valid, copy over all its elements.
-                        if (choiceValid) {
-                            if (!stateHasValidChoice) {
-                                transitionMatrixBuilder.newRowGroup(currentRow);
-                            }
-                            stateHasValidChoice = true;
-                            for (auto const& entry : mdp.getTransitionMatrix().getRow(choice)) {
-                                transitionMatrixBuilder.addNextValue(currentRow, entry.getColumn(), entry.getValue());
-                            }
-                            resultLabelSet.push_back(labelSets[choice]);
-                            ++currentRow;
+                        if (!stateHasValidChoice) {
+                            transitionMatrixBuilder.newRowGroup(currentRow);
                         }
+                        stateHasValidChoice = true;
+                        for (auto const& entry : mdp.getTransitionMatrix().getRow(choice)) {
+                            transitionMatrixBuilder.addNextValue(currentRow, entry.getColumn(), entry.getValue());
+                        }
+                        resultLabelSet.push_back(labelSets[choice]);
+                        ++currentRow;
                     }
 
                     // If no choice of the current state may be taken, we insert a self-loop to the state instead.
@@ -1631,6 +1753,53 @@ namespace storm {
                 
                 return std::make_pair(std::move(resultMdp), std::move(resultLabelSet));
             }
+            
+            /*!
+             * Computes the maximal probabilities of satisfying phi until psi in the given sub-MDP. If a sub-MDP with the
+             * same enabled choices was checked before, its result is reused. Otherwise, the result of a previously checked
+             * sub-MDP whose enabled choices are a subset of the given ones is used as a starting point for the solver.
+             * As this sub-MDP has fewer choices, its values are lower bounds for the values to compute.
+             *
+             * @param subMdp The sub-MDP to check.
+             * @param enabledChoices The choices of the original MDP that are enabled in the sub-MDP.
+             * @param checkedSubsystems The previously checked sub-MDPs.
+             * @param phiStates A bit vector characterizing all phi states in the model.
+             * @param psiStates A bit vector characterizing all psi states in the model.
+             */
+            static std::vector<T> computeSubsystemUntilProbabilities(storm::models::sparse::Mdp<T> const& subMdp, storm::storage::BitVector const& enabledChoices, std::vector<std::pair<storm::storage::BitVector, std::vector<T>>> const& checkedSubsystems, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                std::pair<storm::storage::BitVector, std::vector<T>> const* bestCheckedSubsystem = nullptr;
+                for (auto const& checkedSubsystem : checkedSubsystems) {
+                    if (checkedSubsystem.first == enabledChoices) {
+                        STORM_LOG_DEBUG("Reusing the result of a previously checked sub-MDP.");
+                        return checkedSubsystem.second;
+                    }
+                    if (checkedSubsystem.first.isSubsetOf(enabledChoices) && (bestCheckedSubsystem == nullptr || checkedSubsystem.first.getNumberOfSetBits() > bestCheckedSubsystem->first.getNumberOfSetBits())) {
+                        bestCheckedSubsystem = &checkedSubsystem;
+                    }
+                }
+                
+                storm::modelchecker::ExplicitModelCheckerHint<T> hint;
+                if (bestCheckedSubsystem != nullptr) {
+                    hint.setResultHint(bestCheckedSubsystem->second);
+                }
+                
+                storm::modelchecker::helper::SparseMdpPrctlHelper<T> modelCheckerHelper;
+                STORM_LOG_DEBUG("Invoking model checker.");
+                return std::move(modelCheckerHelper.computeUntilProbabilities(false, subMdp.getTransitionMatrix(), subMdp.getBackwardTransitions(), phiStates, psiStates, false, false, storm::solver::GeneralMinMaxLinearEquationSolverFactory<T>(), hint).values);
+            }
+            
+            /*!
+             * Retrieves the number of label sets that are obtained from the solver and checked in one iteration.
+             */
+            static uint_fast64_t getNumberOfCommandSetsPerIteration() {
+#ifdef STORM_HAVE_INTELTBB
+                // Parallel checking is restricted to doubles as the exact number types are not thread-safe
+                if (std::is_same<T, double>::value && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                    return std::max<uint_fast64_t>(1, tbb::task_scheduler_init::default_num_threads());
+                }
+#endif
+                return 1;
+            }
 
         public:
          
@@ -1734,50 +1903,89 @@ namespace storm {
                 uint_fast64_t currentBound = 0;
                 maximalReachabilityProbability = 0;
                 uint_fast64_t zeroProbabilityCount = 0;
+                
+                // Consecutive label sets typically differ only slightly, so we keep track of the enabled choices
+                // incrementally and reuse the results of the sub-MDPs checked in the previous iteration. If possible,
+                // several label sets are obtained from the solver and checked in parallel.
+                SubsystemInformation subsystemInformation = createSubsystemInformation(labelSets);
+                uint_fast64_t numberOfCommandSetsPerIteration = getNumberOfCommandSetsPerIteration();
                 do {
                     STORM_LOG_DEBUG("Computing minimal command set.");
                     solverClock = std::chrono::high_resolution_clock::now();
-                    commandSet = findSmallestCommandSet(*solver, variableInformation, currentBound);
+                    std::vector<boost::container::flat_set<uint_fast64_t>> commandSets;
+                    commandSets.push_back(findSmallestCommandSet(*solver, variableInformation, currentBound));
+                    findFurtherCommandSets(*solver, variableInformation, commandSets, numberOfCommandSetsPerIteration);
                     totalSolverTime += std::chrono::high_resolution_clock::now() - solverClock;
-                    STORM_LOG_DEBUG("Computed minimal command set of size " << (commandSet.size() + relevancyInformation.knownLabels.size()) << ".");
+                    STORM_LOG_DEBUG("Computed " << commandSets.size() << " minimal command set(s) of size " << (commandSets.front().size() + relevancyInformation.knownLabels.size()) << ".");
                     
-                    // Restrict the given MDP to the current set of labels and compute the reachability probability.
+                    // Restrict the given MDP to the current sets of labels and compute the reachability probabilities.
                     modelCheckingClock = std::chrono::high_resolution_clock::now();
-                    commandSet.insert(relevancyInformation.knownLabels.begin(), relevancyInformation.knownLabels.end());
-                    auto subMdpChoiceOrigins = restrictMdpToLabelSet(mdp, labelSets, commandSet);
-                    storm::models::sparse::Mdp<T> const& subMdp = subMdpChoiceOrigins.first;
-                    std::vector<boost::container::flat_set<uint_fast64_t>> const& subLabelSets = subMdpChoiceOrigins.second;
-  
-                    storm::modelchecker::helper::SparseMdpPrctlHelper<T> modelCheckerHelper;
-                    STORM_LOG_DEBUG("Invoking model checker.");
-                    std::vector<T> result = std::move(modelCheckerHelper.computeUntilProbabilities(false, subMdp.getTransitionMatrix(), subMdp.getBackwardTransitions(), phiStates, psiStates, false, false, storm::solver::GeneralMinMaxLinearEquationSolverFactory<T>()).values);
+                    std::vector<storm::storage::BitVector> enabledChoices;
+                    std::vector<std::pair<storm::models::sparse::Mdp<T>, std::vector<boost::container::flat_set<uint_fast64_t>>>> subMdpChoiceOrigins;
+                    for (auto& candidateCommandSet : commandSets) {
+                        candidateCommandSet.insert(relevancyInformation.knownLabels.begin(), relevancyInformation.knownLabels.end());
+                        updateEnabledChoices(subsystemInformation, candidateCommandSet);
+                        enabledChoices.push_back(subsystemInformation.enabledChoices);
+                        subMdpChoiceOrigins.push_back(restrictMdpToChoices(mdp, labelSets, enabledChoices.back()));
+                    }
+                    
+                    std::vector<std::vector<T>> results(commandSets.size());
+#ifdef STORM_HAVE_INTELTBB
+                    if (commandSets.size() > 1) {
+                        tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, commandSets.size(), 1), [&] (tbb::blocked_range<uint_fast64_t> const& range) {
+                            for (uint_fast64_t i = range.begin(); i < range.end(); ++i) {
+                                results[i] = computeSubsystemUntilProbabilities(subMdpChoiceOrigins[i].first, enabledChoices[i], subsystemInformation.checkedSubsystems, phiStates, psiStates);
+                            }
+                        });
+                    } else {
+                        results.front() = computeSubsystemUntilProbabilities(subMdpChoiceOrigins.front().first, enabledChoices.front(), subsystemInformation.checkedSubsystems, phiStates, psiStates);
+                    }
+#else
+                    for (uint_fast64_t i = 0; i < commandSets.size(); ++i) {
+                        results[i] = computeSubsystemUntilProbabilities(subMdpChoiceOrigins[i].first, enabledChoices[i], subsystemInformation.checkedSubsystems, phiStates, psiStates);
+                    }
+#endif
                     STORM_LOG_DEBUG("Computed model checking results.");
                     totalModelCheckingTime += std::chrono::high_resolution_clock::now() - modelCheckingClock;
-
-                    // Now determine the maximal reachability probability by checking all initial states.
-                    maximalReachabilityProbability = 0;
-                    for (auto state : mdp.getInitialStates()) {
-                        maximalReachabilityProbability = std::max(maximalReachabilityProbability, result[state]);
-                    }
                     
-                    // Depending on whether the threshold was successfully achieved or not, we proceed by either analyzing the bad solution or stopping the iteration process.
                     analysisClock = std::chrono::high_resolution_clock::now();
-                    if ((strictBound && maximalReachabilityProbability < probabilityThreshold) || (!strictBound && maximalReachabilityProbability <= probabilityThreshold)) {
-                        if (maximalReachabilityProbability == 0) {
-                            ++zeroProbabilityCount;
-                            
-                            // If there was no target state reachable, analyze the solution and guide the solver into the right direction.
-                            analyzeZeroProbabilitySolution(*solver, subMdp, subLabelSets, mdp, labelSets, phiStates, psiStates, commandSet, variableInformation, relevancyInformation);
+                    for (uint_fast64_t i = 0; i < commandSets.size(); ++i) {
+                        commandSet = commandSets[i];
+                        storm::models::sparse::Mdp<T> const& subMdp = subMdpChoiceOrigins[i].first;
+                        std::vector<boost::container::flat_set<uint_fast64_t>> const& subLabelSets = subMdpChoiceOrigins[i].second;
+                        ++iterations;
+                        
+                        // Now determine the maximal reachability probability by checking all initial states.
+                        maximalReachabilityProbability = 0;
+                        for (auto state : mdp.getInitialStates()) {
+                            maximalReachabilityProbability = std::max(maximalReachabilityProbability, results[i][state]);
+                        }
+                        
+                        // Depending on whether the threshold was successfully achieved or not, we proceed by either analyzing the bad solution or stopping the iteration process.
+                        // As all label sets of one iteration have the same (minimal) size, we can stop as soon as one of them suffices.
+                        if ((strictBound && maximalReachabilityProbability < probabilityThreshold) || (!strictBound && maximalReachabilityProbability <= probabilityThreshold)) {
+                            if (maximalReachabilityProbability == 0) {
+                                ++zeroProbabilityCount;
+                                
+                                // If there was no target state reachable, analyze the solution and guide the solver into the right direction.
+                                analyzeZeroProbabilitySolution(*solver, subMdp, subLabelSets, mdp, labelSets, phiStates, psiStates, commandSet, variableInformation, relevancyInformation);
+                            } else {
+                                // If the reachability probability was greater than zero (i.e. there is a reachable target state), but the probability was insufficient to exceed
+                                // the given threshold, we analyze the solution and try to guide the solver into the right direction.
+                                analyzeInsufficientProbabilitySolution(*solver, subMdp, subLabelSets, mdp, labelSets, phiStates, psiStates, commandSet, variableInformation, relevancyInformation);
+                            }
                         } else {
-                            // If the reachability probability was greater than zero (i.e. there is a reachable target state), but the probability was insufficient to exceed
-                            // the given threshold, we analyze the solution and try to guide the solver into the right direction.
-                            analyzeInsufficientProbabilitySolution(*solver, subMdp, subLabelSets, mdp, labelSets, phiStates, psiStates, commandSet, variableInformation, relevancyInformation);
+                            done = true;
+                            break;
                         }
-                    } else {
-                        done = true;
                     }
                     totalAnalysisTime += (std::chrono::high_resolution_clock::now() - analysisClock);
-                    ++iterations;
+                    
+                    // Remember the checked sub-MDPs so their results can be reused in the next iteration.
+                    subsystemInformation.checkedSubsystems.clear();
+                    for (uint_fast64_t i = 0; i < commandSets.size(); ++i) {
+                        subsystemInformation.checkedSubsystems.emplace_back(std::move(enabledChoices[i]), std::move(results[i]));
+                    }
                     
                     if (std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - localClock).count() >= 5) {
                         std::cout << "Checked " << iterations << " models in " << std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - totalClock).count() << "s (out of which " << zeroProbabilityCount << " could not reach the target states). Current command set size is " << commandSet.size() << "." << std::endl;
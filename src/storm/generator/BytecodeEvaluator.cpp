@@ -0,0 +1,295 @@
+#include "storm/generator/BytecodeEvaluator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+#include "storm/generator/VariableInformation.h"
+
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace generator {
+
+        /*!
+         * Translates expressions to the instructions of a single program. Subexpressions that occur several times
+         * (i.e. that are shared among the expressions of the program), variables and constants are only translated once.
+         */
+        class BytecodeEvaluator::Compiler : public storm::expressions::ExpressionVisitor {
+        public:
+            Compiler(BytecodeEvaluator& evaluator) : evaluator(evaluator) {
+                // Intentionally left empty.
+            }
+
+            /*!
+             * Compiles the given expression and returns the register that will hold its value.
+             */
+            uint64_t compile(storm::expressions::BaseExpression const& expression) {
+                auto registerIt = subexpressionRegisters.find(&expression);
+                if (registerIt != subexpressionRegisters.end()) {
+                    return registerIt->second;
+                }
+                uint64_t resultRegister = boost::any_cast<uint64_t>(expression.accept(*this, boost::none));
+                subexpressionRegisters.emplace(&expression, resultRegister);
+                return resultRegister;
+            }
+
+            virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const&) override {
+                uint64_t condition = compile(*expression.getCondition());
+                uint64_t thenValue = compile(*expression.getThenExpression());
+                uint64_t elseValue = compile(*expression.getElseExpression());
+                return addInstruction(OpCode::IfThenElse, condition, thenValue, elseValue);
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const&) override {
+                uint64_t first = compile(*expression.getFirstOperand());
+                uint64_t second = compile(*expression.getSecondOperand());
+                uint64_t resultRegister = 0;
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And: resultRegister = addInstruction(OpCode::And, first, second); break;
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Or: resultRegister = addInstruction(OpCode::Or, first, second); break;
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Xor: resultRegister = addInstruction(OpCode::Xor, first, second); break;
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Implies: resultRegister = addInstruction(OpCode::Implies, first, second); break;
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Iff: resultRegister = addInstruction(OpCode::Iff, first, second); break;
+                }
+                return resultRegister;
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const&) override {
+                uint64_t first = compile(*expression.getFirstOperand());
+                uint64_t second = compile(*expression.getSecondOperand());
+                uint64_t resultRegister = 0;
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Plus: resultRegister = addInstruction(OpCode::Plus, first, second); break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Minus: resultRegister = addInstruction(OpCode::Minus, first, second); break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Times: resultRegister = addInstruction(OpCode::Times, first, second); break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Divide: resultRegister = addInstruction(OpCode::Divide, first, second); break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Min: resultRegister = addInstruction(OpCode::Min, first, second); break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Max: resultRegister = addInstruction(OpCode::Max, first, second); break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Power: resultRegister = addInstruction(OpCode::Power, first, second); break;
+                }
+                return resultRegister;
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const&) override {
+                uint64_t first = compile(*expression.getFirstOperand());
+                uint64_t second = compile(*expression.getSecondOperand());
+                uint64_t resultRegister = 0;
+                switch (expression.getRelationType()) {
+                    case storm::expressions::BinaryRelationExpression::RelationType::Equal: resultRegister = addInstruction(OpCode::Equal, first, second); break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::NotEqual: resultRegister = addInstruction(OpCode::NotEqual, first, second); break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::Less: resultRegister = addInstruction(OpCode::Less, first, second); break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::LessOrEqual: resultRegister = addInstruction(OpCode::LessOrEqual, first, second); break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::Greater: resultRegister = addInstruction(OpCode::Greater, first, second); break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::GreaterOrEqual: resultRegister = addInstruction(OpCode::GreaterOrEqual, first, second); break;
+                }
+                return resultRegister;
+            }
+
+            virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const&) override {
+                storm::expressions::Variable const& variable = expression.getVariable();
+                auto registerIt = variableRegisters.find(variable);
+                if (registerIt != variableRegisters.end()) {
+                    return registerIt->second;
+                }
+
+                auto locationIt = evaluator.variableLocations.find(variable);
+                STORM_LOG_THROW(locationIt != evaluator.variableLocations.end(), storm::exceptions::InvalidArgumentException, "Cannot compile expression " << expression << " as the variable '" << variable.getName() << "' is not stored in the state.");
+                VariableLocation const& location = locationIt->second;
+
+                uint64_t resultRegister;
+                if (location.isBoolean) {
+                    resultRegister = addInstruction(OpCode::LoadBoolean, location.bitOffset);
+                } else if (location.bitWidth == 0) {
+                    // Variables without bits in the state can only take one value.
+                    resultRegister = getConstantRegister(static_cast<double>(location.lowerBound));
+                } else {
+                    resultRegister = addInstruction(OpCode::LoadInteger, location.bitOffset, location.bitWidth, static_cast<uint64_t>(location.lowerBound));
+                }
+                variableRegisters.emplace(variable, resultRegister);
+                return resultRegister;
+            }
+
+            virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const&) override {
+                uint64_t operand = compile(*expression.getOperand());
+                uint64_t resultRegister = 0;
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::UnaryBooleanFunctionExpression::OperatorType::Not: resultRegister = addInstruction(OpCode::Not, operand); break;
+                }
+                return resultRegister;
+            }
+
+            virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const&) override {
+                uint64_t operand = compile(*expression.getOperand());
+                uint64_t resultRegister = 0;
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Minus: resultRegister = addInstruction(OpCode::Negate, operand); break;
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Floor: resultRegister = addInstruction(OpCode::Floor, operand); break;
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Ceil: resultRegister = addInstruction(OpCode::Ceil, operand); break;
+                }
+                return resultRegister;
+            }
+
+            virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) override {
+                return getConstantRegister(expression.getValue() ? 1.0 : 0.0);
+            }
+
+            virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) override {
+                return getConstantRegister(static_cast<double>(expression.getValue()));
+            }
+
+            virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const&) override {
+                return getConstantRegister(expression.getValueAsDouble());
+            }
+
+        private:
+            uint64_t addRegister() {
+                evaluator.registers.push_back(0.0);
+                return evaluator.registers.size() - 1;
+            }
+
+            uint64_t addInstruction(OpCode opCode, uint64_t first, uint64_t second = 0, uint64_t third = 0) {
+                uint64_t target = addRegister();
+                evaluator.instructions.push_back(Instruction({opCode, target, first, second, third}));
+                return target;
+            }
+
+            uint64_t getConstantRegister(double value) {
+                auto registerIt = constantRegisters.find(value);
+                if (registerIt != constantRegisters.end()) {
+                    return registerIt->second;
+                }
+                uint64_t resultRegister = addRegister();
+                evaluator.registers[resultRegister] = value;
+                constantRegisters.emplace(value, resultRegister);
+                return resultRegister;
+            }
+
+            // The evaluator whose program is built.
+            BytecodeEvaluator& evaluator;
+
+            // The registers holding the values of the subexpressions, variables and constants compiled so far.
+            std::unordered_map<storm::expressions::BaseExpression const*, uint64_t> subexpressionRegisters;
+            std::unordered_map<storm::expressions::Variable, uint64_t> variableRegisters;
+            std::map<double, uint64_t> constantRegisters;
+        };
+
+        BytecodeEvaluator::BytecodeEvaluator(VariableInformation const& variableInformation) : state(nullptr), loadCounter(0) {
+            for (auto const& locationVariable : variableInformation.locationVariables) {
+                variableLocations.emplace(locationVariable.variable, VariableLocation({false, locationVariable.bitOffset, locationVariable.bitWidth, 0}));
+            }
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                variableLocations.emplace(booleanVariable.variable, VariableLocation({true, booleanVariable.bitOffset, 1, 0}));
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                variableLocations.emplace(integerVariable.variable, VariableLocation({false, integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound}));
+            }
+        }
+
+        bool BytecodeEvaluator::canCompile(storm::expressions::Expression const& expression) const {
+            for (auto const& variable : expression.getVariables()) {
+                if (variableLocations.find(variable) == variableLocations.end()) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void BytecodeEvaluator::addProgram(std::vector<storm::expressions::Expression> const& expressions) {
+            uint64_t programIndex = programs.size();
+            Program program;
+            program.firstInstruction = instructions.size();
+            program.executedForLoad = 0;
+
+            Compiler compiler(*this);
+            for (auto const& expression : expressions) {
+                if (!expression.isInitialized() || isCompiled(expression) || !canCompile(expression)) {
+                    continue;
+                }
+                uint64_t resultRegister = compiler.compile(expression.getBaseExpression());
+                expressionToProgramAndRegister.emplace(&expression.getBaseExpression(), std::make_pair(programIndex, resultRegister));
+                compiledExpressions.push_back(expression);
+            }
+
+            program.endInstruction = instructions.size();
+            programs.push_back(program);
+        }
+
+        bool BytecodeEvaluator::isCompiled(storm::expressions::Expression const& expression) const {
+            return expressionToProgramAndRegister.find(&expression.getBaseExpression()) != expressionToProgramAndRegister.end();
+        }
+
+        void BytecodeEvaluator::load(CompressedState const& state) {
+            this->state = &state;
+            ++loadCounter;
+        }
+
+        bool BytecodeEvaluator::asBool(storm::expressions::Expression const& expression) const {
+            return getValue(expression) == 1.0;
+        }
+
+        int_fast64_t BytecodeEvaluator::asInt(storm::expressions::Expression const& expression) const {
+            return static_cast<int_fast64_t>(getValue(expression));
+        }
+
+        double BytecodeEvaluator::asRational(storm::expressions::Expression const& expression) const {
+            return getValue(expression);
+        }
+
+        double BytecodeEvaluator::getValue(storm::expressions::Expression const& expression) const {
+            STORM_LOG_ASSERT(state != nullptr, "Cannot evaluate expression without a loaded state.");
+            auto programAndRegisterIt = expressionToProgramAndRegister.find(&expression.getBaseExpression());
+            STORM_LOG_ASSERT(programAndRegisterIt != expressionToProgramAndRegister.end(), "The expression " << expression << " was not compiled.");
+
+            Program& program = programs[programAndRegisterIt->second.first];
+            if (program.executedForLoad != loadCounter) {
+                execute(program);
+                program.executedForLoad = loadCounter;
+            }
+            return registers[programAndRegisterIt->second.second];
+        }
+
+        void BytecodeEvaluator::execute(Program const& program) const {
+            CompressedState const& state = *this->state;
+            double* values = registers.data();
+
+            auto instructionIte = instructions.begin() + program.endInstruction;
+            for (auto instructionIt = instructions.begin() + program.firstInstruction; instructionIt != instructionIte; ++instructionIt) {
+                Instruction const& instruction = *instructionIt;
+                double& target = values[instruction.target];
+                switch (instruction.opCode) {
+                    case OpCode::LoadBoolean: target = state.get(instruction.first) ? 1.0 : 0.0; break;
+                    case OpCode::LoadInteger: target = static_cast<double>(static_cast<int_fast64_t>(state.getAsInt(instruction.first, instruction.second)) + static_cast<int_fast64_t>(instruction.third)); break;
+                    case OpCode::Not: target = values[instruction.first] == 0.0 ? 1.0 : 0.0; break;
+                    case OpCode::And: target = (values[instruction.first] != 0.0 && values[instruction.second] != 0.0) ? 1.0 : 0.0; break;
+                    case OpCode::Or: target = (values[instruction.first] != 0.0 || values[instruction.second] != 0.0) ? 1.0 : 0.0; break;
+                    case OpCode::Xor: target = ((values[instruction.first] != 0.0) != (values[instruction.second] != 0.0)) ? 1.0 : 0.0; break;
+                    case OpCode::Implies: target = (values[instruction.first] == 0.0 || values[instruction.second] != 0.0) ? 1.0 : 0.0; break;
+                    case OpCode::Iff: target = ((values[instruction.first] != 0.0) == (values[instruction.second] != 0.0)) ? 1.0 : 0.0; break;
+                    case OpCode::Negate: target = -values[instruction.first]; break;
+                    case OpCode::Floor: target = std::floor(values[instruction.first]); break;
+                    case OpCode::Ceil: target = std::ceil(values[instruction.first]); break;
+                    case OpCode::Plus: target = values[instruction.first] + values[instruction.second]; break;
+                    case OpCode::Minus: target = values[instruction.first] - values[instruction.second]; break;
+                    case OpCode::Times: target = values[instruction.first] * values[instruction.second]; break;
+                    case OpCode::Divide: target = values[instruction.first] / values[instruction.second]; break;
+                    case OpCode::Min: target = std::min(values[instruction.first], values[instruction.second]); break;
+                    case OpCode::Max: target = std::max(values[instruction.first], values[instruction.second]); break;
+                    case OpCode::Power: target = std::pow(values[instruction.first], values[instruction.second]); break;
+                    case OpCode::Equal: target = values[instruction.first] == values[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::NotEqual: target = values[instruction.first] != values[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::Less: target = values[instruction.first] < values[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::LessOrEqual: target = values[instruction.first] <= values[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::Greater: target = values[instruction.first] > values[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::GreaterOrEqual: target = values[instruction.first] >= values[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::IfThenElse: target = values[instruction.first] != 0.0 ? values[instruction.second] : values[instruction.third]; break;
+                }
+            }
+        }
+
+    }
+}
@@ -0,0 +1,148 @@
+#ifndef STORM_GENERATOR_BYTECODEEVALUATOR_H_
+#define STORM_GENERATOR_BYTECODEEVALUATOR_H_
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/Variable.h"
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+    namespace expressions {
+        class BaseExpression;
+    }
+
+    namespace generator {
+        struct VariableInformation;
+
+        /*!
+         * An evaluator for expressions over the variables of compressed states. Expressions are compiled to a compact
+         * register-based bytecode, whose load instructions read the values of the variables directly from the bits of
+         * the compressed state. Consequently, there is no need to unpack a state before evaluating expressions in it.
+         *
+         * Expressions are compiled in programs. All expressions of a program are evaluated in one pass over the
+         * instructions of the program (in which common subexpressions and loads of the same variable are only
+         * performed once) as soon as the value of one of them is requested for the currently loaded state. All values
+         * are computed as doubles, which matches the semantics of the exprtk-based evaluator.
+         */
+        class BytecodeEvaluator {
+        public:
+            /*!
+             * Creates an evaluator for expressions over the variables described by the given variable information.
+             *
+             * @param variableInformation The information about how the variables are packed within the states.
+             */
+            BytecodeEvaluator(VariableInformation const& variableInformation);
+
+            /*!
+             * Checks whether the given expression can be compiled, i.e. whether it only refers to variables that are
+             * stored in the compressed states.
+             */
+            bool canCompile(storm::expressions::Expression const& expression) const;
+
+            /*!
+             * Compiles the given expressions into a single program. Expressions that cannot be compiled are skipped.
+             *
+             * @param expressions The expressions to compile.
+             */
+            void addProgram(std::vector<storm::expressions::Expression> const& expressions);
+
+            /*!
+             * Checks whether the given expression was compiled as part of some program.
+             */
+            bool isCompiled(storm::expressions::Expression const& expression) const;
+
+            /*!
+             * Loads the given state. Subsequent evaluations refer to this state, which therefore must not be destroyed
+             * before the next state is loaded.
+             */
+            void load(CompressedState const& state);
+
+            /*!
+             * Evaluates the given (compiled) expression in the currently loaded state.
+             */
+            bool asBool(storm::expressions::Expression const& expression) const;
+            int_fast64_t asInt(storm::expressions::Expression const& expression) const;
+            double asRational(storm::expressions::Expression const& expression) const;
+
+        private:
+            class Compiler;
+
+            enum class OpCode : uint8_t {
+                LoadBoolean, LoadInteger,
+                Not, And, Or, Xor, Implies, Iff,
+                Negate, Floor, Ceil, Plus, Minus, Times, Divide, Min, Max, Power,
+                Equal, NotEqual, Less, LessOrEqual, Greater, GreaterOrEqual,
+                IfThenElse
+            };
+
+            // An instruction writes its result to the target register. Apart from the load instructions, the operands
+            // are register indices. Loads of booleans use the first operand as the bit offset and loads of integers use
+            // the first and second operand as the bit offset and width and the third one as the lower bound.
+            struct Instruction {
+                OpCode opCode;
+                uint64_t target;
+                uint64_t first;
+                uint64_t second;
+                uint64_t third;
+            };
+
+            struct Program {
+                // The instructions of the program are [firstInstruction, endInstruction).
+                uint64_t firstInstruction;
+                uint64_t endInstruction;
+
+                // The load counter of the state for which the program was last executed.
+                uint64_t executedForLoad;
+            };
+
+            struct VariableLocation {
+                bool isBoolean;
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                int_fast64_t lowerBound;
+            };
+
+            /*!
+             * Retrieves the value of the given expression in the currently loaded state (executing the program of the
+             * expression if necessary).
+             */
+            double getValue(storm::expressions::Expression const& expression) const;
+
+            /*!
+             * Executes the given program on the currently loaded state.
+             */
+            void execute(Program const& program) const;
+
+            // The locations of the variables within the compressed states.
+            std::unordered_map<storm::expressions::Variable, VariableLocation> variableLocations;
+
+            // The instructions of all programs.
+            std::vector<Instruction> instructions;
+
+            // The compiled programs.
+            mutable std::vector<Program> programs;
+
+            // The registers of all programs. Registers holding constants are initialized upon compilation.
+            mutable std::vector<double> registers;
+
+            // For each compiled expression, the index of its program and the register holding its value.
+            std::unordered_map<storm::expressions::BaseExpression const*, std::pair<uint64_t, uint64_t>> expressionToProgramAndRegister;
+
+            // The compiled expressions. They are kept to guarantee that their addresses remain valid.
+            std::vector<storm::expressions::Expression> compiledExpressions;
+
+            // The currently loaded state.
+            CompressedState const* state;
+
+            // A counter that is increased upon loading a state.
+            uint64_t loadCounter;
+        };
+
+    }
+}
+
+#endif /* STORM_GENERATOR_BYTECODEEVALUATOR_H_ */
@@ -0,0 +1,183 @@
+#include "storm/generator/GuardIndex.h"
+
+#include <map>
+#include <set>
+
+#include "storm/generator/VariableInformation.h"
+
+#include "storm/storage/expressions/BaseExpression.h"
+#include "storm/storage/expressions/OperatorType.h"
+#include "storm/storage/expressions/VariableExpression.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+        namespace detail {
+            /*!
+             * Tries to interpret the given expression as a restriction of a single variable to a set of values (where
+             * the values of boolean variables are represented by zero and one).
+             *
+             * @return True iff the expression could be interpreted as such a restriction.
+             */
+            bool getRestriction(storm::expressions::Expression const& expression, storm::expressions::Variable& variable, std::set<int_fast64_t>& values) {
+                if (expression.isVariable()) {
+                    if (!expression.hasBooleanType()) {
+                        return false;
+                    }
+                    variable = expression.getBaseExpression().asVariableExpression().getVariable();
+                    values = {1};
+                    return true;
+                }
+                if (!expression.isFunctionApplication()) {
+                    return false;
+                }
+
+                storm::expressions::OperatorType op = expression.getOperator();
+                if (op == storm::expressions::OperatorType::Not) {
+                    storm::expressions::Expression operand = expression.getOperand(0);
+                    if (!operand.isVariable() || !operand.hasBooleanType()) {
+                        return false;
+                    }
+                    variable = operand.getBaseExpression().asVariableExpression().getVariable();
+                    values = {0};
+                    return true;
+                } else if (op == storm::expressions::OperatorType::Equal) {
+                    storm::expressions::Expression variableOperand = expression.getOperand(0);
+                    storm::expressions::Expression valueOperand = expression.getOperand(1);
+                    if (!variableOperand.isVariable()) {
+                        std::swap(variableOperand, valueOperand);
+                    }
+                    if (!variableOperand.isVariable() || !variableOperand.hasIntegerType() || !valueOperand.hasIntegerType() || valueOperand.containsVariables()) {
+                        return false;
+                    }
+                    variable = variableOperand.getBaseExpression().asVariableExpression().getVariable();
+                    values = {valueOperand.evaluateAsInt()};
+                    return true;
+                } else if (op == storm::expressions::OperatorType::Or) {
+                    storm::expressions::Variable secondVariable;
+                    std::set<int_fast64_t> secondValues;
+                    if (!getRestriction(expression.getOperand(0), variable, values) || !getRestriction(expression.getOperand(1), secondVariable, secondValues) || variable != secondVariable) {
+                        return false;
+                    }
+                    values.insert(secondValues.begin(), secondValues.end());
+                    return true;
+                }
+                return false;
+            }
+
+            /*!
+             * Collects the restrictions of variables to sets of values that are imposed by the conjuncts of the given
+             * expression. Restrictions of the same variable are intersected.
+             */
+            void collectRestrictions(storm::expressions::Expression const& expression, std::map<storm::expressions::Variable, std::set<int_fast64_t>>& restrictions) {
+                if (expression.isFunctionApplication() && expression.getOperator() == storm::expressions::OperatorType::And) {
+                    collectRestrictions(expression.getOperand(0), restrictions);
+                    collectRestrictions(expression.getOperand(1), restrictions);
+                    return;
+                }
+
+                storm::expressions::Variable variable;
+                std::set<int_fast64_t> values;
+                if (getRestriction(expression, variable, values)) {
+                    auto restrictionIt = restrictions.find(variable);
+                    if (restrictionIt == restrictions.end()) {
+                        restrictions.emplace(variable, std::move(values));
+                    } else {
+                        std::set<int_fast64_t> intersection;
+                        for (auto const& value : values) {
+                            if (restrictionIt->second.count(value) > 0) {
+                                intersection.insert(value);
+                            }
+                        }
+                        restrictionIt->second = std::move(intersection);
+                    }
+                }
+            }
+        }
+
+        const uint64_t GuardIndex::MAXIMAL_DOMAIN_SIZE = 256;
+
+        GuardIndex::GuardIndex(VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& guards) : numberOfGuards(guards.size()) {
+            std::vector<std::map<storm::expressions::Variable, std::set<int_fast64_t>>> restrictionsOfGuards(guards.size());
+            std::set<storm::expressions::Variable> restrictedVariables;
+            for (uint64_t guardIndex = 0; guardIndex < guards.size(); ++guardIndex) {
+                detail::collectRestrictions(guards[guardIndex], restrictionsOfGuards[guardIndex]);
+                for (auto const& variableValuesPair : restrictionsOfGuards[guardIndex]) {
+                    restrictedVariables.insert(variableValuesPair.first);
+                }
+            }
+
+            // Builds the masks for a variable that is stored in the states with the given position and range.
+            auto indexVariable = [&] (storm::expressions::Variable const& variable, uint64_t bitOffset, uint64_t bitWidth, int_fast64_t lowerBound, int_fast64_t upperBound) {
+                IndexedVariable indexedVariable;
+                indexedVariable.bitOffset = bitOffset;
+                indexedVariable.bitWidth = bitWidth;
+                indexedVariable.lowerBound = lowerBound;
+                indexedVariable.candidatesForValue.resize(upperBound - lowerBound + 1, storm::storage::BitVector(numberOfGuards, true));
+                for (uint64_t guardIndex = 0; guardIndex < guards.size(); ++guardIndex) {
+                    auto restrictionIt = restrictionsOfGuards[guardIndex].find(variable);
+                    if (restrictionIt == restrictionsOfGuards[guardIndex].end()) {
+                        continue;
+                    }
+                    for (int_fast64_t value = lowerBound; value <= upperBound; ++value) {
+                        if (restrictionIt->second.count(value) == 0) {
+                            indexedVariable.candidatesForValue[value - lowerBound].set(guardIndex, false);
+                        }
+                    }
+                }
+                indexedVariables.push_back(std::move(indexedVariable));
+            };
+
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                if (restrictedVariables.count(booleanVariable.variable) > 0) {
+                    indexVariable(booleanVariable.variable, booleanVariable.bitOffset, 0, 0, 1);
+                }
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                // Variables with a single value cannot help to distinguish states.
+                if (integerVariable.bitWidth == 0 || restrictedVariables.count(integerVariable.variable) == 0) {
+                    continue;
+                }
+                if (static_cast<uint64_t>(integerVariable.upperBound - integerVariable.lowerBound) < MAXIMAL_DOMAIN_SIZE) {
+                    indexVariable(integerVariable.variable, integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound, integerVariable.upperBound);
+                }
+            }
+
+            STORM_LOG_TRACE("Indexed " << numberOfGuards << " guards over " << indexedVariables.size() << " variables.");
+        }
+
+        uint64_t GuardIndex::getNumberOfGuards() const {
+            return numberOfGuards;
+        }
+
+        bool GuardIndex::isTrivial() const {
+            return indexedVariables.empty();
+        }
+
+        void GuardIndex::computeCandidates(CompressedState const& state, storm::storage::BitVector& candidates) const {
+            bool first = true;
+            for (auto const& indexedVariable : indexedVariables) {
+                uint64_t value = indexedVariable.bitWidth == 0 ? (state.get(indexedVariable.bitOffset) ? 1 : 0) : state.getAsInt(indexedVariable.bitOffset, indexedVariable.bitWidth);
+
+                // A packed value outside of the range of the variable does not tell anything about the guards.
+                if (value >= indexedVariable.candidatesForValue.size()) {
+                    continue;
+                }
+
+                if (first) {
+                    candidates = indexedVariable.candidatesForValue[value];
+                    first = false;
+                } else {
+                    candidates &= indexedVariable.candidatesForValue[value];
+                }
+            }
+
+            // If no variable restricted the guards, all of them are candidates.
+            if (first && (candidates.size() != numberOfGuards || !candidates.full())) {
+                candidates = storm::storage::BitVector(numberOfGuards, true);
+            }
+        }
+
+    }
+}
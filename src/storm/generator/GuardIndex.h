@@ -0,0 +1,82 @@
+#ifndef STORM_GENERATOR_GUARDINDEX_H_
+#define STORM_GENERATOR_GUARDINDEX_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/Expression.h"
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+    namespace generator {
+        struct VariableInformation;
+
+        /*!
+         * An index over a list of guards that allows to quickly rule out guards that are disabled in a given state.
+         *
+         * For this, the guards are split into their conjuncts and all conjuncts that restrict a boolean variable or an
+         * integer variable with a small range to some set of values (e.g. x=2, !b or (x=1 | x=3)) are collected. For
+         * every such variable and each of its values, the index stores a bit mask of all guards that are not violated
+         * by the variable having this value. The candidate guards of a state are then obtained by intersecting the
+         * masks that belong to the values of the indexed variables in the state. All guards that are not candidates
+         * are guaranteed to be disabled, while the candidates still need to be evaluated.
+         */
+        class GuardIndex {
+        public:
+            /*!
+             * Creates an index for the given guards.
+             *
+             * @param variableInformation The information about how the variables are packed within the states.
+             * @param guards The guards to index.
+             */
+            GuardIndex(VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& guards);
+
+            /*!
+             * Retrieves the number of indexed guards.
+             */
+            uint64_t getNumberOfGuards() const;
+
+            /*!
+             * Retrieves whether the index is able to rule out any guard at all, i.e. whether at least one variable is
+             * indexed.
+             */
+            bool isTrivial() const;
+
+            /*!
+             * Computes the candidate guards for the given state, i.e. the guards that are possibly enabled in the state.
+             *
+             * @param state The state for which to compute the candidates.
+             * @param candidates The bit vector (whose size must be the number of guards) in which to store the
+             * candidates. Its storage is reused.
+             */
+            void computeCandidates(CompressedState const& state, storm::storage::BitVector& candidates) const;
+
+            // The maximal number of values a variable may have to be indexed.
+            static const uint64_t MAXIMAL_DOMAIN_SIZE;
+
+        private:
+            struct IndexedVariable {
+                // The position of the variable within the compressed states. For boolean variables, the bit width is
+                // zero.
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                int_fast64_t lowerBound;
+
+                // For each value of the variable (with the lower bound being subtracted), the guards that are not
+                // violated by this value.
+                std::vector<storm::storage::BitVector> candidatesForValue;
+            };
+
+            // The number of indexed guards.
+            uint64_t numberOfGuards;
+
+            // The variables that are restricted by the conjuncts of at least one guard.
+            std::vector<IndexedVariable> indexedVariables;
+        };
+
+    }
+}
+
+#endif /* STORM_GENERATOR_GUARDINDEX_H_ */
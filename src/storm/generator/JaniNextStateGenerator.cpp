@@ -110,6 +110,75 @@ namespace storm {
                     }
                 }
             }
+            
+            // Index the guards of the edges of each automaton, so disabled edges can be skipped quickly. The index is
+            // used for both the non-synchronizing and the synchronizing edges.
+            for (auto const& automatonRef : this->parallelAutomata) {
+                std::vector<storm::expressions::Expression> guards;
+                for (auto const& edge : automatonRef.get().getEdges()) {
+                    guards.push_back(edge.getGuard());
+                }
+                guardIndices.emplace_back(this->variableInformation, guards);
+                candidateEdges.emplace_back(automatonRef.get().getEdges().size(), true);
+            }
+            
+            compileExpressions();
+        }
+        
+        template<typename ValueType, typename StateType>
+        void JaniNextStateGenerator<ValueType, StateType>::compileExpressions() {
+            this->bytecodeEvaluator = std::make_unique<BytecodeEvaluator>(this->variableInformation);
+            
+            // Rational expressions are only compiled if we compute with doubles anyway.
+            bool compileRationalExpressions = std::is_same<ValueType, double>::value;
+            
+            for (auto const& automatonRef : this->parallelAutomata) {
+                auto const& automaton = automatonRef.get();
+                for (uint64_t locationIndex = 0; locationIndex < automaton.getNumberOfLocations(); ++locationIndex) {
+                    // The guards of all edges leaving a location are evaluated in one pass.
+                    std::vector<storm::expressions::Expression> guards;
+                    for (auto const& edge : automaton.getEdgesFromLocation(locationIndex)) {
+                        guards.push_back(edge.getGuard());
+                    }
+                    this->bytecodeEvaluator->addProgram(guards);
+                    
+                    if (compileRationalExpressions) {
+                        std::vector<storm::expressions::Expression> rewardExpressions;
+                        for (auto const& assignment : automaton.getLocation(locationIndex).getAssignments().getTransientAssignments()) {
+                            rewardExpressions.push_back(assignment.getAssignedExpression());
+                        }
+                        this->bytecodeEvaluator->addProgram(rewardExpressions);
+                    }
+                }
+                
+                // The rate, the probabilities and the assignments of an edge are needed together.
+                for (auto const& edge : automaton.getEdges()) {
+                    std::vector<storm::expressions::Expression> expressions;
+                    if (compileRationalExpressions && edge.hasRate()) {
+                        expressions.push_back(edge.getRate());
+                    }
+                    for (auto const& destination : edge.getDestinations()) {
+                        if (compileRationalExpressions) {
+                            expressions.push_back(destination.getProbability());
+                        }
+                        for (auto const& assignment : destination.getOrderedAssignments().getNonTransientAssignments()) {
+                            expressions.push_back(assignment.getAssignedExpression());
+                        }
+                    }
+                    if (compileRationalExpressions) {
+                        for (auto const& assignment : edge.getAssignments().getTransientAssignments()) {
+                            expressions.push_back(assignment.getAssignedExpression());
+                        }
+                    }
+                    this->bytecodeEvaluator->addProgram(expressions);
+                }
+            }
+            
+            std::vector<storm::expressions::Expression> terminalExpressions;
+            for (auto const& expressionBool : this->terminalStates) {
+                terminalExpressions.push_back(expressionBool.first);
+            }
+            this->bytecodeEvaluator->addProgram(terminalExpressions);
         }
         
         template<typename ValueType, typename StateType>
@@ -243,7 +312,7 @@ namespace storm {
                 while (assignmentIt->getExpressionVariable() != boolIt->variable) {
                     ++boolIt;
                 }
-                newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getAssignedExpression()));
+                newState.set(boolIt->bitOffset, this->evaluateBooleanExpression(assignmentIt->getAssignedExpression()));
             }
             
             // Iterate over all integer assignments and carry them out.
@@ -252,7 +321,7 @@ namespace storm {
                 while (assignmentIt->getExpressionVariable() != integerIt->variable) {
                     ++integerIt;
                 }
-                int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getAssignedExpression());
+                int_fast64_t assignedValue = this->evaluateIntegerExpression(assignmentIt->getAssignedExpression());
                 if (this->options.isExplorationChecksSet()) {
                     STORM_LOG_THROW(assignedValue >= integerIt->lowerBound, storm::exceptions::WrongFormatException, "The update " << assignmentIt->getExpressionVariable().getName() << " := " << assignmentIt->getAssignedExpression() << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << assignmentIt->getExpressionVariable().getName() << "'.");
                     STORM_LOG_THROW(assignedValue <= integerIt->upperBound, storm::exceptions::WrongFormatException, "The update " << assignmentIt->getExpressionVariable().getName() << " := " << assignmentIt->getAssignedExpression() << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << assignmentIt->getExpressionVariable().getName() << "'.");
@@ -292,7 +361,7 @@ namespace storm {
             // If a terminal expression was set and we must not expand this state, return now.
             if (!this->terminalStates.empty()) {
                 for (auto const& expressionBool : this->terminalStates) {
-                    if (this->evaluator->asBool(expressionBool.first) == expressionBool.second) {
+                    if (this->evaluateBooleanExpression(expressionBool.first) == expressionBool.second) {
                         return result;
                     }
                 }
@@ -360,7 +429,7 @@ namespace storm {
             // Determine the exit rate if it's a Markovian edge.
             boost::optional<ValueType> exitRate = boost::none;
             if (edge.hasRate()) {
-                exitRate = this->evaluator->asRational(edge.getRate());
+                exitRate = this->evaluateRationalExpression(edge.getRate());
             }
             
             Choice<ValueType> choice(edge.getActionIndex(), static_cast<bool>(exitRate));
@@ -368,7 +437,7 @@ namespace storm {
             // Iterate over all updates of the current command.
             ValueType probabilitySum = storm::utility::zero<ValueType>();
             for (auto const& destination : edge.getDestinations()) {
-                ValueType probability = this->evaluator->asRational(destination.getProbability());
+                ValueType probability = this->evaluateRationalExpression(destination.getProbability());
                 
                 if (probability != storm::utility::zero<ValueType>()) {
                     // Obtain target state index and add it to the list of known states. If it has not yet been
@@ -433,9 +502,9 @@ namespace storm {
                             
                             // If the new state was already found as a successor state, update the probability
                             // and otherwise insert it.
-                            ValueType probability = stateProbabilityPair.second * this->evaluator->asRational(destination.getProbability());
+                            ValueType probability = stateProbabilityPair.second * this->evaluateRationalExpression(destination.getProbability());
                             if (edge.hasRate()) {
-                                probability *= this->evaluator->asRational(edge.getRate());
+                                probability *= this->evaluateRationalExpression(edge.getRate());
                             }
                             if (probability != storm::utility::zero<ValueType>()) {
                                 auto targetStateIt = newTargetStates->find(newTargetState);
@@ -513,6 +582,13 @@ namespace storm {
         std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::getActionChoices(std::vector<uint64_t> const& locations, CompressedState const& state, StateToIdCallback stateToIdCallback) {
             std::vector<Choice<ValueType>> result;
             
+            // Determine the edges whose guards are possibly satisfied by the state.
+            for (uint64_t automatonIndex = 0; automatonIndex < guardIndices.size(); ++automatonIndex) {
+                if (!guardIndices[automatonIndex].isTrivial()) {
+                    guardIndices[automatonIndex].computeCandidates(state, candidateEdges[automatonIndex]);
+                }
+            }
+            
             for (auto const& outputAndEdges : edges) {
                 auto const& edges = outputAndEdges.second;
                 if (edges.size() == 1) {
@@ -523,7 +599,7 @@ namespace storm {
                     auto edgesIt = nonsychingEdges.second.find(locations[automatonIndex]);
                     if (edgesIt != nonsychingEdges.second.end()) {
                         for (auto const& edge : edgesIt->second) {
-                            if (!this->evaluator->asBool(edge->getGuard())) {
+                            if (!isCandidateEdge(automatonIndex, *edge) || !this->evaluateBooleanExpression(edge->getGuard())) {
                                 continue;
                             }
                         
@@ -547,7 +623,7 @@ namespace storm {
                         auto edgesIt = automatonAndEdges.second.find(locations[automatonIndex]);
                         if (edgesIt != automatonAndEdges.second.end()) {
                             for (auto const& edge : edgesIt->second) {
-                                if (!this->evaluator->asBool(edge->getGuard())) {
+                                if (!isCandidateEdge(automatonIndex, *edge) || !this->evaluateBooleanExpression(edge->getGuard())) {
                                     continue;
                                 }
                             
@@ -578,6 +654,11 @@ namespace storm {
             return result;
         }
         
+        template<typename ValueType, typename StateType>
+        bool JaniNextStateGenerator<ValueType, StateType>::isCandidateEdge(uint64_t automatonIndex, storm::jani::Edge const& edge) const {
+            return candidateEdges[automatonIndex].get(&edge - parallelAutomata[automatonIndex].get().getEdges().data());
+        }
+        
         template<typename ValueType, typename StateType>
         void JaniNextStateGenerator<ValueType, StateType>::checkGlobalVariableWritesValid(AutomataEdgeSets const& enabledEdges) const {
             std::map<storm::expressions::Variable, uint64_t> writtenGlobalVariables;
@@ -646,7 +727,7 @@ namespace storm {
                 if (rewardVariableIt == rewardVariableIte) {
                     break;
                 } else if (*rewardVariableIt == assignment.getExpressionVariable()) {
-                    callback(ValueType(this->evaluator->asRational(assignment.getAssignedExpression())));
+                    callback(ValueType(this->evaluateRationalExpression(assignment.getAssignedExpression())));
                     ++rewardVariableIt;
                 }
             }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/GuardIndex.h"
 
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/OrderedAssignments.h"
@@ -94,6 +95,12 @@ namespace storm {
              */
             void checkGlobalVariableWritesValid(AutomataEdgeSets const& enabledEdges) const;
             
+            /*!
+             * Checks whether the given edge of the given automaton is a candidate according to the guard index of the
+             * automaton, i.e. whether its guard is possibly satisfied by the state that is being expanded.
+             */
+            bool isCandidateEdge(uint64_t automatonIndex, storm::jani::Edge const& edge) const;
+            
             /*!
              * Treats the given transient assignments by calling the callback function whenever a transient assignment
              * to one of the reward variables of this generator is performed.
@@ -114,6 +121,12 @@ namespace storm {
              * Checks the underlying model for validity for this next-state generator.
              */
             void checkValid() const;
+            
+            /*!
+             * Compiles the expressions that are evaluated when expanding states, so they can be evaluated directly on
+             * the compressed states.
+             */
+            void compileExpressions();
                         
             /// The model used for the generation of next states.
             storm::jani::Model model;
@@ -132,6 +145,12 @@ namespace storm {
             
             /// A flag that stores whether at least one of the selected reward models has state-action rewards.
             bool hasStateActionRewards;
+            
+            /// For each automaton, an index over the guards of its edges.
+            std::vector<GuardIndex> guardIndices;
+            
+            /// For each automaton, the edges whose guards are possibly satisfied by the state that is being expanded.
+            std::vector<storm::storage::BitVector> candidateEdges;
         };
         
     }
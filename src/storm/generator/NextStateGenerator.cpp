@@ -9,6 +9,7 @@
 
 #include "storm/models/sparse/StateLabeling.h"
 
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 
@@ -16,12 +17,12 @@ namespace storm {
     namespace generator {
                     
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), state(nullptr) {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), bytecodeEvaluator(nullptr), stateUnpacked(false), state(nullptr) {
             // Intentionally left empty.
         }
         
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr) {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), bytecodeEvaluator(nullptr), stateUnpacked(false), state(nullptr) {
             // Intentionally left empty.
         }
         
@@ -37,8 +38,16 @@ namespace storm {
         
         template<typename ValueType, typename StateType>
         void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state) {
-            // Since almost all subsequent operations are based on the evaluator, we load the state into it now.
-            unpackStateIntoEvaluator(state, variableInformation, *evaluator);
+            // If expressions are compiled, they read the state directly, so we only unpack the state into the evaluator
+            // once some expression actually needs it. Otherwise, almost all subsequent operations are based on the
+            // evaluator and we load the state into it now.
+            if (bytecodeEvaluator) {
+                bytecodeEvaluator->load(state);
+                stateUnpacked = false;
+            } else {
+                unpackStateIntoEvaluator(state, variableInformation, *evaluator);
+                stateUnpacked = true;
+            }
             
             // Also, we need to store a pointer to the state itself, because we need to be able to access it when expanding it.
             this->state = &state;
@@ -49,7 +58,41 @@ namespace storm {
             if (expression.isTrue()) {
                 return true;
             }
-            return evaluator->asBool(expression);
+            return evaluateBooleanExpression(expression);
+        }
+        
+        template<typename ValueType, typename StateType>
+        bool NextStateGenerator<ValueType, StateType>::evaluateBooleanExpression(storm::expressions::Expression const& expression) const {
+            if (bytecodeEvaluator && bytecodeEvaluator->isCompiled(expression)) {
+                return bytecodeEvaluator->asBool(expression);
+            }
+            return getLoadedEvaluator().asBool(expression);
+        }
+        
+        template<typename ValueType, typename StateType>
+        int_fast64_t NextStateGenerator<ValueType, StateType>::evaluateIntegerExpression(storm::expressions::Expression const& expression) const {
+            if (bytecodeEvaluator && bytecodeEvaluator->isCompiled(expression)) {
+                return bytecodeEvaluator->asInt(expression);
+            }
+            return getLoadedEvaluator().asInt(expression);
+        }
+        
+        template<typename ValueType, typename StateType>
+        ValueType NextStateGenerator<ValueType, StateType>::evaluateRationalExpression(storm::expressions::Expression const& expression) const {
+            // The bytecode evaluator computes with doubles, so we only use it if that is the value type anyway.
+            if (std::is_same<ValueType, double>::value && bytecodeEvaluator && bytecodeEvaluator->isCompiled(expression)) {
+                return storm::utility::convertNumber<ValueType>(bytecodeEvaluator->asRational(expression));
+            }
+            return getLoadedEvaluator().asRational(expression);
+        }
+        
+        template<typename ValueType, typename StateType>
+        storm::expressions::ExpressionEvaluator<ValueType>& NextStateGenerator<ValueType, StateType>::getLoadedEvaluator() const {
+            if (!stateUnpacked) {
+                unpackStateIntoEvaluator(*state, variableInformation, *evaluator);
+                stateUnpacked = true;
+            }
+            return *evaluator;
         }
         
         template<typename ValueType, typename StateType>
@@ -77,6 +120,7 @@ namespace storm {
             storm::storage::BitVectorHashMap<StateType> const& states = stateStorage.stateToId;
             for (auto const& stateIndexPair : states) {
                 unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
+                stateUnpacked = false;
                 
                 for (auto const& label : labelsAndExpressions) {
                     // Add label to state, if the corresponding expression is true.
@@ -17,6 +17,7 @@
 #include "storm/generator/VariableInformation.h"
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/StateBehavior.h"
+#include "storm/generator/BytecodeEvaluator.h"
 
 #include "storm/utility/ConstantsComparator.h"
 
@@ -75,6 +76,20 @@ namespace storm {
             
             void postprocess(StateBehavior<ValueType, StateType>& result);
             
+            /*!
+             * Evaluates the given expression in the currently loaded state. Expressions that were compiled by the
+             * bytecode evaluator are evaluated directly on the compressed state, all others by the expression evaluator.
+             */
+            bool evaluateBooleanExpression(storm::expressions::Expression const& expression) const;
+            int_fast64_t evaluateIntegerExpression(storm::expressions::Expression const& expression) const;
+            ValueType evaluateRationalExpression(storm::expressions::Expression const& expression) const;
+            
+            /*!
+             * Retrieves the expression evaluator. If the currently loaded state was not yet unpacked into the evaluator,
+             * this is done first.
+             */
+            storm::expressions::ExpressionEvaluator<ValueType>& getLoadedEvaluator() const;
+            
             /// The options to be used for next-state generation.
             NextStateGeneratorOptions options;
             
@@ -90,6 +105,12 @@ namespace storm {
             /// An evaluator used to evaluate expressions.
             std::unique_ptr<storm::expressions::ExpressionEvaluator<ValueType>> evaluator;
             
+            /// If set, an evaluator used to evaluate the expressions it compiled directly on the compressed states.
+            std::unique_ptr<BytecodeEvaluator> bytecodeEvaluator;
+            
+            /// A flag indicating whether the currently loaded state was unpacked into the evaluator.
+            mutable bool stateUnpacked;
+            
             /// The currently loaded state.
             CompressedState const* state;
             
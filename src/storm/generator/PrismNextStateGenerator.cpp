@@ -78,6 +78,75 @@ namespace storm {
                     }
                 }
             }
+            
+            // Index the guards of the commands of each module, so disabled commands can be skipped quickly.
+            for (auto const& module : this->program.getModules()) {
+                std::vector<storm::expressions::Expression> guards;
+                for (auto const& command : module.getCommands()) {
+                    guards.push_back(command.getGuardExpression());
+                }
+                guardIndices.emplace_back(this->variableInformation, guards);
+                candidateCommands.emplace_back(module.getNumberOfCommands(), true);
+            }
+            
+            compileExpressions();
+        }
+        
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::compileExpressions() {
+            this->bytecodeEvaluator = std::make_unique<BytecodeEvaluator>(this->variableInformation);
+            
+            // Rational expressions are only compiled if we compute with doubles anyway.
+            bool compileRationalExpressions = std::is_same<ValueType, double>::value;
+            
+            for (auto const& module : program.getModules()) {
+                // The guards of all commands of a module are evaluated in one pass.
+                std::vector<storm::expressions::Expression> guards;
+                for (auto const& command : module.getCommands()) {
+                    guards.push_back(command.getGuardExpression());
+                }
+                this->bytecodeEvaluator->addProgram(guards);
+                
+                // The probability and the assignments of an update are needed together.
+                for (auto const& command : module.getCommands()) {
+                    for (auto const& update : command.getUpdates()) {
+                        std::vector<storm::expressions::Expression> expressions;
+                        if (compileRationalExpressions) {
+                            expressions.push_back(update.getLikelihoodExpression());
+                        }
+                        for (auto const& assignment : update.getAssignments()) {
+                            expressions.push_back(assignment.getExpression());
+                        }
+                        this->bytecodeEvaluator->addProgram(expressions);
+                    }
+                }
+            }
+            
+            for (auto const& rewardModel : rewardModels) {
+                std::vector<storm::expressions::Expression> stateRewardExpressions;
+                for (auto const& stateReward : rewardModel.get().getStateRewards()) {
+                    stateRewardExpressions.push_back(stateReward.getStatePredicateExpression());
+                    if (compileRationalExpressions) {
+                        stateRewardExpressions.push_back(stateReward.getRewardValueExpression());
+                    }
+                }
+                this->bytecodeEvaluator->addProgram(stateRewardExpressions);
+                
+                std::vector<storm::expressions::Expression> stateActionRewardExpressions;
+                for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                    stateActionRewardExpressions.push_back(stateActionReward.getStatePredicateExpression());
+                    if (compileRationalExpressions) {
+                        stateActionRewardExpressions.push_back(stateActionReward.getRewardValueExpression());
+                    }
+                }
+                this->bytecodeEvaluator->addProgram(stateActionRewardExpressions);
+            }
+            
+            std::vector<storm::expressions::Expression> terminalExpressions;
+            for (auto const& expressionBool : this->terminalStates) {
+                terminalExpressions.push_back(expressionBool.first);
+            }
+            this->bytecodeEvaluator->addProgram(terminalExpressions);
         }
 
         template<typename ValueType, typename StateType>
@@ -192,8 +261,8 @@ namespace storm {
                 ValueType stateRewardValue = storm::utility::zero<ValueType>();
                 if (rewardModel.get().hasStateRewards()) {
                     for (auto const& stateReward : rewardModel.get().getStateRewards()) {
-                        if (this->evaluator->asBool(stateReward.getStatePredicateExpression())) {
-                            stateRewardValue += ValueType(this->evaluator->asRational(stateReward.getRewardValueExpression()));
+                        if (this->evaluateBooleanExpression(stateReward.getStatePredicateExpression())) {
+                            stateRewardValue += ValueType(this->evaluateRationalExpression(stateReward.getRewardValueExpression()));
                         }
                     }
                 }
@@ -203,12 +272,19 @@ namespace storm {
             // If a terminal expression was set and we must not expand this state, return now.
             if (!this->terminalStates.empty()) {
                 for (auto const& expressionBool : this->terminalStates) {
-                    if (this->evaluator->asBool(expressionBool.first) == expressionBool.second) {
+                    if (this->evaluateBooleanExpression(expressionBool.first) == expressionBool.second) {
                         return result;
                     }
                 }
             }
 
+            // Determine the commands whose guards are possibly satisfied by the state.
+            for (uint_fast64_t i = 0; i < guardIndices.size(); ++i) {
+                if (!guardIndices[i].isTrivial()) {
+                    guardIndices[i].computeCandidates(*this->state, candidateCommands[i]);
+                }
+            }
+            
             // Get all choices for the state.
             result.setExpanded();
             std::vector<Choice<ValueType>> allChoices = getUnlabeledChoices(*this->state, stateToIdCallback);
@@ -261,8 +337,8 @@ namespace storm {
                     if (rewardModel.get().hasStateActionRewards()) {
                         for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
                             for (auto const& choice : allChoices) {
-                                if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                                    stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression())) * choice.getTotalMass();
+                                if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluateBooleanExpression(stateActionReward.getStatePredicateExpression())) {
+                                    stateActionRewardValue += ValueType(this->evaluateRationalExpression(stateActionReward.getRewardValueExpression())) * choice.getTotalMass();
                                 }
                             }
                             
@@ -306,7 +382,7 @@ namespace storm {
                 while (assignmentIt->getVariable() != boolIt->variable) {
                     ++boolIt;
                 }
-                newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+                newState.set(boolIt->bitOffset, this->evaluateBooleanExpression(assignmentIt->getExpression()));
             }
             
             // Iterate over all integer assignments and carry them out.
@@ -315,7 +391,7 @@ namespace storm {
                 while (assignmentIt->getVariable() != integerIt->variable) {
                     ++integerIt;
                 }
-                int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+                int_fast64_t assignedValue = this->evaluateIntegerExpression(assignmentIt->getExpression());
                 if (this->options.isExplorationChecksSet()) {
                     STORM_LOG_THROW(assignedValue >= integerIt->lowerBound, storm::exceptions::WrongFormatException, "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << assignmentIt->getVariableName() << "'.");
                     STORM_LOG_THROW(assignedValue <= integerIt->upperBound, storm::exceptions::WrongFormatException, "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << assignmentIt->getVariableName() << "'.");
@@ -356,7 +432,7 @@ namespace storm {
                 // Look up commands by their indices and add them if the guard evaluates to true in the given state.
                 for (uint_fast64_t commandIndex : commandIndices) {
                     storm::prism::Command const& command = module.getCommand(commandIndex);
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (candidateCommands[i].get(commandIndex) && this->evaluateBooleanExpression(command.getGuardExpression())) {
                         commands.push_back(command);
                     }
                 }
@@ -390,7 +466,7 @@ namespace storm {
                     if (command.isLabeled()) continue;
                     
                     // Skip the command, if it is not enabled.
-                    if (!this->evaluator->asBool(command.getGuardExpression())) {
+                    if (!candidateCommands[i].get(j) || !this->evaluateBooleanExpression(command.getGuardExpression())) {
                         continue;
                     }
                     
@@ -408,7 +484,7 @@ namespace storm {
                     for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
                         storm::prism::Update const& update = command.getUpdate(k);
 
-                        ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+                        ValueType probability = this->evaluateRationalExpression(update.getLikelihoodExpression());
                         if (probability != storm::utility::zero<ValueType>()) {
                             // Obtain target state index and add it to the list of known states. If it has not yet been
                             // seen, we also add it to the set of states that have yet to be explored.
@@ -427,8 +503,8 @@ namespace storm {
                         ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
                         if (rewardModel.get().hasStateActionRewards()) {
                             for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                                if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                                    stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
+                                if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluateBooleanExpression(stateActionReward.getStatePredicateExpression())) {
+                                    stateActionRewardValue += ValueType(this->evaluateRationalExpression(stateActionReward.getRewardValueExpression()));
                                 }
                             }
                         }
@@ -476,7 +552,7 @@ namespace storm {
                                 storm::prism::Update const& update = command.getUpdate(j);
                                 
                                 for (auto const& stateProbabilityPair : *currentTargetStates) {
-                                    ValueType probability = stateProbabilityPair.second * this->evaluator->asRational(update.getLikelihoodExpression());
+                                    ValueType probability = stateProbabilityPair.second * this->evaluateRationalExpression(update.getLikelihoodExpression());
 
                                     if (!storm::utility::isZero<ValueType>(probability)) {
                                         // Compute the new state under the current update and add it to the set of new target states.
@@ -542,8 +618,8 @@ namespace storm {
                             ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
                             if (rewardModel.get().hasStateActionRewards()) {
                                 for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                                    if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                                        stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
+                                    if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluateBooleanExpression(stateActionReward.getStatePredicateExpression())) {
+                                        stateActionRewardValue += ValueType(this->evaluateRationalExpression(stateActionReward.getRewardValueExpression()));
                                     }
                                 }
                             }
@@ -4,6 +4,7 @@
 #include <boost/container/flat_set.hpp>
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/GuardIndex.h"
 
 #include "storm/storage/prism/Program.h"
 
@@ -35,6 +36,12 @@ namespace storm {
         private:
             void checkValid() const;
 
+            /*!
+             * Compiles the expressions that are evaluated when expanding states, so they can be evaluated directly on
+             * the compressed states.
+             */
+            void compileExpressions();
+
             /*!
              * A delegate constructor that is used to preprocess the program before the constructor of the superclass is
              * being called. The last argument is only present to distinguish the signature of this constructor from the
@@ -60,7 +67,8 @@ namespace storm {
              * the inner lists contain all commands of exactly one module. If a module does not have *any* (including
              * disabled) commands, there will not be a list of commands of that module in the result. If, however, the
              * module has a command with a relevant label, but no enabled one, nothing is returned to indicate that there
-             * is no legal transition possible.
+             * is no legal transition possible. Only commands that are candidates according to the guard index of their
+             * module are considered.
              *
              * @param The program in which to search for active commands.
              * @param state The current state.
@@ -93,6 +101,12 @@ namespace storm {
             
             // A flag that stores whether at least one of the selected reward models has state-action rewards.
             bool hasStateActionRewards;
+            
+            // For each module, an index over the guards of its commands.
+            std::vector<GuardIndex> guardIndices;
+            
+            // For each module, the commands whose guards are possibly satisfied by the state that is being expanded.
+            std::vector<storm::storage::BitVector> candidateCommands;
         };
         
     }
@@ -362,25 +362,43 @@ namespace storm {
                         linEq.solver->setCachingEnabled(true);
                     }
                     
-                    // Get the results for the individual objectives.
+                    // Get the results for the individual objectives. As the scheduler is fixed, all objectives share the same equation
+                    // system and only differ in the right-hand side, so they are solved at once.
                     // Note that we do not consider an estimate for each objective (as done in the unbounded phase) since the results from the previous epoch are already pretty close
+                    uint_fast64_t numberOfSystems = consideredObjectives.getNumberOfSetBits();
+                    uint_fast64_t numberOfStates = PS.getNumberOfStates();
+                    linEq.x.resize(numberOfStates * numberOfSystems);
+                    linEq.b.resize(numberOfStates * numberOfSystems);
+                    uint_fast64_t system = 0;
                     for (auto objIndex : consideredObjectives) {
                         auto const& objectiveRewardVectorPS = PS.objectiveRewardVectors[objIndex];
                         auto const& objectiveSolutionVectorMS = MS.objectiveSolutionVectors[objIndex];
+                        auto const& objectiveSolutionVectorPS = PS.objectiveSolutionVectors[objIndex];
                         // compute rhs of equation system, i.e., PS.toMS * x + Rewards
                         // To safe some time, only do this for the obtained optimal choices
                         auto itGroupIndex = PS.toPS.getRowGroupIndices().begin();
                         auto itChoiceOffset = optimalChoicesAtCurrentEpoch.begin();
-                        for (auto& bValue : linEq.b) {
+                        for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
                             uint_fast64_t row = (*itGroupIndex) + (*itChoiceOffset);
+                            ValueType& bValue = linEq.b[state * numberOfSystems + system];
                             bValue = objectiveRewardVectorPS[row];
                             for (auto const& entry : PS.toMS.getRow(row)){
                                 bValue += entry.getValue() * objectiveSolutionVectorMS[entry.getColumn()];
                             }
+                            linEq.x[state * numberOfSystems + system] = objectiveSolutionVectorPS[state];
                             ++itGroupIndex;
                             ++itChoiceOffset;
                         }
-                        linEq.solver->solveEquations(PS.objectiveSolutionVectors[objIndex], linEq.b);
+                        ++system;
+                    }
+                    linEq.solver->solveEquationsMultiple(linEq.x, linEq.b, numberOfSystems);
+                    system = 0;
+                    for (auto objIndex : consideredObjectives) {
+                        auto& objectiveSolutionVectorPS = PS.objectiveSolutionVectors[objIndex];
+                        for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+                            objectiveSolutionVectorPS[state] = linEq.x[state * numberOfSystems + system];
+                        }
+                        ++system;
                     }
                 }
             }
@@ -71,6 +71,8 @@ namespace storm {
                 struct LinEqSolverData {
                     std::unique_ptr<storm::solver::LinearEquationSolverFactory<ValueType>> factory;
                     std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver;
+                    // The solution vectors and right-hand sides of the considered objectives, stored as interleaved blocks.
+                    std::vector<ValueType> x;
                     std::vector<ValueType> b;
                 };
                 
@@ -1,5 +1,7 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaParetoQuery.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -55,41 +57,68 @@ namespace storm {
             void SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::exploreSetOfAchievablePoints() {
             
                 //First consider the objectives individually
+                std::vector<WeightVector> directions;
                 for(uint_fast64_t objIndex = 0; objIndex<this->objectives.size() && !this->maxStepsPerformed(); ++objIndex) {
                     WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
                     direction[objIndex] = storm::utility::one<GeometryValueType>();
-                    this->performRefinementStep(std::move(direction));
+                    directions.push_back(std::move(direction));
+                    if (directions.size() >= getNumberOfDirectionsForNextStep()) {
+                        this->performRefinementSteps(std::move(directions));
+                        directions.clear();
+                    }
+                }
+                if (!directions.empty()) {
+                    this->performRefinementSteps(std::move(directions));
                 }
                 
                 while(!this->maxStepsPerformed()) {
-                    // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+                    // Get the halfspaces of the underApproximation with maximal distance to a vertex of the overApproximation
                     std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = this->underApproximation->getHalfspaces();
                     std::vector<Point> overApproxVertices = this->overApproximation->getVertices();
-                    uint_fast64_t farestHalfspaceIndex = underApproxHalfspaces.size();
-                    GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
+                    std::vector<std::pair<GeometryValueType, uint_fast64_t>> halfspaceDistances;
+                    halfspaceDistances.reserve(underApproxHalfspaces.size());
                     for(uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
+                        GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
                         for(auto const& vertex : overApproxVertices) {
                             GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
                             if(distance > farestDistance) {
-                                farestHalfspaceIndex = halfspaceIndex;
                                 farestDistance = distance;
                             }
                         }
+                        halfspaceDistances.emplace_back(std::move(farestDistance), halfspaceIndex);
                     }
-                    if(farestDistance < storm::utility::convertNumber<GeometryValueType>(storm::settings::getModule<storm::settings::modules::MultiObjectiveSettings>().getPrecision())) {
+                    // Consider the halfspaces with the largest distance first. For equal distances, the first halfspace is preferred.
+                    std::stable_sort(halfspaceDistances.begin(), halfspaceDistances.end(), [] (std::pair<GeometryValueType, uint_fast64_t> const& lhs, std::pair<GeometryValueType, uint_fast64_t> const& rhs) { return lhs.first > rhs.first; });
+                    GeometryValueType precision = storm::utility::convertNumber<GeometryValueType>(storm::settings::getModule<storm::settings::modules::MultiObjectiveSettings>().getPrecision());
+                    if(halfspaceDistances.empty() || halfspaceDistances.front().first < precision) {
                         // Goal precision reached!
                         return;
                     }
-                    STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
-                    WeightVector direction = underApproxHalfspaces[farestHalfspaceIndex].normalVector();
-                    this->performRefinementStep(std::move(direction));
+                    STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(halfspaceDistances.front().first));
+                    uint_fast64_t numberOfDirections = getNumberOfDirectionsForNextStep();
+                    for (auto const& halfspaceDistance : halfspaceDistances) {
+                        if (directions.size() >= numberOfDirections || halfspaceDistance.first < precision) {
+                            break;
+                        }
+                        directions.push_back(underApproxHalfspaces[halfspaceDistance.second].normalVector());
+                    }
+                    this->performRefinementSteps(std::move(directions));
+                    directions.clear();
                 }
                 STORM_LOG_ERROR("Could not reach the desired precision: Exceeded maximum number of refinement steps");
             }
             
-            
+            template <class SparseModelType, typename GeometryValueType>
+            uint_fast64_t SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::getNumberOfDirectionsForNextStep() const {
+                uint_fast64_t result = this->getRefinementBatchSize();
+                if (storm::settings::getModule<storm::settings::modules::MultiObjectiveSettings>().isMaxStepsSet()) {
+                    uint_fast64_t maxSteps = storm::settings::getModule<storm::settings::modules::MultiObjectiveSettings>().getMaxSteps();
+                    STORM_LOG_ASSERT(this->refinementSteps.size() < maxSteps, "Maximum number of refinement steps already performed.");
+                    result = std::min<uint_fast64_t>(result, maxSteps - this->refinementSteps.size());
+                }
+                return result;
+            }
 
-            
 #ifdef STORM_HAVE_CARL
             template class SparsePcaaParetoQuery<storm::models::sparse::Mdp<double>, storm::RationalNumber>;
             template class SparsePcaaParetoQuery<storm::models::sparse::MarkovAutomaton<double>, storm::RationalNumber>;
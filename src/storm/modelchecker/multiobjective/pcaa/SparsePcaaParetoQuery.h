@@ -40,6 +40,11 @@ namespace storm {
                  * Performs refinement steps until the approximation is sufficiently precise
                  */
                 void exploreSetOfAchievablePoints();
+                
+                /*
+                 * Returns the number of directions that are to be checked in the next refinement step
+                 */
+                uint_fast64_t getNumberOfDirectionsForNextStep() const;
             };
             
         }
@@ -1,5 +1,12 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaQuery.h"
 
+#include <type_traits>
+
+#include "storm-config.h"
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/tbb.h"
+#endif
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -9,6 +16,7 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparseMaPcaaWeightVectorChecker.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/MultiObjectiveSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/geometry/Hyperrectangle.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
@@ -24,32 +32,33 @@ namespace storm {
             template <class SparseModelType, typename GeometryValueType>
             SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(SparseMultiObjectivePreprocessorReturnType<SparseModelType>& preprocessorResult) :
                 originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula),
-                preprocessedModel(std::move(*preprocessorResult.preprocessedModel)), objectives(std::move(preprocessorResult.objectives)) {
+                preprocessedModel(std::move(*preprocessorResult.preprocessedModel)), objectives(std::move(preprocessorResult.objectives)),
+                possibleECActions(std::move(preprocessorResult.possibleECChoices)), possibleBottomStates(std::move(preprocessorResult.possibleBottomStates)) {
                 
-                initializeWeightVectorChecker(preprocessedModel, objectives, preprocessorResult.possibleECChoices, preprocessorResult.possibleBottomStates);
+                this->weightVectorChecker = createWeightVectorChecker();
                 this->diracWeightVectorsToBeChecked = storm::storage::BitVector(this->objectives.size(), true);
                 this->overApproximation = storm::storage::geometry::Polytope<GeometryValueType>::createUniversalPolytope();
                 this->underApproximation = storm::storage::geometry::Polytope<GeometryValueType>::createEmptyPolytope();
             }
             
             template<>
-            void SparsePcaaQuery<storm::models::sparse::Mdp<double>, storm::RationalNumber>::initializeWeightVectorChecker(storm::models::sparse::Mdp<double> const& model, std::vector<Objective<double>> const& objectives, storm::storage::BitVector const& possibleECActions, storm::storage::BitVector const& possibleBottomStates) {
-                this->weightVectorChecker = std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<double>>>(new SparseMdpPcaaWeightVectorChecker<storm::models::sparse::Mdp<double>>(model, objectives, possibleECActions, possibleBottomStates));
+            std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<double>>> SparsePcaaQuery<storm::models::sparse::Mdp<double>, storm::RationalNumber>::createWeightVectorChecker() const {
+                return std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<double>>>(new SparseMdpPcaaWeightVectorChecker<storm::models::sparse::Mdp<double>>(preprocessedModel, objectives, possibleECActions, possibleBottomStates));
             }
             
             template<>
-            void SparsePcaaQuery<storm::models::sparse::Mdp<storm::RationalNumber>, storm::RationalNumber>::initializeWeightVectorChecker(storm::models::sparse::Mdp<storm::RationalNumber> const& model, std::vector<Objective<storm::RationalNumber>> const& objectives, storm::storage::BitVector const& possibleECActions, storm::storage::BitVector const& possibleBottomStates) {
-                this->weightVectorChecker = std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<storm::RationalNumber>>>(new SparseMdpPcaaWeightVectorChecker<storm::models::sparse::Mdp<storm::RationalNumber>>(model, objectives, possibleECActions, possibleBottomStates));
+            std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<storm::RationalNumber>>> SparsePcaaQuery<storm::models::sparse::Mdp<storm::RationalNumber>, storm::RationalNumber>::createWeightVectorChecker() const {
+                return std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<storm::RationalNumber>>>(new SparseMdpPcaaWeightVectorChecker<storm::models::sparse::Mdp<storm::RationalNumber>>(preprocessedModel, objectives, possibleECActions, possibleBottomStates));
             }
             
             template<>
-            void SparsePcaaQuery<storm::models::sparse::MarkovAutomaton<double>, storm::RationalNumber>::initializeWeightVectorChecker(storm::models::sparse::MarkovAutomaton<double> const& model, std::vector<Objective<double>> const& objectives, storm::storage::BitVector const& possibleECActions, storm::storage::BitVector const& possibleBottomStates) {
-                this->weightVectorChecker = std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<double>>>(new SparseMaPcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<double>>(model, objectives, possibleECActions, possibleBottomStates));
+            std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<double>>> SparsePcaaQuery<storm::models::sparse::MarkovAutomaton<double>, storm::RationalNumber>::createWeightVectorChecker() const {
+                return std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<double>>>(new SparseMaPcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<double>>(preprocessedModel, objectives, possibleECActions, possibleBottomStates));
             }
             
             template<>
-            void SparsePcaaQuery<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>, storm::RationalNumber>::initializeWeightVectorChecker(storm::models::sparse::MarkovAutomaton<storm::RationalNumber> const& model, std::vector<Objective<storm::RationalNumber>> const& objectives, storm::storage::BitVector const& possibleECActions, storm::storage::BitVector const& possibleBottomStates) {
-                this->weightVectorChecker = std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>>>(new SparseMaPcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>>(model, objectives, possibleECActions, possibleBottomStates));
+            std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>>> SparsePcaaQuery<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>, storm::RationalNumber>::createWeightVectorChecker() const {
+                return std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>>>(new SparseMaPcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>>(preprocessedModel, objectives, possibleECActions, possibleBottomStates));
             }
             
             
@@ -100,11 +109,82 @@ namespace storm {
                 // Normalize the direction vector so that the entries sum up to one
                 storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
                 weightVectorChecker->check(storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
-                STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
+                refinementSteps.push_back(getRefinementStep(*weightVectorChecker, std::move(direction)));
+                
+                updateOverApproximation();
+                updateUnderApproximation();
+            }
+            
+            template <class SparseModelType, typename GeometryValueType>
+            void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(std::vector<WeightVector>&& directions) {
+                if (directions.size() == 1) {
+                    performRefinementStep(std::move(directions.front()));
+                    return;
+                }
+                
+                // Normalize the direction vectors and convert them to weight vectors. This is done beforehand as the
+                // geometry value type is not necessarily thread-safe.
+                std::vector<std::vector<typename SparseModelType::ValueType>> weightVectors;
+                weightVectors.reserve(directions.size());
+                for (auto& direction : directions) {
+                    storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
+                    weightVectors.push_back(storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
+                }
+                
+                // Make sure that there is a weight vector checker for every direction
+                while (additionalWeightVectorCheckers.size() + 1 < directions.size()) {
+                    additionalWeightVectorCheckers.push_back(createWeightVectorChecker());
+                }
+                std::vector<SparsePcaaWeightVectorChecker<SparseModelType>*> checkers;
+                checkers.push_back(weightVectorChecker.get());
+                for (uint_fast64_t i = 0; i + 1 < directions.size(); ++i) {
+                    additionalWeightVectorCheckers[i]->setWeightedPrecision(weightVectorChecker->getWeightedPrecision());
+                    checkers.push_back(additionalWeightVectorCheckers[i].get());
+                }
+                
+#ifdef STORM_HAVE_INTELTBB
+                if (getRefinementBatchSize() > 1) {
+                    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, directions.size(), 1), [&checkers, &weightVectors] (tbb::blocked_range<uint_fast64_t> const& range) {
+                        for (uint_fast64_t i = range.begin(); i < range.end(); ++i) {
+                            checkers[i]->check(weightVectors[i]);
+                        }
+                    });
+                } else {
+                    for (uint_fast64_t i = 0; i < directions.size(); ++i) {
+                        checkers[i]->check(weightVectors[i]);
+                    }
+                }
+#else
+                for (uint_fast64_t i = 0; i < directions.size(); ++i) {
+                    checkers[i]->check(weightVectors[i]);
+                }
+#endif
+                
+                for (uint_fast64_t i = 0; i < directions.size(); ++i) {
+                    refinementSteps.push_back(getRefinementStep(*checkers[i], std::move(directions[i])));
+                    updateOverApproximation();
+                }
+                updateUnderApproximation();
+            }
+            
+            template <class SparseModelType, typename GeometryValueType>
+            uint_fast64_t SparsePcaaQuery<SparseModelType, GeometryValueType>::getRefinementBatchSize() const {
+#ifdef STORM_HAVE_INTELTBB
+                // Parallel checking is restricted to doubles as the exact number types are not thread-safe
+                if (std::is_same<typename SparseModelType::ValueType, double>::value && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                    return std::max<uint_fast64_t>(1, tbb::task_scheduler_init::default_num_threads());
+                }
+#endif
+                return 1;
+            }
+            
+            template <class SparseModelType, typename GeometryValueType>
+            typename SparsePcaaQuery<SparseModelType, GeometryValueType>::RefinementStep SparsePcaaQuery<SparseModelType, GeometryValueType>::getRefinementStep(SparsePcaaWeightVectorChecker<SparseModelType> const& checker, WeightVector&& normalizedDirection) const {
+                STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(checker.getUnderApproximationOfInitialStateResults())));
                 RefinementStep step;
-                step.weightVector = direction;
-                step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-                step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
+                step.weightVector = std::move(normalizedDirection);
+                step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getUnderApproximationOfInitialStateResults());
+                step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getOverApproximationOfInitialStateResults());
                 // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
                 for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
                     if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
@@ -112,10 +192,7 @@ namespace storm {
                         step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
                     }
                 }
-                refinementSteps.push_back(std::move(step));
-                
-                updateOverApproximation();
-                updateUnderApproximation();
+                return step;
             }
             
             template <class SparseModelType, typename GeometryValueType>
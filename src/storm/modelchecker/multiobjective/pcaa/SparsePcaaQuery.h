@@ -40,12 +40,9 @@ namespace storm {
             protected:
                 
                 /*
-                 * Initializes the weight vector checker with the provided data from preprocessing
+                 * Creates a new weight vector checker for the preprocessed model and objectives
                  */
-                void initializeWeightVectorChecker(SparseModelType const& model,
-                                                   std::vector<Objective<typename SparseModelType::ValueType>> const& objectives,
-                                                   storm::storage::BitVector const& possibleECActions,
-                                                   storm::storage::BitVector const& possibleBottomStates);
+                std::unique_ptr<SparsePcaaWeightVectorChecker<SparseModelType>> createWeightVectorChecker() const;
                 
                 /*
                  * Represents the information obtained in a single iteration of the algorithm
@@ -75,6 +72,23 @@ namespace storm {
                  */
                 void performRefinementStep(WeightVector&& direction);
                 
+                /*
+                 * Refines the current result w.r.t. all of the given direction vectors.
+                 * If TBB is enabled, the weight vectors are checked in parallel, each one with its own weight vector checker.
+                 */
+                void performRefinementSteps(std::vector<WeightVector>&& directions);
+                
+                /*
+                 * Returns the number of direction vectors that should be considered in a single call of performRefinementSteps.
+                 * This is one, unless the weight vectors can be checked in parallel.
+                 */
+                uint_fast64_t getRefinementBatchSize() const;
+                
+                /*
+                 * Creates a refinement step from the current results of the given weight vector checker
+                 */
+                RefinementStep getRefinementStep(SparsePcaaWeightVectorChecker<SparseModelType> const& checker, WeightVector&& normalizedDirection) const;
+                
                 /*
                  * Updates the overapproximation after a refinement step has been performed
                  *
@@ -107,8 +121,15 @@ namespace storm {
                 SparseModelType preprocessedModel;
                 std::vector<Objective<typename SparseModelType::ValueType>> objectives;
                 
+                // Overapproximation of the choices that are part of an end component
+                storm::storage::BitVector possibleECActions;
+                // The states for which it is possible to not collect further reward with prob. 1
+                storm::storage::BitVector possibleBottomStates;
+                
                 // The corresponding weight vector checker
                 std::unique_ptr<SparsePcaaWeightVectorChecker<SparseModelType>> weightVectorChecker;
+                // Additional weight vector checkers that are used when checking multiple weight vectors in parallel
+                std::vector<std::unique_ptr<SparsePcaaWeightVectorChecker<SparseModelType>>> additionalWeightVectorCheckers;
 
                 //The results in each iteration of the algorithm
                 std::vector<RefinementStep> refinementSteps;
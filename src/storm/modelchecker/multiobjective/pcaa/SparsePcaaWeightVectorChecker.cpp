@@ -1,5 +1,6 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaWeightVectorChecker.h"
 
+#include <algorithm>
 #include <map>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -216,28 +217,38 @@ namespace storm {
                 } else {
                    storm::storage::SparseMatrix<ValueType> deterministicMatrix = model.getTransitionMatrix().selectRowsFromRowGroups(this->optimalChoices, true);
                    storm::storage::SparseMatrix<ValueType> deterministicBackwardTransitions = deterministicMatrix.transpose();
-                   std::vector<ValueType> deterministicStateRewards(deterministicMatrix.getRowCount());
                    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
 
-                   // We compute an estimate for the results of the individual objectives which is obtained from the weighted result and the result of the objectives computed so far.
+                   // All objectives are evaluated under the same scheduler, i.e., their equation systems only differ in the right-hand side.
+                   // We therefore solve them all at once on the union of the maybestates of the individual objectives. This still yields a
+                   // unique solution as every such state can reach a state with reward for some objective and thus can not lie in a bottom SCC.
+                   std::vector<uint_fast64_t> consideredObjectives;
+                   std::vector<std::vector<ValueType>> deterministicStateRewards;
+                   storm::storage::BitVector maybeStates(deterministicMatrix.getRowCount(), false);
+                   boost::optional<ValueType> lowerResultBound, upperResultBound;
+                   bool allObjectivesHaveLowerBound = true;
+                   bool allObjectivesHaveUpperBound = true;
+
+                   // We compute an estimate for the results of the individual objectives which is obtained from the weighted result.
                    // Note that weightedResult = Sum_{i=1}^{n} w_i * objectiveResult_i.
-                   std::vector<ValueType> weightedSumOfUncheckedObjectives = weightedResult;
-                   ValueType sumOfWeightsOfUncheckedObjectives = storm::utility::vector::sum_if(weightVector, objectivesWithNoUpperTimeBound);
+                   ValueType sumOfWeights = storm::utility::vector::sum_if(weightVector, objectivesWithNoUpperTimeBound);
 
-                   for (uint_fast64_t const &objIndex : storm::utility::vector::getSortedIndices(weightVector)) {
+                   for (uint_fast64_t objIndex = 0; objIndex < objectives.size(); ++objIndex) {
                        auto const& obj = objectives[objIndex];
                        if (objectivesWithNoUpperTimeBound.get(objIndex)) {
                            offsetsToUnderApproximation[objIndex] = storm::utility::zero<ValueType>();
                            offsetsToOverApproximation[objIndex] = storm::utility::zero<ValueType>();
-                           storm::utility::vector::selectVectorValues(deterministicStateRewards, this->optimalChoices, model.getTransitionMatrix().getRowGroupIndices(), discreteActionRewards[objIndex]);
-                           storm::storage::BitVector statesWithRewards = ~storm::utility::vector::filterZero(deterministicStateRewards);
+                           consideredObjectives.push_back(objIndex);
+                           deterministicStateRewards.emplace_back(deterministicMatrix.getRowCount());
+                           storm::utility::vector::selectVectorValues(deterministicStateRewards.back(), this->optimalChoices, model.getTransitionMatrix().getRowGroupIndices(), discreteActionRewards[objIndex]);
+                           storm::storage::BitVector statesWithRewards = ~storm::utility::vector::filterZero(deterministicStateRewards.back());
                            // As maybestates we pick the states from which a state with reward is reachable
-                           storm::storage::BitVector maybeStates = storm::utility::graph::performProbGreater0(deterministicBackwardTransitions, storm::storage::BitVector(deterministicMatrix.getRowCount(), true), statesWithRewards);
+                           maybeStates |= storm::utility::graph::performProbGreater0(deterministicBackwardTransitions, storm::storage::BitVector(deterministicMatrix.getRowCount(), true), statesWithRewards);
 
                            // Compute the estimate for this objective
                            if (!storm::utility::isZero(weightVector[objIndex])) {
-                               objectiveResults[objIndex] = weightedSumOfUncheckedObjectives;
-                               ValueType scalingFactor = storm::utility::one<ValueType>() / sumOfWeightsOfUncheckedObjectives;
+                               objectiveResults[objIndex] = weightedResult;
+                               ValueType scalingFactor = storm::utility::one<ValueType>() / sumOfWeights;
                                if (storm::solver::minimize(obj.formula->getOptimalityType())) {
                                    scalingFactor *= -storm::utility::one<ValueType>();
                                }
@@ -247,41 +258,63 @@ namespace storm {
                            // Make sure that the objectiveResult is initialized correctly
                            objectiveResults[objIndex].resize(model.getNumberOfStates(), storm::utility::zero<ValueType>());
 
-                           if (!maybeStates.empty()) {
-                               storm::storage::SparseMatrix<ValueType> submatrix = deterministicMatrix.getSubmatrix(
-                                       true, maybeStates, maybeStates, true);
-                               // Converting the matrix from the fixpoint notation to the form needed for the equation
-                               // system. That is, we go from x = A*x + b to (I-A)x = b.
-                               submatrix.convertToEquationSystem();
-
-                               // Prepare solution vector and rhs of the equation system.
-                               std::vector<ValueType> x = storm::utility::vector::filterVector(objectiveResults[objIndex], maybeStates);
-                               std::vector<ValueType> b = storm::utility::vector::filterVector(deterministicStateRewards, maybeStates);
+                           // The bounds of the solver have to be valid for all objectives.
+                           if (obj.lowerResultBound && allObjectivesHaveLowerBound) {
+                               lowerResultBound = lowerResultBound ? std::min(*lowerResultBound, *obj.lowerResultBound) : *obj.lowerResultBound;
+                           } else {
+                               allObjectivesHaveLowerBound = false;
+                           }
+                           if (obj.upperResultBound && allObjectivesHaveUpperBound) {
+                               upperResultBound = upperResultBound ? std::max(*upperResultBound, *obj.upperResultBound) : *obj.upperResultBound;
+                           } else {
+                               allObjectivesHaveUpperBound = false;
+                           }
+                       } else {
+                           objectiveResults[objIndex] = std::vector<ValueType>(model.getNumberOfStates(), storm::utility::zero<ValueType>());
+                       }
+                   }
 
-                               // Now solve the resulting equation system.
-                               std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(std::move(submatrix));
-                               if (obj.lowerResultBound) {
-                                   solver->setLowerBound(*obj.lowerResultBound);
-                               }
-                               if (obj.upperResultBound) {
-                                   solver->setUpperBound(*obj.upperResultBound);
-                               }
-                               solver->solveEquations(x, b);
+                   if (!maybeStates.empty()) {
+                       storm::storage::SparseMatrix<ValueType> submatrix = deterministicMatrix.getSubmatrix(true, maybeStates, maybeStates, true);
+                       // Converting the matrix from the fixpoint notation to the form needed for the equation
+                       // system. That is, we go from x = A*x + b to (I-A)x = b.
+                       submatrix.convertToEquationSystem();
 
-                               // Set the result for this objective accordingly
-                               storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], maybeStates, x);
+                       // Prepare the block of solution vectors and right-hand sides. The values of the different objectives are interleaved.
+                       uint_fast64_t numberOfSystems = consideredObjectives.size();
+                       std::vector<ValueType> x(maybeStates.getNumberOfSetBits() * numberOfSystems);
+                       std::vector<ValueType> b(x.size());
+                       uint_fast64_t rowOffset = 0;
+                       for (auto const& state : maybeStates) {
+                           for (uint_fast64_t system = 0; system < numberOfSystems; ++system) {
+                               x[rowOffset + system] = objectiveResults[consideredObjectives[system]][state];
+                               b[rowOffset + system] = deterministicStateRewards[system][state];
                            }
-                           storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], ~maybeStates, storm::utility::zero<ValueType>());
+                           rowOffset += numberOfSystems;
+                       }
 
-                           // Update the estimate for the next objectives.
-                           if (!storm::utility::isZero(weightVector[objIndex])) {
-                               storm::utility::vector::addScaledVector(weightedSumOfUncheckedObjectives, objectiveResults[objIndex], -weightVector[objIndex]);
-                               sumOfWeightsOfUncheckedObjectives -= weightVector[objIndex];
+                       // Now solve the resulting equation systems.
+                       std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(std::move(submatrix));
+                       if (allObjectivesHaveLowerBound) {
+                           solver->setLowerBound(*lowerResultBound);
+                       }
+                       if (allObjectivesHaveUpperBound) {
+                           solver->setUpperBound(*upperResultBound);
+                       }
+                       solver->solveEquationsMultiple(x, b, numberOfSystems);
+
+                       // Set the results for the objectives accordingly
+                       rowOffset = 0;
+                       for (auto const& state : maybeStates) {
+                           for (uint_fast64_t system = 0; system < numberOfSystems; ++system) {
+                               objectiveResults[consideredObjectives[system]][state] = x[rowOffset + system];
                            }
-                       } else {
-                           objectiveResults[objIndex] = std::vector<ValueType>(model.getNumberOfStates(), storm::utility::zero<ValueType>());
+                           rowOffset += numberOfSystems;
                        }
                    }
+                   for (auto const& objIndex : consideredObjectives) {
+                       storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], ~maybeStates, storm::utility::zero<ValueType>());
+                   }
                }
             }
             
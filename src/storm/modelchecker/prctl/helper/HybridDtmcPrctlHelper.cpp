@@ -3,6 +3,7 @@
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/SymbolicLinearEquationSolver.h"
 
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
@@ -11,6 +12,10 @@
 
 #include "storm/utility/graph.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/dd.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
 
@@ -23,6 +28,18 @@
 namespace storm {
     namespace modelchecker {
         namespace helper {
+            namespace detail {
+                /*!
+                 * Retrieves the memory budget for explicit representations in bytes, if one was set.
+                 */
+                boost::optional<uint64_t> getMemoryBudget() {
+                    auto const& coreSettings = storm::settings::getModule<storm::settings::modules::CoreSettings>();
+                    if (coreSettings.isHybridMemoryBudgetSet()) {
+                        return coreSettings.getHybridMemoryBudget();
+                    }
+                    return boost::none;
+                }
+            }
 
             template<storm::dd::DdType DdType, typename ValueType>
             std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUntilProbabilities(storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& phiStates, storm::dd::Bdd<DdType> const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
@@ -41,9 +58,6 @@ namespace storm {
                 } else {
                     // If there are maybe states, we need to solve an equation system.
                     if (!maybeStates.isZero()) {
-                        // Create the ODD for the translation between symbolic and explicit storage.
-                        storm::dd::Odd odd = maybeStates.createOdd();
-                        
                         // Create the matrix and the vector for the equation system.
                         storm::dd::Add<DdType, ValueType> maybeStatesAdd = maybeStates.template toAdd<ValueType>();
                         
@@ -58,12 +72,25 @@ namespace storm {
                         storm::dd::Add<DdType, ValueType> subvector = submatrix * prob1StatesAsColumn;
                         subvector = subvector.sumAbstract(model.getColumnVariables());
 
+                        // Cut away all columns targeting non-maybe states.
+                        submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+                        
+                        // If the explicit equation system would exceed the memory budget, we solve it block-wise.
+                        boost::optional<uint64_t> budget = detail::getMemoryBudget();
+                        if (budget && storm::utility::dd::estimateExplicitMatrixSize(submatrix, model.getColumnVariables()) > budget.get()) {
+                            STORM_LOG_INFO("Explicit equation system exceeds the memory budget, solving it block-wise.");
+                            storm::dd::Add<DdType, ValueType> result = solveEquationSystemWithinBudget(model, submatrix, subvector, maybeStates, storm::utility::one<ValueType>(), linearEquationSolverFactory, budget.get(), storm::settings::getModule<storm::settings::modules::CoreSettings>().getHybridMinimalBlockSize());
+                            return std::unique_ptr<CheckResult>(new storm::modelchecker::SymbolicQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), statesWithProbability01.second.template toAdd<ValueType>() + result));
+                        }
+                        
+                        // Create the ODD for the translation between symbolic and explicit storage.
+                        storm::dd::Odd odd = maybeStates.createOdd();
+                        
                         // Check whether we need to create an equation system.
                         bool convertToEquationSystem = linearEquationSolverFactory.getEquationProblemFormat() == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
                         
-                        // Finally cut away all columns targeting non-maybe states and potentially convert the matrix
-                        // into the matrix needed for solving the equation system (i.e. compute (I-A)).
-                        submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+                        // Potentially convert the matrix into the matrix needed for solving the equation system (i.e.
+                        // compute (I-A)).
                         if (convertToEquationSystem) {
                             submatrix = (model.getRowColumnIdentity() * maybeStatesAdd) - submatrix;
                         }
@@ -215,9 +242,6 @@ namespace storm {
                 } else {
                     // If there are maybe states, we need to solve an equation system.
                     if (!maybeStates.isZero()) {
-                        // Create the ODD for the translation between symbolic and explicit storage.
-                        storm::dd::Odd odd = maybeStates.createOdd();
-                        
                         // Create the matrix and the vector for the equation system.
                         storm::dd::Add<DdType, ValueType> maybeStatesAdd = maybeStates.template toAdd<ValueType>();
                         
@@ -228,12 +252,25 @@ namespace storm {
                         // Then compute the state reward vector to use in the computation.
                         storm::dd::Add<DdType, ValueType> subvector = rewardModel.getTotalRewardVector(maybeStatesAdd, submatrix, model.getColumnVariables());
 
+                        // Cut away all columns targeting non-maybe states.
+                        submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+                        
+                        // If the explicit equation system would exceed the memory budget, we solve it block-wise.
+                        boost::optional<uint64_t> budget = detail::getMemoryBudget();
+                        if (budget && storm::utility::dd::estimateExplicitMatrixSize(submatrix, model.getColumnVariables()) > budget.get()) {
+                            STORM_LOG_INFO("Explicit equation system exceeds the memory budget, solving it block-wise.");
+                            storm::dd::Add<DdType, ValueType> result = solveEquationSystemWithinBudget(model, submatrix, subvector, maybeStates, boost::none, linearEquationSolverFactory, budget.get(), storm::settings::getModule<storm::settings::modules::CoreSettings>().getHybridMinimalBlockSize());
+                            return std::unique_ptr<CheckResult>(new storm::modelchecker::SymbolicQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), infinityStates.ite(model.getManager().getConstant(storm::utility::infinity<ValueType>()), model.getManager().template getAddZero<ValueType>()) + result));
+                        }
+                        
+                        // Create the ODD for the translation between symbolic and explicit storage.
+                        storm::dd::Odd odd = maybeStates.createOdd();
+                        
                         // Check whether we need to create an equation system.
                         bool convertToEquationSystem = linearEquationSolverFactory.getEquationProblemFormat() == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
                         
-                        // Finally cut away all columns targeting non-maybe states and potentially convert the matrix
-                        // into the matrix needed for solving the equation system (i.e. compute (I-A)).
-                        submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+                        // Potentially convert the matrix into the matrix needed for solving the equation system (i.e.
+                        // compute (I-A)).
                         if (convertToEquationSystem) {
                             submatrix = (model.getRowColumnIdentity() * maybeStatesAdd) - submatrix;
                         }
@@ -278,6 +315,59 @@ namespace storm {
                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), std::move(odd), std::move(result)));
             }
             
+            template<storm::dd::DdType DdType, typename ValueType>
+            storm::dd::Add<DdType, ValueType> HybridDtmcPrctlHelper<DdType, ValueType>::solveEquationSystemWithinBudget(storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& submatrix, storm::dd::Add<DdType, ValueType> const& subvector, storm::dd::Bdd<DdType> const& maybeStates, boost::optional<ValueType> const& upperBound, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, uint64_t budget, uint64_t minimalBlockSize) {
+                storm::dd::DdManager<DdType> const& manager = model.getManager();
+                std::vector<storm::dd::Bdd<DdType>> blocks = storm::utility::dd::computeTopologicalSccBlocks(maybeStates, submatrix.notZero(), model.getRowVariables(), model.getColumnVariables(), minimalBlockSize);
+                
+                storm::dd::Add<DdType, ValueType> result = manager.template getAddZero<ValueType>();
+                uint64_t numberOfExplicitBlocks = 0;
+                for (auto const& block : blocks) {
+                    storm::dd::Add<DdType, ValueType> blockAdd = block.template toAdd<ValueType>();
+                    storm::dd::Add<DdType, ValueType> blockRows = submatrix * blockAdd;
+                    
+                    // Since the blocks are solved in topological order, all transitions leaving the block lead to states
+                    // whose values are already known and can be moved to the right-hand side.
+                    storm::dd::Add<DdType, ValueType> blockVector = subvector * blockAdd + blockRows.multiplyMatrix(result.swapVariables(model.getRowColumnMetaVariablePairs()), model.getColumnVariables());
+                    storm::dd::Add<DdType, ValueType> blockMatrix = blockRows * blockAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+                    
+                    if (storm::utility::dd::estimateExplicitMatrixSize(blockMatrix, model.getColumnVariables()) <= budget) {
+                        if (linearEquationSolverFactory.getEquationProblemFormat() == storm::solver::LinearEquationSolverProblemFormat::EquationSystem) {
+                            blockMatrix = (model.getRowColumnIdentity() * blockAdd) - blockMatrix;
+                        }
+                        
+                        storm::dd::Odd odd = block.createOdd();
+                        std::vector<ValueType> x(odd.getTotalOffset(), storm::utility::convertNumber<ValueType>(0.5));
+                        std::vector<ValueType> b = blockVector.toVector(odd);
+                        
+                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(blockMatrix.toMatrix(odd, odd));
+                        solver->setLowerBound(storm::utility::zero<ValueType>());
+                        if (upperBound) {
+                            solver->setUpperBound(upperBound.get());
+                        }
+                        solver->solveEquations(x, b);
+                        
+                        result += storm::dd::Add<DdType, ValueType>::fromVector(manager, x, odd, model.getRowVariables());
+                        ++numberOfExplicitBlocks;
+                    } else {
+                        storm::solver::GeneralSymbolicLinearEquationSolverFactory<DdType, ValueType> symbolicLinearEquationSolverFactory;
+                        if (symbolicLinearEquationSolverFactory.getEquationProblemFormat() == storm::solver::LinearEquationSolverProblemFormat::EquationSystem) {
+                            blockMatrix = (model.getRowColumnIdentity() * blockAdd) - blockMatrix;
+                        }
+                        
+                        std::unique_ptr<storm::solver::SymbolicLinearEquationSolver<DdType, ValueType>> solver = symbolicLinearEquationSolverFactory.create(blockMatrix, block, model.getRowVariables(), model.getColumnVariables(), model.getRowColumnMetaVariablePairs());
+                        solver->setLowerBound(storm::utility::zero<ValueType>());
+                        if (upperBound) {
+                            solver->setUpperBound(upperBound.get());
+                        }
+                        result += solver->solveEquations(manager.template getAddZero<ValueType>(), blockVector);
+                    }
+                }
+                STORM_LOG_INFO("Solved " << numberOfExplicitBlocks << " of " << blocks.size() << " block(s) explicitly and the remaining ones symbolically.");
+                
+                return result;
+            }
+            
             template class HybridDtmcPrctlHelper<storm::dd::DdType::CUDD, double>;
             template class HybridDtmcPrctlHelper<storm::dd::DdType::Sylvan, double>;
 
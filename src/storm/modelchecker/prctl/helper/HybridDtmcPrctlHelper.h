@@ -1,6 +1,8 @@
 #ifndef STORM_MODELCHECKER_HYBRID_DTMC_PRCTL_MODELCHECKER_HELPER_H_
 #define STORM_MODELCHECKER_HYBRID_DTMC_PRCTL_MODELCHECKER_HELPER_H_
 
+#include <boost/optional.hpp>
+
 #include "storm/models/symbolic/Model.h"
 
 #include "storm/storage/dd/Add.h"
@@ -38,6 +40,21 @@ namespace storm {
 
                 static std::unique_ptr<CheckResult> computeLongRunAverageRewards(storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, RewardModelType const& rewardModel, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory);
 
+            private:
+                /*!
+                 * Solves the equation system x = A*x + b over the given maybe states whose explicit representation does
+                 * not fit into the given memory budget. The system is decomposed into (blocks of) SCCs that are solved in
+                 * topological order. Every block that fits into the budget is translated and solved explicitly while all
+                 * other blocks are solved symbolically.
+                 *
+                 * @param submatrix The matrix A restricted to the maybe states (in rows and columns).
+                 * @param subvector The vector b.
+                 * @param upperBound If given, an upper bound on the solution.
+                 * @param budget The memory budget in bytes.
+                 * @param minimalBlockSize The minimal number of states of the blocks into which the SCCs are merged.
+                 * @return The solution for the maybe states.
+                 */
+                static storm::dd::Add<DdType, ValueType> solveEquationSystemWithinBudget(storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& submatrix, storm::dd::Add<DdType, ValueType> const& subvector, storm::dd::Bdd<DdType> const& maybeStates, boost::optional<ValueType> const& upperBound, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, uint64_t budget, uint64_t minimalBlockSize);
             };
             
         }
@@ -10,6 +10,10 @@
 
 #include "storm/utility/graph.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/dd.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
 
@@ -28,6 +32,42 @@
 namespace storm {
     namespace modelchecker {
         namespace helper {
+            namespace detail {
+                /*!
+                 * Retrieves whether the explicit representation of the given matrix restricted to the maybe states
+                 * exceeds the memory budget of the hybrid engine (if one was set).
+                 */
+                template<storm::dd::DdType DdType, typename ValueType>
+                bool exceedsMemoryBudget(storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& maybeStates) {
+                    auto const& coreSettings = storm::settings::getModule<storm::settings::modules::CoreSettings>();
+                    if (!coreSettings.isHybridMemoryBudgetSet()) {
+                        return false;
+                    }
+                    storm::dd::Add<DdType, ValueType> maybeStatesAdd = maybeStates.template toAdd<ValueType>();
+                    storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * maybeStatesAdd * maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+                    return storm::utility::dd::estimateExplicitMatrixSize(submatrix, model.getColumnVariables()) > coreSettings.getHybridMemoryBudget();
+                }
+                
+                /*!
+                 * Creates a factory for symbolic solvers that use the same method as the solvers of the given factory
+                 * (if the symbolic solver supports it).
+                 */
+                template<storm::dd::DdType DdType, typename ValueType>
+                storm::solver::SymbolicGeneralMinMaxLinearEquationSolverFactory<DdType, ValueType> getSymbolicSolverFactory(storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
+                    typedef typename storm::solver::SymbolicMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod SymbolicSolutionMethod;
+                    storm::solver::SymbolicGeneralMinMaxLinearEquationSolverFactory<DdType, ValueType> result;
+                    switch (linearEquationSolverFactory.getMinMaxMethod()) {
+                        case storm::solver::MinMaxMethod::ValueIteration: result.getSettings().setSolutionMethod(SymbolicSolutionMethod::ValueIteration); break;
+                        case storm::solver::MinMaxMethod::PolicyIteration: result.getSettings().setSolutionMethod(SymbolicSolutionMethod::PolicyIteration); break;
+                        case storm::solver::MinMaxMethod::RationalSearch: result.getSettings().setSolutionMethod(SymbolicSolutionMethod::RationalSearch); break;
+                        case storm::solver::MinMaxMethod::IntervalIteration: result.getSettings().setSolutionMethod(SymbolicSolutionMethod::IntervalIteration); break;
+                        default:
+                            STORM_LOG_WARN("The selected min/max method is not supported by the symbolic solver, falling back to value iteration.");
+                            result.getSettings().setSolutionMethod(SymbolicSolutionMethod::ValueIteration);
+                    }
+                    return result;
+                }
+            }
             
             template<typename ValueType>
             struct SolverRequirementsData {
@@ -135,6 +175,12 @@ namespace storm {
                 } else {
                     // If there are maybe states, we need to solve an equation system.
                     if (!maybeStates.isZero()) {
+                        // If the explicit equation system would exceed the memory budget, we solve it symbolically.
+                        if (detail::exceedsMemoryBudget(model, transitionMatrix, maybeStates)) {
+                            STORM_LOG_INFO("Explicit equation system exceeds the memory budget, solving it symbolically.");
+                            return SymbolicMdpPrctlHelper<DdType, ValueType>::computeUntilProbabilities(dir, model, transitionMatrix, phiStates, psiStates, qualitative, detail::getSymbolicSolverFactory<DdType, ValueType>(linearEquationSolverFactory));
+                        }
+                        
                         // If we minimize, we know that the solution to the equation system is unique.
                         bool uniqueSolution = dir == storm::solver::OptimizationDirection::Minimize;
                         // Check for requirements of the solver early so we can adjust the maybe state computation accordingly.
@@ -493,6 +539,12 @@ namespace storm {
                 } else {
                     // If there are maybe states, we need to solve an equation system.
                     if (!maybeStates.isZero()) {
+                        // If the explicit equation system would exceed the memory budget, we solve it symbolically.
+                        if (detail::exceedsMemoryBudget(model, transitionMatrix, maybeStates)) {
+                            STORM_LOG_INFO("Explicit equation system exceeds the memory budget, solving it symbolically.");
+                            return SymbolicMdpPrctlHelper<DdType, ValueType>::computeReachabilityRewards(dir, model, transitionMatrix, rewardModel, targetStates, qualitative, detail::getSymbolicSolverFactory<DdType, ValueType>(linearEquationSolverFactory));
+                        }
+                        
                         // If we maximize, we know that the solution to the equation system is unique.
                         bool uniqueSolution = dir == storm::solver::OptimizationDirection::Maximize;
                         // Check for requirements of the solver this early so we can adapt the maybe states accordingly.
@@ -42,6 +42,40 @@ namespace storm {
                 return result;
             }
             
+            /*!
+             * Checks whether the maybe states contain no end component, i.e. whether all schedulers leave the maybe
+             * states with probability one.
+             */
+            template<storm::dd::DdType DdType, typename ValueType>
+            bool hasNoEndComponents(storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& maybeStates) {
+                storm::dd::Bdd<DdType> transitionMatrixBdd = transitionMatrix.notZero();
+                storm::dd::Bdd<DdType> otherStates = model.getReachableStates() && !maybeStates;
+                storm::dd::Bdd<DdType> statesWithProbabilityGreater0A = storm::utility::graph::performProbGreater0A(model, transitionMatrixBdd, maybeStates, otherStates);
+                storm::dd::Bdd<DdType> statesWithProbability1A = storm::utility::graph::performProb1A(model, transitionMatrixBdd, otherStates, statesWithProbabilityGreater0A);
+                return (maybeStates && !statesWithProbability1A).isZero();
+            }
+            
+            /*!
+             * Creates a solver for the given equation system. If the solution method of the factory requires the absence
+             * of end components, but the maybe states contain some, a value iteration solver (with otherwise unchanged
+             * settings) is created instead.
+             */
+            template<storm::dd::DdType DdType, typename ValueType>
+            std::unique_ptr<storm::solver::SymbolicMinMaxLinearEquationSolver<DdType, ValueType>> createSolver(OptimizationDirection dir, bool hasUniqueSolution, storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Add<DdType, ValueType> const& submatrix, storm::dd::Bdd<DdType> const& maybeStates, storm::solver::SymbolicGeneralMinMaxLinearEquationSolverFactory<DdType, ValueType> const& linearEquationSolverFactory) {
+                std::unique_ptr<storm::solver::SymbolicMinMaxLinearEquationSolver<DdType, ValueType>> solver = linearEquationSolverFactory.create(submatrix, maybeStates, model.getIllegalMask() && maybeStates, model.getRowVariables(), model.getColumnVariables(), model.getNondeterminismVariables(), model.getRowColumnMetaVariablePairs());
+                solver->setHasUniqueSolution(hasUniqueSolution);
+                
+                if (solver->getRequirements(dir).requires(storm::solver::MinMaxLinearEquationSolverRequirements::Element::NoEndComponents) && !hasNoEndComponents(model, transitionMatrix, maybeStates)) {
+                    STORM_LOG_WARN("The selected solution method requires the absence of end components, but the maybe states contain end components. Falling back to value iteration.");
+                    storm::solver::SymbolicGeneralMinMaxLinearEquationSolverFactory<DdType, ValueType> valueIterationFactory(linearEquationSolverFactory);
+                    valueIterationFactory.getSettings().setSolutionMethod(storm::solver::SymbolicMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::ValueIteration);
+                    solver = valueIterationFactory.create(submatrix, maybeStates, model.getIllegalMask() && maybeStates, model.getRowVariables(), model.getColumnVariables(), model.getNondeterminismVariables(), model.getRowColumnMetaVariablePairs());
+                    solver->setHasUniqueSolution(hasUniqueSolution);
+                }
+                
+                return solver;
+            }
+            
             template<storm::dd::DdType DdType, typename ValueType>
             std::unique_ptr<CheckResult> SymbolicMdpPrctlHelper<DdType, ValueType>::computeUntilProbabilities(OptimizationDirection dir, storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& phiStates, storm::dd::Bdd<DdType> const& psiStates, bool qualitative, storm::solver::SymbolicGeneralMinMaxLinearEquationSolverFactory<DdType, ValueType> const& linearEquationSolverFactory) {
                 // We need to identify the states which have to be taken out of the matrix, i.e. all states that have
@@ -82,12 +116,8 @@ namespace storm {
                         submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
                         
                         // Now solve the resulting equation system.
-                        std::unique_ptr<storm::solver::SymbolicMinMaxLinearEquationSolver<DdType, ValueType>> solver = linearEquationSolverFactory.create(submatrix, maybeStates, model.getIllegalMask() && maybeStates, model.getRowVariables(), model.getColumnVariables(), model.getNondeterminismVariables(), model.getRowColumnMetaVariablePairs());
-
-                        // If we minimize, we know that the solution is unique
-                        if (dir == storm::solver::OptimizationDirection::Minimize) {
-                            solver->setHasUniqueSolution();
-                        }
+                        // If we minimize, we know that the solution is unique.
+                        std::unique_ptr<storm::solver::SymbolicMinMaxLinearEquationSolver<DdType, ValueType>> solver = createSolver(dir, dir == storm::solver::OptimizationDirection::Minimize, model, transitionMatrix, submatrix, maybeStates, linearEquationSolverFactory);
                         
                         // Check requirements of solver.
                         storm::solver::MinMaxLinearEquationSolverRequirements requirements = solver->getRequirements(dir);
@@ -98,6 +128,10 @@ namespace storm {
                                 initialScheduler = computeValidSchedulerHint(EquationSystemType::UntilProbabilities, model, transitionMatrix, maybeStates, statesWithProbability01.second);
                                 requirements.clearValidInitialScheduler();
                             }
+                            if (requirements.requires(storm::solver::MinMaxLinearEquationSolverRequirements::Element::NoEndComponents)) {
+                                // The absence of end components was established when creating the solver.
+                                requirements.clearNoEndComponents();
+                            }
                             requirements.clearBounds();
                             STORM_LOG_THROW(requirements.empty(), storm::exceptions::UncheckedRequirementException, "Could not establish requirements of solver.");
                         }
@@ -246,12 +280,8 @@ namespace storm {
                         submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
                         
                         // Now solve the resulting equation system.
-                        std::unique_ptr<storm::solver::SymbolicMinMaxLinearEquationSolver<DdType, ValueType>> solver = linearEquationSolverFactory.create(submatrix, maybeStates, model.getIllegalMask() && maybeStates, model.getRowVariables(), model.getColumnVariables(), model.getNondeterminismVariables(), model.getRowColumnMetaVariablePairs());
-                        
-                        // If we maximize, we know that the solution is unique
-                        if (dir == storm::solver::OptimizationDirection::Maximize) {
-                            solver->setHasUniqueSolution();
-                        }
+                        // If we maximize, we know that the solution is unique.
+                        std::unique_ptr<storm::solver::SymbolicMinMaxLinearEquationSolver<DdType, ValueType>> solver = createSolver(dir, dir == storm::solver::OptimizationDirection::Maximize, model, transitionMatrix, submatrix, maybeStates, linearEquationSolverFactory);
                         
                         // Check requirements of solver.
                         storm::solver::MinMaxLinearEquationSolverRequirements requirements = solver->getRequirements(dir);
@@ -262,6 +292,10 @@ namespace storm {
                                 initialScheduler = computeValidSchedulerHint(EquationSystemType::ExpectedRewards, model, transitionMatrix, maybeStates, targetStates);
                                 requirements.clearValidInitialScheduler();
                             }
+                            if (requirements.requires(storm::solver::MinMaxLinearEquationSolverRequirements::Element::NoEndComponents)) {
+                                // The absence of end components was established when creating the solver.
+                                requirements.clearNoEndComponents();
+                            }
                             requirements.clearLowerBounds();
                             STORM_LOG_THROW(requirements.empty(), storm::exceptions::UncheckedRequirementException, "Could not establish requirements of solver.");
                         }
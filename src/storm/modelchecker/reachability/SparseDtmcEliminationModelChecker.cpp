@@ -3,6 +3,14 @@
 #include <algorithm>
 #include <random>
 #include <chrono>
+#include <type_traits>
+
+// To detect whether the usage of TBB is possible, this include is neccessary
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/tbb.h"
+#endif
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -810,6 +818,12 @@ namespace storm {
         template<typename SparseDtmcModelType>
         void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performPrioritizedStateElimination(std::shared_ptr<StatePriorityQueue>& priorityQueue, storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values, storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly) {
             
+            // Rational functions share a global cache and can therefore not be manipulated concurrently.
+            if (std::is_same<ValueType, double>::value && priorityQueue->hasStaticPriorities() && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                performParallelPrioritizedStateElimination(priorityQueue, transitionMatrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
+                return;
+            }
+            
             storm::solver::stateelimination::PrioritizedStateEliminator<ValueType> stateEliminator(transitionMatrix, backwardTransitions, priorityQueue, values);
             
             while (priorityQueue->hasNext()) {
@@ -825,6 +839,97 @@ namespace storm {
             }
         }
         
+        template<typename SparseDtmcModelType>
+        void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performParallelPrioritizedStateElimination(std::shared_ptr<StatePriorityQueue>& priorityQueue, storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values, storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly) {
+#ifdef STORM_HAVE_INTELTBB
+            // Eliminating a state only reads and writes the rows (and values) of the state itself and its direct
+            // predecessors and successors. Hence, states whose neighbourhoods are pairwise disjoint can be eliminated
+            // concurrently and the result equals the one of eliminating them one after another. We therefore cut the
+            // sequence of states given by the queue into maximal batches of such independent states.
+            storm::storage::BitVector touchedStates(transitionMatrix.getRowCount());
+            std::vector<storm::storage::sparse::state_type> touchedStatesList;
+            std::vector<storm::storage::sparse::state_type> batch;
+            boost::optional<storm::storage::sparse::state_type> pendingState;
+            uint_fast64_t numberOfBatches = 0;
+            
+            auto isIndependent = [&] (storm::storage::sparse::state_type const& state) {
+                if (touchedStates.get(state)) {
+                    return false;
+                }
+                for (auto const& entry : transitionMatrix.getRow(state)) {
+                    if (touchedStates.get(entry.getColumn())) {
+                        return false;
+                    }
+                }
+                for (auto const& entry : backwardTransitions.getRow(state)) {
+                    if (touchedStates.get(entry.getColumn())) {
+                        return false;
+                    }
+                }
+                return true;
+            };
+            auto touch = [&] (storm::storage::sparse::state_type const& state) {
+                if (!touchedStates.get(state)) {
+                    touchedStates.set(state);
+                    touchedStatesList.push_back(state);
+                }
+            };
+            
+            while (pendingState || priorityQueue->hasNext()) {
+                // Collect the next batch of independent states.
+                while (pendingState || priorityQueue->hasNext()) {
+                    storm::storage::sparse::state_type state = pendingState ? pendingState.get() : priorityQueue->pop();
+                    pendingState = boost::none;
+                    if (!isIndependent(state)) {
+                        pendingState = state;
+                        break;
+                    }
+                    
+                    touch(state);
+                    for (auto const& entry : transitionMatrix.getRow(state)) {
+                        touch(entry.getColumn());
+                    }
+                    for (auto const& entry : backwardTransitions.getRow(state)) {
+                        touch(entry.getColumn());
+                    }
+                    batch.push_back(state);
+                }
+                
+                tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, batch.size()), [&] (tbb::blocked_range<uint_fast64_t> const& range) {
+                    // Every task uses its own eliminator, because the eliminators keep scratch buffers.
+                    storm::solver::stateelimination::PrioritizedStateEliminator<ValueType> stateEliminator(transitionMatrix, backwardTransitions, priorityQueue, values);
+                    for (uint_fast64_t index = range.begin(); index != range.end(); ++index) {
+                        storm::storage::sparse::state_type state = batch[index];
+                        bool removeForwardTransitions = computeResultsForInitialStatesOnly && !initialStates.get(state);
+                        stateEliminator.eliminateState(state, removeForwardTransitions);
+                        if (removeForwardTransitions) {
+                            values[state] = storm::utility::zero<ValueType>();
+                        }
+                    }
+                });
+                ++numberOfBatches;
+                
+                for (auto const& state : touchedStatesList) {
+                    touchedStates.set(state, false);
+                }
+                touchedStatesList.clear();
+                batch.clear();
+            }
+            STORM_LOG_DEBUG("Eliminated states in " << numberOfBatches << " batches of independent states.");
+#else
+            STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential elimination.");
+            storm::solver::stateelimination::PrioritizedStateEliminator<ValueType> stateEliminator(transitionMatrix, backwardTransitions, priorityQueue, values);
+            while (priorityQueue->hasNext()) {
+                storm::storage::sparse::state_type state = priorityQueue->pop();
+                bool removeForwardTransitions = computeResultsForInitialStatesOnly && !initialStates.get(state);
+                stateEliminator.eliminateState(state, removeForwardTransitions);
+                if (removeForwardTransitions) {
+                    values[state] = storm::utility::zero<ValueType>();
+                }
+            }
+#endif
+        }
+        
         template<typename SparseDtmcModelType>
         void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performOrdinaryStateElimination(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, storm::storage::BitVector const& subsystem, storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly, std::vector<ValueType>& values, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
             std::shared_ptr<StatePriorityQueue> statePriorities = createStatePriorityQueue(distanceBasedPriorities, transitionMatrix, backwardTransitions, values, subsystem);
@@ -117,9 +117,11 @@ namespace storm {
             }
             STORM_LOG_THROW(parsedStructure.count("automata") == 1, storm::exceptions::InvalidJaniException, "Exactly one list of automata must be given");
             STORM_LOG_THROW(parsedStructure.at("automata").is_array(), storm::exceptions::InvalidJaniException, "Automata must be an array");
-            // Automatons can only be parsed after constants and variables.
-            for (auto const& automataEntry : parsedStructure.at("automata")) {
+            // Automatons can only be parsed after constants and variables. As the structure of an automaton is not
+            // needed anymore once the automaton is built, it is released right away to reduce the peak memory usage.
+            for (auto& automataEntry : parsedStructure.at("automata")) {
                 model.addAutomaton(parseAutomaton(automataEntry, model, globalVars, constants));
+                automataEntry = json();
             }
             STORM_LOG_THROW(parsedStructure.count("restrict-initial") < 2, storm::exceptions::InvalidJaniException, "Model has multiple initial value restrictions");
             storm::expressions::Expression initialValueRestriction = expressionManager->boolean(true);
@@ -706,14 +708,28 @@ namespace storm {
             STORM_LOG_THROW(expected == actual, storm::exceptions::InvalidJaniException, "Operator " << opstring  << " expects " << expected << " arguments, but got " << actual << " in " << errorInfo << ".");
         }
 
+        /**
+         * Helper for parse expression. Parses an argument of the given operator with the given function. Instead of
+         * building a scope description for every (nested) argument upfront, the argument is only named in the message
+         * of an error that occurs while parsing it.
+         */
+        template<typename ParseFunction>
+        storm::expressions::Expression parseOperatorArgument(ParseFunction const& parse, std::string const& argumentDescription, std::string const& opstring) {
+            try {
+                return parse();
+            } catch (storm::exceptions::InvalidJaniException const& e) {
+                throw storm::exceptions::InvalidJaniException(e) << " [in " << argumentDescription << " of operator " << opstring << "]";
+            }
+        }
+
         std::vector<storm::expressions::Expression> JaniParser::parseUnaryExpressionArguments(json const& expressionDecl, std::string const& opstring, std::string const& scopeDescription, std::unordered_map<std::string, std::shared_ptr<storm::jani::Variable>> const& globalVars, std::unordered_map<std::string, std::shared_ptr<storm::jani::Constant>> const& constants,  std::unordered_map<std::string, std::shared_ptr<storm::jani::Variable>> const& localVars, bool returnNoneInitializedOnUnknownOperator) {
-            storm::expressions::Expression left = parseExpression(expressionDecl.at("exp"), "Argument of operator " + opstring + " in " + scopeDescription, globalVars, constants, localVars,returnNoneInitializedOnUnknownOperator);
+            storm::expressions::Expression left = parseOperatorArgument([&] () { return parseExpression(expressionDecl.at("exp"), scopeDescription, globalVars, constants, localVars,returnNoneInitializedOnUnknownOperator); }, "argument", opstring);
             return {left};
         }
 
         std::vector<storm::expressions::Expression> JaniParser::parseBinaryExpressionArguments(json const& expressionDecl, std::string const& opstring, std::string const& scopeDescription, std::unordered_map<std::string, std::shared_ptr<storm::jani::Variable>> const& globalVars, std::unordered_map<std::string, std::shared_ptr<storm::jani::Constant>> const& constants,  std::unordered_map<std::string, std::shared_ptr<storm::jani::Variable>> const& localVars, bool returnNoneInitializedOnUnknownOperator) {
-            storm::expressions::Expression left = parseExpression(expressionDecl.at("left"), "Left argument of operator " + opstring + " in " + scopeDescription, globalVars, constants, localVars, returnNoneInitializedOnUnknownOperator);
-            storm::expressions::Expression right = parseExpression(expressionDecl.at("right"), "Right argument of operator " + opstring + " in " + scopeDescription,  globalVars, constants, localVars, returnNoneInitializedOnUnknownOperator);
+            storm::expressions::Expression left = parseOperatorArgument([&] () { return parseExpression(expressionDecl.at("left"), scopeDescription, globalVars, constants, localVars, returnNoneInitializedOnUnknownOperator); }, "left argument", opstring);
+            storm::expressions::Expression right = parseOperatorArgument([&] () { return parseExpression(expressionDecl.at("right"), scopeDescription, globalVars, constants, localVars, returnNoneInitializedOnUnknownOperator); }, "right argument", opstring);
             return {left, right};
         }
         /**
@@ -752,7 +768,24 @@ namespace storm {
             }
         }
 
+        storm::expressions::Expression JaniParser::internExpression(storm::expressions::Expression const& expression) {
+            // Only function applications need to be considered, because literals and variables are shared upon creation.
+            if (!expression.isInitialized() || !expression.isFunctionApplication()) {
+                return expression;
+            }
+            std::vector<storm::expressions::BaseExpression const*> operands(3, nullptr);
+            for (uint_fast64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+                operands[operandIndex] = expression.getBaseExpression().getOperand(operandIndex).get();
+            }
+            auto key = std::make_tuple(expression.getOperator(), operands[0], operands[1], operands[2]);
+            return compositeExpressions.emplace(key, expression).first->second;
+        }
+
         storm::expressions::Expression JaniParser::parseExpression(json const& expressionStructure, std::string const& scopeDescription, std::unordered_map<std::string, std::shared_ptr<storm::jani::Variable>> const& globalVars, std::unordered_map<std::string, std::shared_ptr<storm::jani::Constant>> const& constants,  std::unordered_map<std::string, std::shared_ptr<storm::jani::Variable>> const& localVars,  bool returnNoneInitializedOnUnknownOperator) {
+            return internExpression(parseExpressionStructure(expressionStructure, scopeDescription, globalVars, constants, localVars, returnNoneInitializedOnUnknownOperator));
+        }
+
+        storm::expressions::Expression JaniParser::parseExpressionStructure(json const& expressionStructure, std::string const& scopeDescription, std::unordered_map<std::string, std::shared_ptr<storm::jani::Variable>> const& globalVars, std::unordered_map<std::string, std::shared_ptr<storm::jani::Constant>> const& constants,  std::unordered_map<std::string, std::shared_ptr<storm::jani::Variable>> const& localVars,  bool returnNoneInitializedOnUnknownOperator) {
             if(expressionStructure.is_boolean()) {
                 if(expressionStructure.get<bool>()) {
                     return expressionManager->boolean(true);
@@ -760,14 +793,28 @@ namespace storm {
                     return expressionManager->boolean(false);
                 }
             } else if(expressionStructure.is_number_integer()) {
-                return expressionManager->integer(expressionStructure.get<int64_t>());
+                int64_t value = expressionStructure.get<int64_t>();
+                auto literalIt = integerExpressions.find(value);
+                if (literalIt == integerExpressions.end()) {
+                    literalIt = integerExpressions.emplace(value, expressionManager->integer(value)).first;
+                }
+                return literalIt->second;
             } else if(expressionStructure.is_number_float()) {
                 // For now, just take the double.
                 // TODO make this a rational number
-                return expressionManager->rational(expressionStructure.get<double>());
+                double value = expressionStructure.get<double>();
+                auto literalIt = rationalExpressions.find(value);
+                if (literalIt == rationalExpressions.end()) {
+                    literalIt = rationalExpressions.emplace(value, expressionManager->rational(value)).first;
+                }
+                return literalIt->second;
             } else if(expressionStructure.is_string()) {
-                std::string ident = expressionStructure.get<std::string>();
-                return storm::expressions::Expression(getVariableOrConstantExpression(ident, scopeDescription, globalVars, constants, localVars));
+                storm::expressions::Variable variable = getVariableOrConstantExpression(expressionStructure.get<std::string>(), scopeDescription, globalVars, constants, localVars);
+                auto variableIt = variableExpressions.find(variable);
+                if (variableIt == variableExpressions.end()) {
+                    variableIt = variableExpressions.emplace(variable, storm::expressions::Expression(variable)).first;
+                }
+                return variableIt->second;
             } else if(expressionStructure.is_object()) {
                 if(expressionStructure.count("distribution") == 1) {
                     STORM_LOG_THROW(false, storm::exceptions::InvalidJaniException, "Distributions are not supported by storm expressions, cannot import " << expressionStructure.dump() << " in  " << scopeDescription << ".");
@@ -779,9 +826,9 @@ namespace storm {
                         STORM_LOG_THROW(expressionStructure.count("if") == 1, storm::exceptions::InvalidJaniException, "If operator required");
                         STORM_LOG_THROW(expressionStructure.count("else") == 1, storm::exceptions::InvalidJaniException, "Else operator required");
                         STORM_LOG_THROW(expressionStructure.count("then") == 1, storm::exceptions::InvalidJaniException, "If operator required");
-                        arguments.push_back(parseExpression(expressionStructure.at("if"), "if-formula in " + scopeDescription, globalVars, constants, localVars, returnNoneInitializedOnUnknownOperator));
-                        arguments.push_back(parseExpression(expressionStructure.at("then"), "then-formula in " + scopeDescription, globalVars, constants, localVars, returnNoneInitializedOnUnknownOperator));
-                        arguments.push_back(parseExpression(expressionStructure.at("else"), "else-formula in " + scopeDescription, globalVars, constants, localVars, returnNoneInitializedOnUnknownOperator));
+                        arguments.push_back(parseOperatorArgument([&] () { return parseExpression(expressionStructure.at("if"), scopeDescription, globalVars, constants, localVars, returnNoneInitializedOnUnknownOperator); }, "if-formula", opstring));
+                        arguments.push_back(parseOperatorArgument([&] () { return parseExpression(expressionStructure.at("then"), scopeDescription, globalVars, constants, localVars, returnNoneInitializedOnUnknownOperator); }, "then-formula", opstring));
+                        arguments.push_back(parseOperatorArgument([&] () { return parseExpression(expressionStructure.at("else"), scopeDescription, globalVars, constants, localVars, returnNoneInitializedOnUnknownOperator); }, "else-formula", opstring));
                         ensureNumberOfArguments(3, arguments.size(), opstring, scopeDescription);
                         assert(arguments.size() == 3);
                                             ensureBooleanType(arguments[0], opstring, 0, scopeDescription);
@@ -4,6 +4,9 @@
 #include "storm/logic/Bound.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/OperatorType.h"
+
+#include <tuple>
 
 
 // JSON parser
@@ -52,6 +55,15 @@ namespace storm {
             storm::expressions::Expression parseExpression(json const& expressionStructure, std::string const& scopeDescription, std::unordered_map<std::string, std::shared_ptr<storm::jani::Variable>> const& globalVars, std::unordered_map<std::string, std::shared_ptr<storm::jani::Constant>> const& constants,  std::unordered_map<std::string, std::shared_ptr<storm::jani::Variable>> const& localVars = {}, bool returnNoneOnUnknownOpString = false);
             
         private:
+            storm::expressions::Expression parseExpressionStructure(json const& expressionStructure, std::string const& scopeDescription, std::unordered_map<std::string, std::shared_ptr<storm::jani::Variable>> const& globalVars, std::unordered_map<std::string, std::shared_ptr<storm::jani::Constant>> const& constants,  std::unordered_map<std::string, std::shared_ptr<storm::jani::Variable>> const& localVars, bool returnNoneOnUnknownOpString);
+
+            /**
+             * Retrieves the already parsed expression that applies the same operator to the same operands as the given
+             * expression or registers the given expression, if there is no such expression. As the operands of parsed
+             * expressions are shared in this way, repeated subexpressions are only stored once.
+             */
+            storm::expressions::Expression internExpression(storm::expressions::Expression const& expression);
+
             std::shared_ptr<storm::jani::Constant> parseConstant(json const& constantStructure,  std::unordered_map<std::string, std::shared_ptr<storm::jani::Constant>> const& constants, std::string const& scopeDescription = "global");
 
             /**
@@ -82,6 +94,15 @@ namespace storm {
              */
             std::shared_ptr<storm::expressions::ExpressionManager> expressionManager;
             
+            /**
+             * The already parsed literals, variables and function applications (the latter indexed by their operator
+             * and operands), which are shared among all expressions of the model.
+             */
+            std::unordered_map<int64_t, storm::expressions::Expression> integerExpressions;
+            std::map<double, storm::expressions::Expression> rationalExpressions;
+            std::unordered_map<storm::expressions::Variable, storm::expressions::Expression> variableExpressions;
+            std::map<std::tuple<storm::expressions::OperatorType, storm::expressions::BaseExpression const*, storm::expressions::BaseExpression const*, storm::expressions::BaseExpression const*>, storm::expressions::Expression> compositeExpressions;
+
             std::set<std::string> labels = {};
 
             bool allowRecursion = true;
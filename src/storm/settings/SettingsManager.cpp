@@ -505,6 +505,14 @@ namespace storm {
             return dynamic_cast<storm::settings::modules::AbstractionSettings&>(mutableManager().getModule(storm::settings::modules::AbstractionSettings::moduleName));
         }
         
+        storm::settings::modules::MinMaxEquationSolverSettings& mutableMinMaxEquationSolverSettings() {
+            return dynamic_cast<storm::settings::modules::MinMaxEquationSolverSettings&>(mutableManager().getModule(storm::settings::modules::MinMaxEquationSolverSettings::moduleName));
+        }
+        
+        storm::settings::modules::BuildSettings& mutableBuildSettings() {
+            return dynamic_cast<storm::settings::modules::BuildSettings&>(mutableManager().getModule(storm::settings::modules::BuildSettings::moduleName));
+        }
+        
         void initializeAll(std::string const& name, std::string const& executableName) {
             storm::settings::mutableManager().setName(name, executableName);
 
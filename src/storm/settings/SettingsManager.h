@@ -16,6 +16,8 @@ namespace storm {
             class IOSettings;
             class ModuleSettings;
             class AbstractionSettings;
+            class MinMaxEquationSolverSettings;
+            class BuildSettings;
         }
         class Option;
         
@@ -285,6 +287,22 @@ namespace storm {
          */
         storm::settings::modules::AbstractionSettings& mutableAbstractionSettings();
         
+        /*!
+         * Retrieves the min/max equation solver settings in a mutable form. This is only meant to be used for debug
+         * purposes or very rare cases where it is necessary.
+         *
+         * @return An object that allows accessing and modifying the min/max equation solver settings.
+         */
+        storm::settings::modules::MinMaxEquationSolverSettings& mutableMinMaxEquationSolverSettings();
+        
+        /*!
+         * Retrieves the build settings in a mutable form. This is only meant to be used for debug purposes or very
+         * rare cases where it is necessary.
+         *
+         * @return An object that allows accessing and modifying the build settings.
+         */
+        storm::settings::modules::BuildSettings& mutableBuildSettings();
+        
     } // namespace settings
 } // namespace storm
 
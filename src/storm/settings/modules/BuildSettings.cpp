@@ -29,6 +29,9 @@ namespace storm {
             const std::string fullModelBuildOptionName = "buildfull";
             const std::string buildChoiceLabelOptionName = "buildchoicelab";
             const std::string buildStateValuationsOptionName = "buildstateval";
+            const std::string ddVariableOrderingOptionName = "ddorder";
+            const std::string importDdVariableOrderOptionName = "importddorder";
+            const std::string exportDdVariableOrderOptionName = "exportddorder";
             BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
 
                 std::vector<std::string> explorationOrders = {"dfs", "bfs"};
@@ -43,6 +46,14 @@ namespace storm {
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the exploration order to choose.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(explorationOrders)).setDefaultValueString("bfs").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false, "If set, additional checks (if available) are performed during model exploration to debug the model.").setShortName(explorationChecksOptionShortName).build());
 
+                std::vector<std::string> ddVariableOrderingHeuristics = {"declaration", "force"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderingOptionName, false, "Sets the heuristic that orders the variables of the symbolic model builders.")
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the heuristic to choose.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddVariableOrderingHeuristics)).setDefaultValueString("declaration").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, importDdVariableOrderOptionName, false, "Reads the order of the variables of the symbolic model builders from the given file (as written by --" + exportDdVariableOrderOptionName + ").")
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file from which to read the order.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, exportDdVariableOrderOptionName, false, "Writes the order of the variables chosen by the symbolic model builders to the given file.")
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to which to write the order.").build()).build());
+
             }
 
 
@@ -85,6 +96,55 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown exploration order '" << explorationOrderAsString << "'.");
             }
 
+            storm::builder::DdVariableOrderingHeuristic BuildSettings::getDdVariableOrderingHeuristic() const {
+                std::string heuristicAsString = this->getOption(ddVariableOrderingOptionName).getArgumentByName("name").getValueAsString();
+                if (heuristicAsString == "declaration") {
+                    return storm::builder::DdVariableOrderingHeuristic::Declaration;
+                } else if (heuristicAsString == "force") {
+                    return storm::builder::DdVariableOrderingHeuristic::Force;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown variable ordering heuristic '" << heuristicAsString << "'.");
+            }
+
+            void BuildSettings::setDdVariableOrderingHeuristic(storm::builder::DdVariableOrderingHeuristic const& heuristic) {
+                std::string heuristicAsString;
+                switch (heuristic) {
+                    case storm::builder::DdVariableOrderingHeuristic::Declaration: heuristicAsString = "declaration"; break;
+                    case storm::builder::DdVariableOrderingHeuristic::Force: heuristicAsString = "force"; break;
+                }
+                this->getOption(ddVariableOrderingOptionName).getArgumentByName("name").setFromStringValue(heuristicAsString);
+            }
+
+            bool BuildSettings::isImportDdVariableOrderSet() const {
+                return this->getOption(importDdVariableOrderOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BuildSettings::getImportDdVariableOrderFilename() const {
+                return this->getOption(importDdVariableOrderOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
+            void BuildSettings::setImportDdVariableOrderFilename(boost::optional<std::string> const& filename) {
+                if (filename) {
+                    this->getOption(importDdVariableOrderOptionName).getArgumentByName("filename").setFromStringValue(filename.get());
+                }
+                this->getOption(importDdVariableOrderOptionName).setHasOptionBeenSet(static_cast<bool>(filename));
+            }
+
+            bool BuildSettings::isExportDdVariableOrderSet() const {
+                return this->getOption(exportDdVariableOrderOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BuildSettings::getExportDdVariableOrderFilename() const {
+                return this->getOption(exportDdVariableOrderOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
+            void BuildSettings::setExportDdVariableOrderFilename(boost::optional<std::string> const& filename) {
+                if (filename) {
+                    this->getOption(exportDdVariableOrderOptionName).getArgumentByName("filename").setFromStringValue(filename.get());
+                }
+                this->getOption(exportDdVariableOrderOptionName).setHasOptionBeenSet(static_cast<bool>(filename));
+            }
+
             bool BuildSettings::isExplorationChecksSet() const {
                 return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
             }
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <boost/optional.hpp>
 
 #include "storm-config.h"
 #include "storm/settings/modules/ModuleSettings.h"
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/builder/DdVariableOrdering.h"
 
 namespace storm {
     namespace settings {
@@ -44,6 +46,54 @@ namespace storm {
                  */
                 storm::builder::ExplorationOrder getExplorationOrder() const;
 
+                /*!
+                 * Retrieves the heuristic that is used to order the variables of the symbolic model builders.
+                 *
+                 * @return The chosen heuristic.
+                 */
+                storm::builder::DdVariableOrderingHeuristic getDdVariableOrderingHeuristic() const;
+
+                /*!
+                 * Sets the heuristic that is used to order the variables of the symbolic model builders.
+                 *
+                 * @param heuristic The heuristic to use.
+                 */
+                void setDdVariableOrderingHeuristic(storm::builder::DdVariableOrderingHeuristic const& heuristic);
+
+                /*!
+                 * Retrieves whether the variable order of the symbolic model builders is to be imported from a file.
+                 */
+                bool isImportDdVariableOrderSet() const;
+
+                /*!
+                 * Retrieves the name of the file from which to import the variable order of the symbolic model builders.
+                 */
+                std::string getImportDdVariableOrderFilename() const;
+
+                /*!
+                 * Sets the name of the file from which to import the variable order of the symbolic model builders.
+                 *
+                 * @param filename The name of the file. If none is given, the order is not imported.
+                 */
+                void setImportDdVariableOrderFilename(boost::optional<std::string> const& filename);
+
+                /*!
+                 * Retrieves whether the variable order of the symbolic model builders is to be exported to a file.
+                 */
+                bool isExportDdVariableOrderSet() const;
+
+                /*!
+                 * Retrieves the name of the file to which to export the variable order of the symbolic model builders.
+                 */
+                std::string getExportDdVariableOrderFilename() const;
+
+                /*!
+                 * Sets the name of the file to which to export the variable order of the symbolic model builders.
+                 *
+                 * @param filename The name of the file. If none is given, the order is not exported.
+                 */
+                void setExportDdVariableOrderFilename(boost::optional<std::string> const& filename);
+
                 /*!
                  * Retrieves whether the PRISM compatibility mode was enabled.
                  *
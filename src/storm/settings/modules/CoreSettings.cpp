@@ -1,5 +1,9 @@
 #include "storm/settings/modules/CoreSettings.h"
 
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/Option.h"
@@ -34,13 +38,15 @@ namespace storm {
             const std::string CoreSettings::cudaOptionName = "cuda";
             const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
             const std::string CoreSettings::intelTbbOptionShortName = "tbb";
+            const std::string CoreSettings::hybridMemoryBudgetOptionName = "hybridbudget";
+            const std::string CoreSettings::prob01WorklistOptionName = "prob01worklist";
             
             CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(CoreSettings::Engine::Sparse) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, counterexampleOptionName, false, "Generates a counterexample for the given PRCTL formulas if not satisfied by the model.").setShortName(counterexampleOptionShortName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, dontFixDeadlockOptionName, false, "If the model contains deadlock states, they need to be fixed by setting this option.").setShortName(dontFixDeadlockOptionShortName).build());
                 
-                std::vector<std::string> engines = {"sparse", "hybrid", "dd", "expl", "abs"};
-                this->addOption(storm::settings::OptionBuilder(moduleName, engineOptionName, false, "Sets which engine is used for model building and model checking.").setShortName(engineOptionShortName)
+                std::vector<std::string> engines = {"sparse", "hybrid", "dd", "expl", "abs", "auto"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, engineOptionName, false, "Sets which engine is used for model building and model checking. With 'auto', the engine is selected based on the symbolic representation of the model and the properties.").setShortName(engineOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the engine to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(engines)).setDefaultValueString("sparse").build()).build());
                 
                 std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination"};
@@ -62,6 +68,10 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, cudaOptionName, false, "Sets whether to use CUDA.").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to use Intel TBB (if Storm was built with support for TBB).").setShortName(intelTbbOptionShortName).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, hybridMemoryBudgetOptionName, false, "Sets the memory the hybrid engine may spend on explicit representations. Larger equation systems are split into their SCCs and blocks that still exceed the budget are solved symbolically.")
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("megabytes", "The memory budget in megabytes.").addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterEqualValidator(0.0)).build())
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("blocksize", "The minimal number of states of the blocks into which larger equation systems are split.").setDefaultValueUnsignedInteger(1000).setIsOptional(true).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, prob01WorklistOptionName, false, "Sets whether the qualitative (prob0/prob1) precomputations on sparse MDPs use worklist algorithms that look at every transition a bounded number of times.").build());
             }
 
             bool CoreSettings::isCounterexampleSet() const {
@@ -98,6 +108,37 @@ namespace storm {
                 return !this->getOption(eqSolverOptionName).getHasOptionBeenSet() || this->getOption(eqSolverOptionName).getArgumentByName("name").wasSetFromDefaultValue();
             }
             
+            bool CoreSettings::isHybridMemoryBudgetSet() const {
+                return this->getOption(hybridMemoryBudgetOptionName).getHasOptionBeenSet();
+            }
+            
+            uint64_t CoreSettings::getHybridMemoryBudget() const {
+                return static_cast<uint64_t>(this->getOption(hybridMemoryBudgetOptionName).getArgumentByName("megabytes").getValueAsDouble() * 1024 * 1024);
+            }
+            
+            uint64_t CoreSettings::getHybridMinimalBlockSize() const {
+                return this->getOption(hybridMemoryBudgetOptionName).getArgumentByName("blocksize").getValueAsUnsignedInteger();
+            }
+            
+            void CoreSettings::setHybridMemoryBudget(boost::optional<uint64_t> const& budget, uint64_t minimalBlockSize) {
+                if (budget) {
+                    // Print the budget with enough digits so that it survives the conversion to megabytes and back.
+                    std::stringstream megabytes;
+                    megabytes << std::setprecision(std::numeric_limits<double>::max_digits10) << (static_cast<double>(budget.get()) / (1024 * 1024));
+                    this->getOption(hybridMemoryBudgetOptionName).getArgumentByName("megabytes").setFromStringValue(megabytes.str());
+                    this->getOption(hybridMemoryBudgetOptionName).getArgumentByName("blocksize").setFromStringValue(std::to_string(minimalBlockSize));
+                }
+                this->getOption(hybridMemoryBudgetOptionName).setHasOptionBeenSet(static_cast<bool>(budget));
+            }
+            
+            bool CoreSettings::isProb01WorklistSet() const {
+                return this->getOption(prob01WorklistOptionName).getHasOptionBeenSet();
+            }
+            
+            std::unique_ptr<storm::settings::SettingMemento> CoreSettings::overrideProb01WorklistSet(bool stateToSet) {
+                return this->overrideOption(prob01WorklistOptionName, stateToSet);
+            }
+            
             storm::solver::LpSolverType CoreSettings::getLpSolver() const {
                 std::string lpSolverName = this->getOption(lpSolverOptionName).getArgumentByName("name").getValueAsString();
                 if (lpSolverName == "gurobi") {
@@ -141,6 +182,10 @@ namespace storm {
                 return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
             }
 
+            std::unique_ptr<storm::settings::SettingMemento> CoreSettings::overrideUseIntelTbbSet(bool stateToSet) {
+                return this->overrideOption(intelTbbOptionName, stateToSet);
+            }
+
             bool CoreSettings::isUseCudaSet() const {
                 return this->getOption(cudaOptionName).getHasOptionBeenSet();
             }
@@ -166,6 +211,8 @@ namespace storm {
                     engine = CoreSettings::Engine::Exploration;
                 } else if (engineStr == "abs") {
                     engine = CoreSettings::Engine::AbstractionRefinement;
+                } else if (engineStr == "auto") {
+                    engine = CoreSettings::Engine::Automatic;
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown engine '" << engineStr << "'.");
                 }
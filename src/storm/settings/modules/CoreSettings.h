@@ -1,6 +1,8 @@
 #ifndef STORM_SETTINGS_MODULES_CoreSettings_H_
 #define STORM_SETTINGS_MODULES_CoreSettings_H_
 
+#include <boost/optional.hpp>
+
 #include "storm-config.h"
 #include "storm/settings/modules/ModuleSettings.h"
 
@@ -28,7 +30,7 @@ namespace storm {
             public:
                 // An enumeration of all engines.
                 enum class Engine {
-                    Sparse, Hybrid, Dd, Exploration, AbstractionRefinement
+                    Sparse, Hybrid, Dd, Exploration, AbstractionRefinement, Automatic
                 };
 
                 /*!
@@ -88,6 +90,52 @@ namespace storm {
                  */
                 bool isEquationSolverSetFromDefaultValue() const;
                 
+                /*!
+                 * Retrieves whether a memory budget for the explicit representations of the hybrid engine was set.
+                 *
+                 * @return True iff the budget was set.
+                 */
+                bool isHybridMemoryBudgetSet() const;
+                
+                /*!
+                 * Retrieves the memory budget for the explicit representations of the hybrid engine.
+                 *
+                 * @return The memory budget in bytes.
+                 */
+                uint64_t getHybridMemoryBudget() const;
+                
+                /*!
+                 * Retrieves the minimal number of states of the blocks into which the hybrid engine splits equation
+                 * systems that exceed the memory budget.
+                 *
+                 * @return The minimal block size.
+                 */
+                uint64_t getHybridMinimalBlockSize() const;
+                
+                /*!
+                 * Sets the memory budget for the explicit representations of the hybrid engine.
+                 *
+                 * @param budget The new budget in bytes. If none is given, the budget is removed.
+                 * @param minimalBlockSize The minimal number of states of the blocks into which larger systems are split.
+                 */
+                void setHybridMemoryBudget(boost::optional<uint64_t> const& budget, uint64_t minimalBlockSize = 1000);
+                
+                /*!
+                 * Retrieves whether the qualitative precomputations on sparse MDPs are to use worklist algorithms.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isProb01WorklistSet() const;
+                
+                /*!
+                 * Overrides the option to use worklist algorithms for the qualitative precomputations by the given
+                 * value. This is only meant for testing purposes.
+                 *
+                 * @param stateToSet The value that is to be set for the option.
+                 * @return A memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideProb01WorklistSet(bool stateToSet);
+                
                 /*!
                  * Retrieves the selected LP solver.
                  *
@@ -130,6 +178,14 @@ namespace storm {
                  */
                 bool isUseIntelTbbSet() const;
 
+                /*!
+                 * Overrides the option to use Intel TBB by the given value. This is only meant for testing purposes.
+                 *
+                 * @param stateToSet The value that is to be set for the option.
+                 * @return A memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideUseIntelTbbSet(bool stateToSet);
+
                 /*!
                  * Retrieves whether the option to use CUDA is set.
                  *
@@ -174,6 +230,8 @@ namespace storm {
                 static const std::string intelTbbOptionName;
                 static const std::string intelTbbOptionShortName;
                 static const std::string cudaOptionName;
+                static const std::string hybridMemoryBudgetOptionName;
+                static const std::string prob01WorklistOptionName;
             };
 
         } // namespace modules
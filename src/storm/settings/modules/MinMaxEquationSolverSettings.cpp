@@ -19,9 +19,10 @@ namespace storm {
             const std::string MinMaxEquationSolverSettings::absoluteOptionName = "absolute";
             const std::string MinMaxEquationSolverSettings::lraMethodOptionName = "lramethod";
             const std::string MinMaxEquationSolverSettings::valueIterationMultiplicationStyleOptionName = "vimult";
+            const std::string MinMaxEquationSolverSettings::symbolicTopologicalOptionName = "ddtopological";
 
             MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "linear-programming", "lp", "acyclic", "ratsearch"};
+                std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "linear-programming", "lp", "acyclic", "ratsearch", "ii", "interval-iteration"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, solvingMethodOptionName, false, "Sets which min/max linear equation solving technique is preferred.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a min/max linear equation solving technique.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(minMaxSolvingTechniques)).setDefaultValueString("vi").build()).build());
                 
@@ -38,6 +39,8 @@ namespace storm {
                 std::vector<std::string> multiplicationStyles = {"gaussseidel", "regular", "gs", "r"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, valueIterationMultiplicationStyleOptionName, false, "Sets which method multiplication style to prefer for value iteration.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplication style.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplicationStyles)).setDefaultValueString("gaussseidel").build()).build());
+
+                this->addOption(storm::settings::OptionBuilder(moduleName, symbolicTopologicalOptionName, false, "If set, the symbolic solvers decompose the system into its strongly connected components and solve them in topological order.").build());
             }
             
             storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
@@ -52,6 +55,8 @@ namespace storm {
                     return storm::solver::MinMaxMethod::Acyclic;
                 } else if (minMaxEquationSolvingTechnique == "ratsearch") {
                     return storm::solver::MinMaxMethod::RationalSearch;
+                } else if (minMaxEquationSolvingTechnique == "interval-iteration" || minMaxEquationSolvingTechnique == "ii") {
+                    return storm::solver::MinMaxMethod::IntervalIteration;
                 }
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown min/max equation solving technique '" << minMaxEquationSolvingTechnique << "'.");
             }
@@ -60,6 +65,20 @@ namespace storm {
                 return !this->getOption(solvingMethodOptionName).getArgumentByName("name").getHasBeenSet() || this->getOption(solvingMethodOptionName).getArgumentByName("name").wasSetFromDefaultValue();
             }
             
+            void MinMaxEquationSolverSettings::setMinMaxEquationSolvingMethod(storm::solver::MinMaxMethod const& method) {
+                std::string minMaxEquationSolvingTechnique;
+                switch (method) {
+                    case storm::solver::MinMaxMethod::ValueIteration: minMaxEquationSolvingTechnique = "vi"; break;
+                    case storm::solver::MinMaxMethod::PolicyIteration: minMaxEquationSolvingTechnique = "pi"; break;
+                    case storm::solver::MinMaxMethod::LinearProgramming: minMaxEquationSolvingTechnique = "lp"; break;
+                    case storm::solver::MinMaxMethod::Acyclic: minMaxEquationSolvingTechnique = "acyclic"; break;
+                    case storm::solver::MinMaxMethod::RationalSearch: minMaxEquationSolvingTechnique = "ratsearch"; break;
+                    case storm::solver::MinMaxMethod::IntervalIteration: minMaxEquationSolvingTechnique = "ii"; break;
+                    default: STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "The min/max equation solving technique cannot be selected via the settings.");
+                }
+                this->getOption(solvingMethodOptionName).getArgumentByName("name").setFromStringValue(minMaxEquationSolvingTechnique);
+            }
+            
             bool MinMaxEquationSolverSettings::isMinMaxEquationSolvingMethodSet() const {
                 return this->getOption(solvingMethodOptionName).getHasOptionBeenSet();
             }
@@ -108,6 +127,10 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown multiplication style '" << multiplicationStyleString << "'.");
             }
             
+            bool MinMaxEquationSolverSettings::isSymbolicTopologicalSet() const {
+                return this->getOption(symbolicTopologicalOptionName).getHasOptionBeenSet();
+            }
+            
         }
     }
 }
@@ -41,6 +41,13 @@ namespace storm {
                  */
                 bool isMinMaxEquationSolvingMethodSetFromDefaultValue() const;
                 
+                /*!
+                 * Sets the min/max equation solving method for further usage, e.g. after it was selected automatically.
+                 *
+                 * @param method The method to use.
+                 */
+                void setMinMaxEquationSolvingMethod(storm::solver::MinMaxMethod const& method);
+                
                 /*!
                  * Retrieves whether the maximal iteration count has been set.
                  *
@@ -97,6 +104,13 @@ namespace storm {
                  */
                 storm::solver::MultiplicationStyle getValueIterationMultiplicationStyle() const;
                 
+                /*!
+                 * Retrieves whether the symbolic solvers are to solve the system SCC-wise in topological order.
+                 *
+                 * @return True iff topological solving was requested for the symbolic solvers.
+                 */
+                bool isSymbolicTopologicalSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -108,6 +122,7 @@ namespace storm {
                 static const std::string absoluteOptionName;
                 static const std::string lraMethodOptionName;
                 static const std::string valueIterationMultiplicationStyleOptionName;
+                static const std::string symbolicTopologicalOptionName;
             };
             
         }
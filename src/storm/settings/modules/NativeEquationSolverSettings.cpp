@@ -25,7 +25,7 @@ namespace storm {
             const std::string NativeEquationSolverSettings::powerMethodMultiplicationStyleOptionName = "powmult";
 
             NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> methods = { "jacobi", "gaussseidel", "sor", "walkerchae", "power", "ratsearch" };
+                std::vector<std::string> methods = { "jacobi", "gaussseidel", "sor", "walkerchae", "power", "ratsearch", "ii" };
                 this->addOption(storm::settings::OptionBuilder(moduleName, techniqueOptionName, true, "The method to be used for solving linear equation systems with the native engine.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(methods)).setDefaultValueString("jacobi").build()).build());
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalIterationsOptionName, false, "The maximal number of iterations to perform before iterative solving is aborted.").setShortName(maximalIterationsOptionShortName).addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The maximal iteration count.").setDefaultValueUnsignedInteger(20000).build()).build());
@@ -63,6 +63,8 @@ namespace storm {
                     return NativeEquationSolverSettings::LinearEquationMethod::Power;
                 } else if (linearEquationSystemTechniqueAsString == "ratsearch") {
                     return NativeEquationSolverSettings::LinearEquationMethod::RationalSearch;
+                } else if (linearEquationSystemTechniqueAsString == "ii") {
+                    return NativeEquationSolverSettings::LinearEquationMethod::IntervalIteration;
                 }
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown solution technique '" << linearEquationSystemTechniqueAsString << "' selected.");
             }
@@ -122,6 +124,7 @@ namespace storm {
                     case NativeEquationSolverSettings::LinearEquationMethod::WalkerChae: out << "walkerchae"; break;
                     case NativeEquationSolverSettings::LinearEquationMethod::Power: out << "power"; break;
                     case NativeEquationSolverSettings::LinearEquationMethod::RationalSearch: out << "ratsearch"; break;
+                    case NativeEquationSolverSettings::LinearEquationMethod::IntervalIteration: out << "ii"; break;
                 }
                 return out;
             }
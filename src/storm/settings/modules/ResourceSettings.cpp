@@ -15,11 +15,17 @@ namespace storm {
             const std::string ResourceSettings::timeoutOptionShortName = "t";
             const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
             const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
+            const std::string ResourceSettings::memoryLimitOptionName = "memlimit";
+            const std::string ResourceSettings::profileOptionName = "profile";
 
             ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "If given, computation will abort after the timeout has been reached.").setShortName(timeoutOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "The number of seconds after which to timeout.").setDefaultValueUnsignedInteger(0).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, printTimeAndMemoryOptionName, false, "Prints CPU time and memory consumption at the end.").setShortName(printTimeAndMemoryOptionShortName).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, memoryLimitOptionName, false, "If given, the memory the process may allocate is limited. The limit is also respected when selecting the engine automatically.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("megabytes", "The memory limit in megabytes.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, profileOptionName, false, "Writes the time, the peak memory and counters (e.g. iterations) of the individual phases (parsing, model building, solving, ...) as JSON to the given file.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to write to.").build()).build());
             }
             
             bool ResourceSettings::isTimeoutSet() const {
@@ -30,6 +36,22 @@ namespace storm {
                 return this->getOption(timeoutOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
             }
             
+            bool ResourceSettings::isMemoryLimitSet() const {
+                return this->getOption(memoryLimitOptionName).getHasOptionBeenSet();
+            }
+            
+            uint_fast64_t ResourceSettings::getMemoryLimitInMegabytes() const {
+                return this->getOption(memoryLimitOptionName).getArgumentByName("megabytes").getValueAsUnsignedInteger();
+            }
+            
+            bool ResourceSettings::isProfileSet() const {
+                return this->getOption(profileOptionName).getHasOptionBeenSet();
+            }
+            
+            std::string ResourceSettings::getProfileFilename() const {
+                return this->getOption(profileOptionName).getArgumentByName("filename").getValueAsString();
+            }
+            
             bool ResourceSettings::isPrintTimeAndMemorySet() const {
                 return this->getOption(printTimeAndMemoryOptionName).getHasOptionBeenSet();
             }
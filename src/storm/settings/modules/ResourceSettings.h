@@ -39,6 +39,35 @@ namespace storm {
                  */
                 uint_fast64_t getTimeoutInSeconds() const;
 
+                /*!
+                 * Retrieves whether the memory limit option was set.
+                 *
+                 * @return True if the memory limit option was set.
+                 */
+                bool isMemoryLimitSet() const;
+
+                /*!
+                 * Retrieves the amount of memory the process may allocate in case the memory limit option was set.
+                 *
+                 * @return The memory limit in megabytes.
+                 */
+                uint_fast64_t getMemoryLimitInMegabytes() const;
+
+                /*!
+                 * Retrieves whether the profile option was set.
+                 *
+                 * @return True if the profile option was set.
+                 */
+                bool isProfileSet() const;
+
+                /*!
+                 * Retrieves the name of the file to which the profile (times, counters and memory per phase) is to be
+                 * written.
+                 *
+                 * @return The name of the file.
+                 */
+                std::string getProfileFilename() const;
+
                 // The name of the module.
                 static const std::string moduleName;
 
@@ -48,6 +77,8 @@ namespace storm {
                 static const std::string timeoutOptionShortName;
                 static const std::string printTimeAndMemoryOptionName;
                 static const std::string printTimeAndMemoryOptionShortName;
+                static const std::string memoryLimitOptionName;
+                static const std::string profileOptionName;
             };
         }
     }
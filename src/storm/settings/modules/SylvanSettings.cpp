@@ -14,15 +14,31 @@ namespace storm {
             const std::string SylvanSettings::moduleName = "sylvan";
             const std::string SylvanSettings::maximalMemoryOptionName = "maxmem";
             const std::string SylvanSettings::threadCountOptionName = "threads";
+            const std::string SylvanSettings::tableCacheRatioOptionName = "tableratio";
+            const std::string SylvanSettings::resizeThresholdOptionName = "resizethreshold";
             
             SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalMemoryOptionName, true, "Sets the upper bound of memory available to Sylvan in MB.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The memory available to Sylvan.").setDefaultValueUnsignedInteger(4096).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, threadCountOptionName, true, "Sets the number of threads used by Sylvan.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The number of threads available to Sylvan (0 means 'auto-detect').").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, tableCacheRatioOptionName, true, "Sets the ratio between the sizes of the node table and the operation cache as a power of two.").addArgument(storm::settings::ArgumentBuilder::createIntegerArgument("value", "The node table is 2^value times as large as the cache (negative values make the cache larger). The default makes both tables equally large.").setDefaultValueInteger(0).addValidatorInteger(ArgumentValidatorFactory::createIntegerRangeValidatorExcluding(-16, 16)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, resizeThresholdOptionName, true, "Sets the fill rate of the node table (after garbage collection) above which Sylvan's tables are grown.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The fill rate in percent.").setDefaultValueUnsignedInteger(50).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorExcluding(0, 100)).build()).build());
             }
             
             uint_fast64_t SylvanSettings::getMaximalMemory() const {
                 return this->getOption(maximalMemoryOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
             }
+            
+            bool SylvanSettings::isMaximalMemorySet() const {
+                return this->getOption(maximalMemoryOptionName).getHasOptionBeenSet();
+            }
+            
+            int_fast64_t SylvanSettings::getTableCacheRatio() const {
+                return this->getOption(tableCacheRatioOptionName).getArgumentByName("value").getValueAsInteger();
+            }
+            
+            uint_fast64_t SylvanSettings::getResizeThreshold() const {
+                return this->getOption(resizeThresholdOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+            }
 
             bool SylvanSettings::isNumberOfThreadsSet() const {
                 return this->getOption(threadCountOptionName).getArgumentByName("value").getHasBeenSet();
@@ -24,6 +24,23 @@ namespace storm {
                  */
                 uint_fast64_t getMaximalMemory() const;
                 
+                /*!
+                 * Retrieves whether the maximal amount of memory was set explicitly.
+                 */
+                bool isMaximalMemorySet() const;
+                
+                /*!
+                 * Retrieves the ratio between the node table and the operation cache as a power of two, i.e. the node
+                 * table has 2^ratio times as many entries as the cache.
+                 */
+                int_fast64_t getTableCacheRatio() const;
+                
+                /*!
+                 * Retrieves the fill rate (in percent) of the node table after a garbage collection above which the
+                 * node table and the operation cache are grown.
+                 */
+                uint_fast64_t getResizeThreshold() const;
+                
                 /*!
                  * Retrieves the amount of threads available to Sylvan. Note that a value of zero means that the number
                  * of threads is auto-detected to fit the current machine.
@@ -44,6 +61,8 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string maximalMemoryOptionName;
                 static const std::string threadCountOptionName;
+                static const std::string tableCacheRatioOptionName;
+                static const std::string resizeThresholdOptionName;
             };
             
         } // namespace modules
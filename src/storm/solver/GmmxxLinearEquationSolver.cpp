@@ -14,6 +14,7 @@
 
 #include "storm/utility/vector.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/instrumentation.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidSolverSettingsException.h"
 
@@ -198,6 +199,17 @@ namespace storm {
                 // Make sure that all results conform to the bounds.
                 storm::utility::vector::clip(x, this->lowerBound, this->upperBound);
                 
+                // All methods compute the initial residual. BiCGSTAB and QMR then perform two products per iteration
+                // (QMR one of them with the transposed matrix), GMRES performs one and recomputes the residual at every restart.
+                uint64_t iterations = iter.get_iteration();
+                uint64_t matrixVectorProducts = 1;
+                if (method == GmmxxLinearEquationSolverSettings<ValueType>::SolutionMethod::Gmres) {
+                    matrixVectorProducts += iterations + iterations / this->getSettings().getNumberOfIterationsUntilRestart();
+                } else {
+                    matrixVectorProducts += 2 * iterations;
+                }
+                storm::utility::instrumentation::addSolverIterations("linear equation solver iterations", iterations, matrixVectorProducts, gmm::nnz(*gmmxxA));
+                
                 // Check if the solver converged and issue a warning otherwise.
                 if (iter.converged()) {
                     STORM_LOG_INFO("Iterative solver converged after " << iter.get_iteration() << " iterations.");
@@ -9,6 +9,7 @@
 #include "storm/utility/KwekMehlhorn.h"
 
 #include "storm/utility/vector.h"
+#include "storm/utility/instrumentation.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -32,7 +33,7 @@ namespace storm {
             setSolutionMethod(minMaxSettings.getMinMaxEquationSolvingMethod());
             
             // Finally force soundness and potentially overwrite some other settings.
-            this->setForceSoundness(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isSoundSet());
+            this->setForceSoundness(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isSoundSet() || minMaxSettings.getMinMaxEquationSolvingMethod() == MinMaxMethod::IntervalIteration);
         }
         
         template<typename ValueType>
@@ -46,6 +47,11 @@ namespace storm {
                 case MinMaxMethod::ValueIteration: this->solutionMethod = SolutionMethod::ValueIteration; break;
                 case MinMaxMethod::PolicyIteration: this->solutionMethod = SolutionMethod::PolicyIteration; break;
                 case MinMaxMethod::RationalSearch: this->solutionMethod = SolutionMethod::RationalSearch; break;
+                case MinMaxMethod::IntervalIteration:
+                    // Sound value iteration approaches the solution from below and above.
+                    this->solutionMethod = SolutionMethod::ValueIteration;
+                    this->setForceSoundness(true);
+                    break;
                 default:
                     STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique for iterative MinMax linear equation solver.");
             }
@@ -230,6 +236,9 @@ namespace storm {
                 this->showProgressIterative(iterations);
             } while (status == SolverStatus::InProgress);
             
+            // The equation systems of the policies are counted by the linear equation solver, so we only count the
+            // improvement steps here, each of which passes over the choices once.
+            storm::utility::instrumentation::addSolverIterations("policy iterations", iterations, iterations, this->A->getEntryCount());
             reportStatus(status, iterations);
             
             // If requested, we store the scheduler for retrieval.
@@ -418,6 +427,7 @@ namespace storm {
                 std::swap(x, *currentX);
             }
             
+            storm::utility::instrumentation::addSolverIterations("value iterations", result.iterations, result.iterations, this->A->getEntryCount());
             reportStatus(result.status, result.iterations);
             
             // If requested, we store the scheduler for retrieval.
@@ -492,6 +502,7 @@ namespace storm {
             
             // Proceed with the iterations as long as the method did not converge or reach the maximum number of iterations.
             uint64_t iterations = 0;
+            uint64_t matrixVectorProducts = 0;
             
             SolverStatus status = SolverStatus::InProgress;
             bool doConvergenceCheck = true;
@@ -516,6 +527,7 @@ namespace storm {
                 if (iterations % 1000 == 0 || maxLowerDiff == maxUpperDiff) {
                     lowerStep = true;
                     upperStep = true;
+                    matrixVectorProducts += 2;
                     if (useGaussSeidelMultiplication) {
                         if (useDiffs) {
                             preserveOldRelevantValues(*lowerX, this->getRelevantValues(), oldValues);
@@ -543,6 +555,7 @@ namespace storm {
                     }
                 } else {
                     // In the following iterations, we improve the bound with the greatest difference.
+                    ++matrixVectorProducts;
                     if (useGaussSeidelMultiplication) {
                         if (maxLowerDiff >= maxUpperDiff) {
                             if (useDiffs) {
@@ -610,6 +623,7 @@ namespace storm {
                 this->showProgressIterative(iterations);
             }
             
+            storm::utility::instrumentation::addSolverIterations("value iterations", iterations, matrixVectorProducts, this->A->getEntryCount());
             reportStatus(status, iterations);
             
             // We take the means of the lower and upper bound so we guarantee the desired precision.
@@ -903,6 +917,7 @@ namespace storm {
                 status = SolverStatus::MaximalIterationsExceeded;
             }
             
+            storm::utility::instrumentation::addSolverIterations("value iterations", overallIterations, overallIterations, this->A->getEntryCount());
             reportStatus(status, overallIterations);
             
             return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
@@ -956,7 +971,7 @@ namespace storm {
         }
         
         template<typename ValueType>
-        void IterativeMinMaxLinearEquationSolver<ValueType>::reportStatus(SolverStatus status, uint64_t iterations) {
+        void IterativeMinMaxLinearEquationSolver<ValueType>::reportStatus(SolverStatus status, uint64_t iterations) const {
             switch (status) {
                 case SolverStatus::Converged: STORM_LOG_INFO("Iterative solver converged after " << iterations << " iterations."); break;
                 case SolverStatus::TerminatedEarly: STORM_LOG_INFO("Iterative solver terminated early after " << iterations << " iterations."); break;
@@ -109,7 +109,7 @@ namespace storm {
             mutable std::unique_ptr<std::vector<uint64_t>> rowGroupOrdering; // A.rowGroupCount() entries
             
             SolverStatus updateStatusIfNotConverged(SolverStatus status, std::vector<ValueType> const& x, uint64_t iterations, SolverGuarantee const& guarantee) const;
-            static void reportStatus(SolverStatus status, uint64_t iterations);
+            void reportStatus(SolverStatus status, uint64_t iterations) const;
             
             /// The settings of this solver.
             IterativeMinMaxLinearEquationSolverSettings<ValueType> settings;
@@ -8,6 +8,7 @@
 #include "storm/solver/EliminationLinearEquationSolver.h"
 
 #include "storm/utility/vector.h"
+#include "storm/utility/instrumentation.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
@@ -27,9 +28,59 @@ namespace storm {
         
         template<typename ValueType>
         bool LinearEquationSolver<ValueType>::solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            storm::utility::instrumentation::ScopedPhase phase("solving");
             return this->internalSolveEquations(x, b);
         }
         
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::solveEquationsMultiple(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfSystems) const {
+            STORM_LOG_ASSERT(x.size() == getMatrixRowCount() * numberOfSystems, "The size of the solution block does not match the number of systems.");
+            STORM_LOG_ASSERT(b.size() == x.size(), "The size of the right-hand side block does not match the size of the solution block.");
+            storm::utility::instrumentation::ScopedPhase phase("solving");
+            if (numberOfSystems == 1) {
+                return this->internalSolveEquations(x, b);
+            }
+            return this->internalSolveEquationsMultiple(x, b, numberOfSystems);
+        }
+        
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::solveEquationsMultiple(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfSystems, std::vector<ValueType> const& matrixValues) const {
+            STORM_LOG_ASSERT(x.size() == getMatrixRowCount() * numberOfSystems, "The size of the solution block does not match the number of systems.");
+            STORM_LOG_ASSERT(b.size() == x.size(), "The size of the right-hand side block does not match the size of the solution block.");
+            STORM_LOG_THROW(this->supportsSystemSpecificMatrixValues(), storm::exceptions::NotSupportedException, "The solver does not support system-specific matrix values under the current settings.");
+            storm::utility::instrumentation::ScopedPhase phase("solving");
+            return this->internalSolveEquationsMultiple(x, b, numberOfSystems, matrixValues);
+        }
+        
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::supportsSystemSpecificMatrixValues() const {
+            return false;
+        }
+        
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::internalSolveEquationsMultiple(std::vector<ValueType>&, std::vector<ValueType> const&, uint64_t, std::vector<ValueType> const&) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The solver does not support system-specific matrix values.");
+            return false;
+        }
+        
+        bool LinearEquationSolver<ValueType>::internalSolveEquationsMultiple(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfSystems) const {
+            uint64_t rowCount = getMatrixRowCount();
+            std::vector<ValueType> systemX(rowCount);
+            std::vector<ValueType> systemB(rowCount);
+            bool result = true;
+            for (uint64_t system = 0; system < numberOfSystems; ++system) {
+                for (uint64_t row = 0; row < rowCount; ++row) {
+                    systemX[row] = x[row * numberOfSystems + system];
+                    systemB[row] = b[row * numberOfSystems + system];
+                }
+                result = this->internalSolveEquations(systemX, systemB) && result;
+                for (uint64_t row = 0; row < rowCount; ++row) {
+                    x[row * numberOfSystems + system] = systemX[row];
+                }
+            }
+            return result;
+        }
+        
         template<typename ValueType>
         void LinearEquationSolver<ValueType>::repeatedMultiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, uint_fast64_t n) const {
             if (!cachedRowVector) {
@@ -50,6 +50,45 @@ namespace storm {
              */
             bool solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
+            /*!
+             * Solves the equation system (see solveEquations) for several right-hand sides at once. All vectors are
+             * stored as one dense block in which the values of the different systems are interleaved, i.e., the value
+             * of the j-th system for row i is stored at position i * numberOfSystems + j. Solvers that support this
+             * iterate on the whole block such that every iteration requires only one pass over the matrix.
+             *
+             * @param x The block of solution vectors that has to be computed. Its length must be equal to the number of
+             * rows of A times the number of systems.
+             * @param b The block of right-hand sides. Its length must be equal to the length of x.
+             * @param numberOfSystems The number of systems to solve.
+             *
+             * @return true iff all systems were solved.
+             */
+            bool solveEquationsMultiple(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfSystems) const;
+
+            /*!
+             * Solves several equation systems (see solveEquationsMultiple) whose matrices share the structure of A but
+             * differ in their values. The values of the matrix of the j-th system are given in the same interleaved
+             * format, i.e., the value of the i-th entry of A (in row-major order) in the j-th system is stored at
+             * position i * numberOfSystems + j. The values have to be given in the format the solver expects (see
+             * getEquationProblemFormat) and the values of A itself are ignored. This is only possible if the solver
+             * supports system-specific matrix values.
+             *
+             * @param x The block of solution vectors that has to be computed.
+             * @param b The block of right-hand sides. Its length must be equal to the length of x.
+             * @param numberOfSystems The number of systems to solve.
+             * @param matrixValues The block of matrix values. Its length must be equal to the number of entries of A
+             * times the number of systems.
+             *
+             * @return true iff all systems were solved.
+             */
+            bool solveEquationsMultiple(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfSystems, std::vector<ValueType> const& matrixValues) const;
+
+            /*!
+             * Retrieves whether the solver can solve several systems with system-specific matrix values under the
+             * current settings.
+             */
+            virtual bool supportsSystemSpecificMatrixValues() const;
+
             /*!
              * Performs on matrix-vector multiplication x' = A*x + b.
              *
@@ -152,6 +191,17 @@ namespace storm {
             
         protected:
             virtual bool internalSolveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
+            
+            /*!
+             * Solves the given systems (see solveEquationsMultiple). By default, the systems are solved one after another.
+             */
+            virtual bool internalSolveEquationsMultiple(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfSystems) const;
+
+            /*!
+             * Solves the given systems with system-specific matrix values (see solveEquationsMultiple). By default,
+             * this is not supported.
+             */
+            virtual bool internalSolveEquationsMultiple(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfSystems, std::vector<ValueType> const& matrixValues) const;
                         
             // auxiliary storage. If set, this vector has getMatrixRowCount() entries.
             mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector;
@@ -1,5 +1,6 @@
 #include "storm/solver/NativeLinearEquationSolver.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "storm/settings/SettingsManager.h"
@@ -10,6 +11,7 @@
 #include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
+#include "storm/utility/instrumentation.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
@@ -35,6 +37,9 @@ namespace storm {
                 method = SolutionMethod::Power;
             } else if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::RationalSearch) {
                 method = SolutionMethod::RationalSearch;
+            } else if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::IntervalIteration) {
+                // Interval iteration corresponds to the sound variant of the power method.
+                method = SolutionMethod::Power;
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "The selected solution technique is invalid for this solver.");
             }
@@ -46,7 +51,7 @@ namespace storm {
             multiplicationStyle = settings.getPowerMethodMultiplicationStyle();
                                     
             // Finally force soundness and potentially overwrite some other settings.
-            this->setForceSoundness(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isSoundSet());
+            this->setForceSoundness(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isSoundSet() || methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::IntervalIteration);
         }
         
         template<typename ValueType>
@@ -192,7 +197,7 @@ namespace storm {
                 clearCache();
             }
             
-            this->logIterations(converged, terminate, iterations);
+            this->logIterations(converged, terminate, iterations, iterations);
             
             return converged;
         }
@@ -252,7 +257,7 @@ namespace storm {
                 clearCache();
             }
             
-            this->logIterations(converged, terminate, iterations);
+            this->logIterations(converged, terminate, iterations, iterations);
 
             return converged;
         }
@@ -457,7 +462,7 @@ namespace storm {
                 clearCache();
             }
             
-            this->logIterations(result.status == SolverStatus::Converged, result.status == SolverStatus::TerminatedEarly, result.iterations);
+            this->logIterations(result.status == SolverStatus::Converged, result.status == SolverStatus::TerminatedEarly, result.iterations, result.iterations);
 
             return result.status == SolverStatus::Converged || result.status == SolverStatus::TerminatedEarly;
         }
@@ -507,6 +512,7 @@ namespace storm {
             bool converged = false;
             bool terminate = false;
             uint64_t iterations = 0;
+            uint64_t matrixVectorProducts = 0;
             bool doConvergenceCheck = true;
             bool useDiffs = this->hasRelevantValues();
             std::vector<ValueType> oldValues;
@@ -529,6 +535,7 @@ namespace storm {
                 if (iterations % 1000 == 0 || maxLowerDiff == maxUpperDiff) {
                     lowerStep = true;
                     upperStep = true;
+                    matrixVectorProducts += 2;
                     if (useGaussSeidelMultiplication) {
                         if (useDiffs) {
                             preserveOldRelevantValues(*lowerX, this->getRelevantValues(), oldValues);
@@ -556,6 +563,7 @@ namespace storm {
                     }
                 } else {
                     // In the following iterations, we improve the bound with the greatest difference.
+                    ++matrixVectorProducts;
                     if (useGaussSeidelMultiplication) {
                         if (maxLowerDiff >= maxUpperDiff) {
                             if (useDiffs) {
@@ -639,7 +647,7 @@ namespace storm {
                 clearCache();
             }
             
-            this->logIterations(converged, terminate, iterations);
+            this->logIterations(converged, terminate, iterations, matrixVectorProducts);
 
             return converged;
         }
@@ -730,7 +738,7 @@ namespace storm {
                 status = SolverStatus::MaximalIterationsExceeded;
             }
             
-            this->logIterations(status == SolverStatus::Converged, status == SolverStatus::TerminatedEarly, overallIterations);
+            this->logIterations(status == SolverStatus::Converged, status == SolverStatus::TerminatedEarly, overallIterations, overallIterations);
             
             return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
         }
@@ -871,6 +879,196 @@ namespace storm {
             return false;
         }
 
+        /*!
+         * Retrieves the position of the values of the first entry of the given row in a block of system-specific
+         * matrix values (see LinearEquationSolver::solveEquationsMultiple).
+         */
+        template<typename ValueType>
+        uint64_t getBlockValueOffset(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t row, uint64_t numberOfSystems) {
+            return static_cast<uint64_t>(matrix.begin(row) - matrix.begin()) * numberOfSystems;
+        }
+        
+        template<typename ValueType>
+        void multiplyBlock(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const* matrixValues, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t numberOfSystems) {
+            for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                uint64_t rowOffset = row * numberOfSystems;
+                for (uint64_t system = 0; system < numberOfSystems; ++system) {
+                    result[rowOffset + system] = b ? (*b)[rowOffset + system] : storm::utility::zero<ValueType>();
+                }
+                uint64_t valueOffset = getBlockValueOffset(matrix, row, numberOfSystems);
+                for (auto const& entry : matrix.getRow(row)) {
+                    uint64_t columnOffset = entry.getColumn() * numberOfSystems;
+                    for (uint64_t system = 0; system < numberOfSystems; ++system) {
+                        ValueType const& value = matrixValues ? (*matrixValues)[valueOffset + system] : entry.getValue();
+                        result[rowOffset + system] += value * x[columnOffset + system];
+                    }
+                    valueOffset += numberOfSystems;
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        void multiplyBlockGaussSeidelBackward(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const* matrixValues, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfSystems, std::vector<ValueType>& rowValues) {
+            for (uint64_t row = matrix.getRowCount(); row > 0;) {
+                --row;
+                uint64_t rowOffset = row * numberOfSystems;
+                for (uint64_t system = 0; system < numberOfSystems; ++system) {
+                    rowValues[system] = b[rowOffset + system];
+                }
+                uint64_t valueOffset = getBlockValueOffset(matrix, row, numberOfSystems);
+                for (auto const& entry : matrix.getRow(row)) {
+                    uint64_t columnOffset = entry.getColumn() * numberOfSystems;
+                    for (uint64_t system = 0; system < numberOfSystems; ++system) {
+                        ValueType const& value = matrixValues ? (*matrixValues)[valueOffset + system] : entry.getValue();
+                        rowValues[system] += value * x[columnOffset + system];
+                    }
+                    valueOffset += numberOfSystems;
+                }
+                std::copy(rowValues.begin(), rowValues.end(), x.begin() + rowOffset);
+            }
+        }
+        
+        /*!
+         * Accumulates the products of the off-diagonal entries of the given row with the given values in rowValues and
+         * the diagonal entries of the row in diagonalValues, separately for every system.
+         */
+        template<typename ValueType>
+        void splitBlockRow(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const* matrixValues, uint64_t row, std::vector<ValueType> const& x, uint64_t numberOfSystems, std::vector<ValueType>& rowValues, std::vector<ValueType>& diagonalValues) {
+            std::fill(rowValues.begin(), rowValues.end(), storm::utility::zero<ValueType>());
+            std::fill(diagonalValues.begin(), diagonalValues.end(), storm::utility::zero<ValueType>());
+            uint64_t valueOffset = getBlockValueOffset(matrix, row, numberOfSystems);
+            for (auto const& entry : matrix.getRow(row)) {
+                if (entry.getColumn() == row) {
+                    for (uint64_t system = 0; system < numberOfSystems; ++system) {
+                        diagonalValues[system] += matrixValues ? (*matrixValues)[valueOffset + system] : entry.getValue();
+                    }
+                } else {
+                    uint64_t columnOffset = entry.getColumn() * numberOfSystems;
+                    for (uint64_t system = 0; system < numberOfSystems; ++system) {
+                        ValueType const& value = matrixValues ? (*matrixValues)[valueOffset + system] : entry.getValue();
+                        rowValues[system] += value * x[columnOffset + system];
+                    }
+                }
+                valueOffset += numberOfSystems;
+            }
+        }
+        
+        template<typename ValueType>
+        void performSuccessiveOverRelaxationStepBlock(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const* matrixValues, ValueType const& omega, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfSystems, std::vector<ValueType>& rowValues, std::vector<ValueType>& diagonalValues) {
+            ValueType oldValueFactor = storm::utility::one<ValueType>() - omega;
+            for (uint64_t row = matrix.getRowCount(); row > 0;) {
+                --row;
+                uint64_t rowOffset = row * numberOfSystems;
+                splitBlockRow(matrix, matrixValues, row, x, numberOfSystems, rowValues, diagonalValues);
+                for (uint64_t system = 0; system < numberOfSystems; ++system) {
+                    STORM_LOG_ASSERT(!storm::utility::isZero(diagonalValues[system]), "Expected non-zero diagonal element.");
+                    x[rowOffset + system] = oldValueFactor * x[rowOffset + system] + omega / diagonalValues[system] * (b[rowOffset + system] - rowValues[system]);
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        void performJacobiStepBlock(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const* matrixValues, std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result, uint64_t numberOfSystems, std::vector<ValueType>& rowValues, std::vector<ValueType>& diagonalValues) {
+            for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                uint64_t rowOffset = row * numberOfSystems;
+                splitBlockRow(matrix, matrixValues, row, x, numberOfSystems, rowValues, diagonalValues);
+                for (uint64_t system = 0; system < numberOfSystems; ++system) {
+                    STORM_LOG_ASSERT(!storm::utility::isZero(diagonalValues[system]), "Expected non-zero diagonal element.");
+                    result[rowOffset + system] = (b[rowOffset + system] - rowValues[system]) / diagonalValues[system];
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsBlock(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfSystems, std::vector<ValueType> const* matrixValues) const {
+            STORM_LOG_INFO("Solving " << numberOfSystems << " linear equation systems (" << getMatrixRowCount() << " rows each) with NativeLinearEquationSolver (block iteration)");
+            
+            auto const& method = this->getSettings().getSolutionMethod();
+            bool useJacobi = method == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::Jacobi;
+            bool usePower = method == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::Power;
+            bool useGaussSeidelStyle = method == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::GaussSeidel || method == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::SOR || (usePower && this->getSettings().getPowerMethodMultiplicationStyle() == storm::solver::MultiplicationStyle::GaussSeidel);
+            ValueType omega = method == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::SOR ? this->getSettings().getOmega() : storm::utility::one<ValueType>();
+            
+            STORM_LOG_ASSERT(!matrixValues || matrixValues->size() == A->getEntryCount() * numberOfSystems, "The size of the matrix value block does not match the number of systems.");
+            
+            // With system-specific matrix values, the Jacobi method splits off the diagonal of every system on the fly.
+            if (useJacobi && !matrixValues && !jacobiDecomposition) {
+                jacobiDecomposition = std::make_unique<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>>>(A->getJacobiDecomposition());
+            }
+            if (usePower) {
+                // As for a single system, the power method starts from the lower bounds.
+                STORM_LOG_THROW(this->hasLowerBound(), storm::exceptions::UnmetRequirementException, "Solver requires lower bound, but none was given.");
+                std::vector<ValueType> lowerBounds(getMatrixRowCount());
+                this->createLowerBoundsVector(lowerBounds);
+                for (uint64_t row = 0; row < lowerBounds.size(); ++row) {
+                    std::fill(x.begin() + row * numberOfSystems, x.begin() + (row + 1) * numberOfSystems, lowerBounds[row]);
+                }
+            }
+            
+            std::vector<ValueType> rowValues(numberOfSystems);
+            std::vector<ValueType> diagonalValues(numberOfSystems);
+            std::vector<ValueType> tmpX(x.size());
+            std::vector<ValueType>* currentX = &x;
+            std::vector<ValueType>* nextX = &tmpX;
+            
+            // Set up additional environment variables.
+            uint_fast64_t iterations = 0;
+            bool converged = false;
+            
+            this->startMeasureProgress();
+            while (!converged && iterations < this->getSettings().getMaximalNumberOfIterations()) {
+                if (useGaussSeidelStyle) {
+                    *nextX = *currentX;
+                    if (usePower) {
+                        multiplyBlockGaussSeidelBackward(*A, matrixValues, *nextX, b, numberOfSystems, rowValues);
+                    } else {
+                        performSuccessiveOverRelaxationStepBlock(*A, matrixValues, omega, *nextX, b, numberOfSystems, rowValues, diagonalValues);
+                    }
+                } else if (useJacobi && matrixValues) {
+                    performJacobiStepBlock(*A, matrixValues, *currentX, b, *nextX, numberOfSystems, rowValues, diagonalValues);
+                } else if (useJacobi) {
+                    // Compute D^-1 * (b - LU * x) and store result in nextX.
+                    std::vector<ValueType> const& jacobiD = jacobiDecomposition->second;
+                    multiplyBlock(jacobiDecomposition->first, nullptr, *currentX, nullptr, *nextX, numberOfSystems);
+                    for (uint64_t row = 0; row < jacobiD.size(); ++row) {
+                        for (uint64_t index = row * numberOfSystems, end = index + numberOfSystems; index < end; ++index) {
+                            (*nextX)[index] = jacobiD[row] * (b[index] - (*nextX)[index]);
+                        }
+                    }
+                } else {
+                    multiplyBlock(*A, matrixValues, *currentX, &b, *nextX, numberOfSystems);
+                }
+                
+                // Now check if the process already converged within our precision. As all systems are checked at
+                // once, we continue until the slowest one has converged.
+                converged = storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *nextX, static_cast<ValueType>(this->getSettings().getPrecision()), this->getSettings().getRelativeTerminationCriterion());
+                
+                // Swap the two pointers as a preparation for the next iteration.
+                std::swap(nextX, currentX);
+                
+                // Potentially show progress.
+                this->showProgressIterative(iterations);
+                
+                // Increase iteration count so we can abort if convergence is too slow.
+                ++iterations;
+            }
+            
+            // If the last iteration did not write to the original x we have to swap the contents, because the
+            // output has to be written to the input parameter x.
+            if (currentX != &x) {
+                std::swap(x, *currentX);
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            // Every iteration performs one product for each of the systems.
+            this->logIterations(converged, false, iterations, iterations * numberOfSystems);
+            
+            return converged;
+        }
+        
         template<typename ValueType>
         bool NativeLinearEquationSolver<ValueType>::isSolution(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& values, std::vector<ValueType> const& b) {
             storm::utility::ConstantsComparator<ValueType> comparator;
@@ -891,7 +1089,8 @@ namespace storm {
         }
         
         template<typename ValueType>
-        void NativeLinearEquationSolver<ValueType>::logIterations(bool converged, bool terminate, uint64_t iterations) const {
+        void NativeLinearEquationSolver<ValueType>::logIterations(bool converged, bool terminate, uint64_t iterations, uint64_t matrixVectorProducts) const {
+            storm::utility::instrumentation::addSolverIterations("linear equation solver iterations", iterations, matrixVectorProducts, this->A->getEntryCount());
             if (converged) {
                 STORM_LOG_INFO("Iterative solver converged in " << iterations << " iterations.");
             } else if (terminate) {
@@ -923,6 +1122,33 @@ namespace storm {
             return false;
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::supportsBlockIteration() const {
+            auto const& method = this->getSettings().getSolutionMethod();
+            bool blockMethod = method == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::Jacobi || method == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::GaussSeidel || method == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::SOR || (method == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::Power && !this->getSettings().getForceSoundness());
+            
+            // Custom termination conditions refer to the values of a single system, so we solve the systems separately in this case.
+            return blockMethod && !this->hasCustomTerminationCondition();
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::internalSolveEquationsMultiple(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfSystems) const {
+            if (this->supportsBlockIteration()) {
+                return this->solveEquationsBlock(x, b, numberOfSystems, nullptr);
+            }
+            return LinearEquationSolver<ValueType>::internalSolveEquationsMultiple(x, b, numberOfSystems);
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::internalSolveEquationsMultiple(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfSystems, std::vector<ValueType> const& matrixValues) const {
+            return this->solveEquationsBlock(x, b, numberOfSystems, &matrixValues);
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::supportsSystemSpecificMatrixValues() const {
+            return this->supportsBlockIteration();
+        }
+        
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::multiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
             if (&x != &result) {
@@ -70,6 +70,8 @@ namespace storm {
             void setSettings(NativeLinearEquationSolverSettings<ValueType> const& newSettings);
             NativeLinearEquationSolverSettings<ValueType> const& getSettings() const;
 
+            virtual bool supportsSystemSpecificMatrixValues() const override;
+
             virtual LinearEquationSolverProblemFormat getEquationProblemFormat() const override;
             virtual LinearEquationSolverRequirements getRequirements() const override;
 
@@ -77,6 +79,8 @@ namespace storm {
 
         protected:
             virtual bool internalSolveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+            virtual bool internalSolveEquationsMultiple(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfSystems) const override;
+            virtual bool internalSolveEquationsMultiple(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfSystems, std::vector<ValueType> const& matrixValues) const override;
             
         private:
             struct PowerIterationResult {
@@ -93,7 +97,11 @@ namespace storm {
             
             PowerIterationResult performPowerIteration(std::vector<ValueType>*& currentX, std::vector<ValueType>*& newX, std::vector<ValueType> const& b, ValueType const& precision, bool relative, SolverGuarantee const& guarantee, uint64_t currentIterations) const;
             
-            void logIterations(bool converged, bool terminate, uint64_t iterations) const;
+            /*!
+             * Reports the outcome of an iterative method and records the given number of iterations and products with
+             * the matrix in the instrumentation counters.
+             */
+            void logIterations(bool converged, bool terminate, uint64_t iterations, uint64_t matrixVectorProducts) const;
             
             virtual uint64_t getMatrixRowCount() const override;
             virtual uint64_t getMatrixColumnCount() const override;
@@ -104,6 +112,19 @@ namespace storm {
             virtual bool solveEquationsPower(std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsSoundPower(std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsRationalSearch(std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
+            /*!
+             * Retrieves whether the given block of systems can be solved with block iteration (see solveEquationsBlock)
+             * under the current settings.
+             */
+            bool supportsBlockIteration() const;
+            
+            /*!
+             * Solves the given block of systems (see solveEquationsMultiple) with the Jacobi, Gauss-Seidel, SOR or
+             * (unsound) power method. Each iteration updates the values of all systems in one pass over the matrix.
+             * If matrix values are given, they replace the values of A (see solveEquationsMultiple).
+             */
+            bool solveEquationsBlock(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfSystems, std::vector<ValueType> const* matrixValues) const;
 
             template<typename RationalType, typename ImpreciseType>
             bool solveEquationsRationalSearchHelper(NativeLinearEquationSolver<ImpreciseType> const& impreciseSolver, storm::storage::SparseMatrix<RationalType> const& rationalA, std::vector<RationalType>& rationalX, std::vector<RationalType> const& rationalB, storm::storage::SparseMatrix<ImpreciseType> const& A, std::vector<ImpreciseType>& x, std::vector<ImpreciseType> const& b, std::vector<ImpreciseType>& tmpX) const;
@@ -16,6 +16,8 @@ namespace storm {
                     return "acyclic";
                 case MinMaxMethod::RationalSearch:
                     return "ratsearch";
+                case MinMaxMethod::IntervalIteration:
+                    return "intervaliteration";
             }
             return "invalid";
         }
@@ -11,13 +11,14 @@
 #include "storm/settings/modules/MinMaxEquationSolverSettings.h"
 
 #include "storm/utility/dd.h"
+#include "storm/utility/instrumentation.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/exceptions/NoConvergenceException.h"
 #include "storm/exceptions/PrecisionExceededException.h"
 
 namespace storm {
     namespace solver {
-        
         template<typename ValueType>
         SymbolicMinMaxLinearEquationSolverSettings<ValueType>::SymbolicMinMaxLinearEquationSolverSettings() {
             // Get the settings object to customize linear solving.
@@ -26,12 +27,17 @@ namespace storm {
             maximalNumberOfIterations = settings.getMaximalIterationCount();
             precision = storm::utility::convertNumber<ValueType>(settings.getPrecision());
             relative = settings.getConvergenceCriterion() == storm::settings::modules::MinMaxEquationSolverSettings::ConvergenceCriterion::Relative;
+            topological = settings.isSymbolicTopologicalSet();
+            
+            // Solving tiny blocks of SCCs separately would incur more overhead than it saves.
+            minimalTopologicalBlockSize = 1000;
             
             auto method = settings.getMinMaxEquationSolvingMethod();
             switch (method) {
                 case MinMaxMethod::ValueIteration: this->solutionMethod = SolutionMethod::ValueIteration; break;
                 case MinMaxMethod::PolicyIteration: this->solutionMethod = SolutionMethod::PolicyIteration; break;
                 case MinMaxMethod::RationalSearch: this->solutionMethod = SolutionMethod::RationalSearch; break;
+                case MinMaxMethod::IntervalIteration: this->solutionMethod = SolutionMethod::IntervalIteration; break;
                 default:
                     STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique.");
             }
@@ -65,6 +71,16 @@ namespace storm {
             this->precision = precision;
         }
         
+        template<typename ValueType>
+        void SymbolicMinMaxLinearEquationSolverSettings<ValueType>::setTopological(bool value) {
+            this->topological = value;
+        }
+        
+        template<typename ValueType>
+        void SymbolicMinMaxLinearEquationSolverSettings<ValueType>::setMinimalTopologicalBlockSize(uint64_t value) {
+            this->minimalTopologicalBlockSize = value;
+        }
+        
         template<typename ValueType>
         typename SymbolicMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod const& SymbolicMinMaxLinearEquationSolverSettings<ValueType>::getSolutionMethod() const {
             return solutionMethod;
@@ -84,6 +100,16 @@ namespace storm {
         bool SymbolicMinMaxLinearEquationSolverSettings<ValueType>::getRelativeTerminationCriterion() const {
             return relative;
         }
+        
+        template<typename ValueType>
+        bool SymbolicMinMaxLinearEquationSolverSettings<ValueType>::getTopological() const {
+            return topological;
+        }
+        
+        template<typename ValueType>
+        uint64_t SymbolicMinMaxLinearEquationSolverSettings<ValueType>::getMinimalTopologicalBlockSize() const {
+            return minimalTopologicalBlockSize;
+        }
 
         template<storm::dd::DdType DdType, typename ValueType>
         SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::SymbolicMinMaxLinearEquationSolver(SymbolicMinMaxLinearEquationSolverSettings<ValueType> const& settings) : SymbolicEquationSolver<DdType, ValueType>(), settings(settings), uniqueSolution(false), requirementsChecked(false) {
@@ -98,6 +124,10 @@ namespace storm {
         template<storm::dd::DdType DdType, typename ValueType>
         storm::dd::Add<DdType, ValueType>  SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquations(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
             STORM_LOG_WARN_COND_DEBUG(this->isRequirementsCheckedSet(), "The requirements of the solver have not been marked as checked. Please provide the appropriate check or mark the requirements as checked (if applicable).");
+            storm::utility::instrumentation::ScopedPhase phase("solving");
+            if (this->getSettings().getTopological()) {
+                return solveEquationsTopological(dir, x, b);
+            }
             switch (this->getSettings().getSolutionMethod()) {
                 case SymbolicMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::ValueIteration:
                     return solveEquationsValueIteration(dir, x, b);
@@ -108,6 +138,9 @@ namespace storm {
                 case SymbolicMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::RationalSearch:
                     return solveEquationsRationalSearch(dir, x, b);
                     break;
+                case SymbolicMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::IntervalIteration:
+                    return solveEquationsIntervalIteration(dir, x, b);
+                    break;
             }
         }
         
@@ -302,6 +335,83 @@ namespace storm {
             return viResult.values;
         }
         
+        template<storm::dd::DdType DdType, typename ValueType>
+        storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquationsIntervalIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
+            // Perform value iteration from below and from above simultaneously. As the solution always lies in between
+            // the two vectors, the iteration can be stopped as soon as they are close enough.
+            storm::dd::Add<DdType, ValueType> lowerX = this->getLowerBoundsVector();
+            storm::dd::Add<DdType, ValueType> upperX = this->getUpperBoundsVector();
+            uint64_t iterations = 0;
+            
+            SolverStatus status = SolverStatus::InProgress;
+            while (status == SolverStatus::InProgress && iterations < this->getSettings().getMaximalNumberOfIterations()) {
+                lowerX = multiply(dir, lowerX, &b);
+                upperX = multiply(dir, upperX, &b);
+                
+                if (lowerX.equalModuloPrecision(upperX, this->getSettings().getPrecision(), this->getSettings().getRelativeTerminationCriterion())) {
+                    status = SolverStatus::Converged;
+                }
+                ++iterations;
+            }
+            
+            // The center of the interval is only guaranteed to be close to the solution if the bounds met, so we do
+            // not return it otherwise.
+            STORM_LOG_THROW(status == SolverStatus::Converged, storm::exceptions::NoConvergenceException, "Iterative solver (interval iteration) did not converge in " << iterations << " iterations.");
+            STORM_LOG_INFO("Iterative solver (interval iteration) converged in " << iterations << " iterations.");
+            
+            // Return the center of the interval, which is at most half the precision away from the solution.
+            return (lowerX + upperX) * x.getDdManager().getConstant(storm::utility::convertNumber<ValueType>(0.5));
+        }
+        
+        template<storm::dd::DdType DdType, typename ValueType>
+        storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquationsTopological(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
+            storm::dd::DdManager<DdType>& manager = x.getDdManager();
+            
+            // A state depends on all states it has a transition to under some choice.
+            storm::dd::Bdd<DdType> dependencies = this->A.notZero().existsAbstract(this->choiceVariables);
+            std::vector<storm::dd::Bdd<DdType>> blocks = storm::utility::dd::computeTopologicalSccBlocks(this->allRows, dependencies, this->rowMetaVariables, this->columnMetaVariables, this->getSettings().getMinimalTopologicalBlockSize());
+            STORM_LOG_INFO("Solving the equation system in topological order of " << blocks.size() << " block(s) of SCCs.");
+            
+            SymbolicMinMaxLinearEquationSolverSettings<ValueType> blockSettings = this->getSettings();
+            blockSettings.setTopological(false);
+            
+            storm::dd::Add<DdType, ValueType> result = manager.template getAddZero<ValueType>();
+            for (auto const& block : blocks) {
+                storm::dd::Add<DdType, ValueType> blockAdd = block.template toAdd<ValueType>();
+                storm::dd::Add<DdType, ValueType> blockAsColumnsAdd = block.swapVariables(this->rowColumnMetaVariablePairs).template toAdd<ValueType>();
+                
+                // Restrict the system to the block and fold the values of the blocks that were already solved (and
+                // that are the only other states the block depends on) into the right-hand side. The rows are
+                // restricted first, so the multiplication does not touch the rows of the other blocks.
+                storm::dd::Add<DdType, ValueType> blockRowsA = blockAdd * this->A;
+                storm::dd::Add<DdType, ValueType> blockA = blockRowsA * blockAsColumnsAdd;
+                storm::dd::Add<DdType, ValueType> blockB = blockAdd * b + blockRowsA.multiplyMatrix(result.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables);
+                
+                SymbolicMinMaxLinearEquationSolver<DdType, ValueType> blockSolver(blockA, block, this->illegalMask && block, this->rowMetaVariables, this->columnMetaVariables, this->choiceVariables, this->rowColumnMetaVariablePairs, std::make_unique<GeneralSymbolicLinearEquationSolverFactory<DdType, ValueType>>(), blockSettings);
+                if (this->hasLowerBound()) {
+                    blockSolver.setLowerBound(this->getLowerBound());
+                }
+                if (this->hasLowerBounds()) {
+                    blockSolver.setLowerBounds(blockAdd * this->getLowerBounds());
+                }
+                if (this->hasUpperBound()) {
+                    blockSolver.setUpperBound(this->getUpperBound());
+                }
+                if (this->hasUpperBounds()) {
+                    blockSolver.setUpperBounds(blockAdd * this->getUpperBounds());
+                }
+                if (this->hasInitialScheduler()) {
+                    blockSolver.setInitialScheduler(this->getInitialScheduler() && block);
+                }
+                blockSolver.setHasUniqueSolution(this->hasUniqueSolution());
+                blockSolver.setRequirementsChecked(this->isRequirementsCheckedSet());
+                
+                result += blockAdd * blockSolver.solveEquations(dir, blockAdd * x, blockB);
+            }
+            
+            return result;
+        }
+        
         template<storm::dd::DdType DdType, typename ValueType>
         storm::dd::Add<DdType, ValueType>  SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquationsWithScheduler(storm::dd::Bdd<DdType> const& scheduler, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
             
@@ -444,6 +554,12 @@ namespace storm {
                 if (!this->hasUniqueSolution() && (!direction || direction.get() == storm::solver::OptimizationDirection::Minimize)) {
                     requirements.requireNoEndComponents();
                 }
+            } else if (this->getSettings().getSolutionMethod() == SymbolicMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::IntervalIteration) {
+                // The upper bounds only converge to the solution if it is unique.
+                requirements.requireBounds();
+                if (!this->hasUniqueSolution()) {
+                    requirements.requireNoEndComponents();
+                }
             }
 
             return requirements;
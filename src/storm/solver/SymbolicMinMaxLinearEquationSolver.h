@@ -34,24 +34,34 @@ namespace storm {
             SymbolicMinMaxLinearEquationSolverSettings();
             
             enum class SolutionMethod {
-                ValueIteration, PolicyIteration, RationalSearch
+                ValueIteration, PolicyIteration, RationalSearch, IntervalIteration
             };
             
             void setSolutionMethod(SolutionMethod const& solutionMethod);
             void setMaximalNumberOfIterations(uint64_t maximalNumberOfIterations);
             void setRelativeTerminationCriterion(bool value);
             void setPrecision(ValueType precision);
+            void setTopological(bool value);
+            void setMinimalTopologicalBlockSize(uint64_t value);
             
             SolutionMethod const& getSolutionMethod() const;
             uint64_t getMaximalNumberOfIterations() const;
             ValueType getPrecision() const;
             bool getRelativeTerminationCriterion() const;
+            bool getTopological() const;
+            uint64_t getMinimalTopologicalBlockSize() const;
             
         private:
             SolutionMethod solutionMethod;
             uint64_t maximalNumberOfIterations;
             ValueType precision;
             bool relative;
+            
+            // Whether the system is to be decomposed into its SCCs that are then solved in topological order.
+            bool topological;
+            
+            // The minimal number of states of a block of SCCs that is solved separately in topological mode.
+            uint64_t minimalTopologicalBlockSize;
         };
 
         /*!
@@ -162,6 +172,14 @@ namespace storm {
             storm::dd::Add<DdType, ValueType> solveEquationsValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const;
             storm::dd::Add<DdType, ValueType> solveEquationsPolicyIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const;
             storm::dd::Add<DdType, ValueType> solveEquationsRationalSearch(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const;
+            storm::dd::Add<DdType, ValueType> solveEquationsIntervalIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const;
+            
+            /*!
+             * Decomposes the system into its strongly connected components and solves them (with the selected method)
+             * in topological order, where the values of the components that were already solved are folded into the
+             * right-hand side of the subsequent ones.
+             */
+            storm::dd::Add<DdType, ValueType> solveEquationsTopological(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const;
             
             template<typename RationalType, typename ImpreciseType>
             static storm::dd::Add<DdType, RationalType> sharpen(OptimizationDirection dir, uint64_t precision, SymbolicMinMaxLinearEquationSolver<DdType, RationalType> const& rationalSolver, storm::dd::Add<DdType, ImpreciseType> const& x, storm::dd::Add<DdType, RationalType> const& rationalB, bool& isSolution);
@@ -11,6 +11,7 @@
 
 #include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/macros.h"
+#include "storm/exceptions/NoConvergenceException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/PrecisionExceededException.h"
 
@@ -30,6 +31,9 @@ namespace storm {
                 case storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::RationalSearch:
                     this->method = SolutionMethod::RationalSearch;
                     break;
+                case storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::IntervalIteration:
+                    this->method = SolutionMethod::IntervalIteration;
+                    break;
                 case storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::Jacobi:
                 default:
                     this->method = SolutionMethod::Jacobi;
@@ -112,6 +116,8 @@ namespace storm {
                 return solveEquationsPower(x, b);
             } else if (this->getSettings().getSolutionMethod() == SymbolicNativeLinearEquationSolverSettings<ValueType>::SolutionMethod::RationalSearch) {
                 return solveEquationsRationalSearch(x, b);
+            } else if (this->getSettings().getSolutionMethod() == SymbolicNativeLinearEquationSolverSettings<ValueType>::SolutionMethod::IntervalIteration) {
+                return solveEquationsIntervalIteration(x, b);
             }
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The selected solution technique is not supported.");
         }
@@ -199,6 +205,34 @@ namespace storm {
             return result.values;
         }
 
+        template<storm::dd::DdType DdType, typename ValueType>
+        storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, ValueType>::solveEquationsIntervalIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
+            STORM_LOG_INFO("Solving symbolic linear equation system with NativeLinearEquationSolver (interval iteration)");
+            
+            // Approach the solution from below and from above simultaneously. As the true solution always lies in
+            // between the two vectors, the iteration can be stopped as soon as they are close enough.
+            storm::dd::Add<DdType, ValueType> lowerX = this->getLowerBoundsVector();
+            storm::dd::Add<DdType, ValueType> upperX = this->getUpperBoundsVector();
+            uint_fast64_t iterations = 0;
+            SolverStatus status = SolverStatus::InProgress;
+            
+            while (status == SolverStatus::InProgress && iterations < this->getSettings().getMaximalNumberOfIterations()) {
+                lowerX = this->A.multiplyMatrix(lowerX.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables) + b;
+                upperX = this->A.multiplyMatrix(upperX.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables) + b;
+                
+                if (lowerX.equalModuloPrecision(upperX, this->getSettings().getPrecision(), this->getSettings().getRelativeTerminationCriterion())) {
+                    status = SolverStatus::Converged;
+                }
+                ++iterations;
+            }
+            
+            STORM_LOG_THROW(status == SolverStatus::Converged, storm::exceptions::NoConvergenceException, "Iterative solver (interval iteration) did not converge in " << iterations << " iterations.");
+            STORM_LOG_INFO("Iterative solver (interval iteration) converged in " << iterations << " iterations.");
+            
+            // Return the center of the interval, which is at most half the precision away from the solution.
+            return (lowerX + upperX) * this->getDdManager().getConstant(storm::utility::convertNumber<ValueType>(0.5));
+        }
+
         template<storm::dd::DdType DdType, typename ValueType>
         bool SymbolicNativeLinearEquationSolver<DdType, ValueType>::isSolutionFixedPoint(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
             storm::dd::Add<DdType, ValueType> xAsColumn = x.swapVariables(this->rowColumnMetaVariablePairs);
@@ -332,6 +366,8 @@ namespace storm {
             
             if (this->getSettings().getSolutionMethod() == SymbolicNativeLinearEquationSolverSettings<ValueType>::SolutionMethod::Power || this->getSettings().getSolutionMethod() == SymbolicNativeLinearEquationSolverSettings<ValueType>::SolutionMethod::RationalSearch) {
                 requirements.requireLowerBounds();
+            } else if (this->getSettings().getSolutionMethod() == SymbolicNativeLinearEquationSolverSettings<ValueType>::SolutionMethod::IntervalIteration) {
+                requirements.requireBounds();
             }
             
             return requirements;
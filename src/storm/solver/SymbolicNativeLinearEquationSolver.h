@@ -12,7 +12,7 @@ namespace storm {
         class SymbolicNativeLinearEquationSolverSettings {
         public:
             enum class SolutionMethod {
-                Jacobi, Power, RationalSearch
+                Jacobi, Power, RationalSearch, IntervalIteration
             };
             
             SymbolicNativeLinearEquationSolverSettings();
@@ -103,6 +103,7 @@ namespace storm {
             storm::dd::Add<DdType, ValueType> solveEquationsJacobi(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const;
             storm::dd::Add<DdType, ValueType> solveEquationsPower(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const;
             storm::dd::Add<DdType, ValueType> solveEquationsRationalSearch(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const;
+            storm::dd::Add<DdType, ValueType> solveEquationsIntervalIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const;
             
             /*!
              * Determines whether the given vector x satisfies x = Ax + b.
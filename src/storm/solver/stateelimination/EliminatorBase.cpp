@@ -1,5 +1,7 @@
 #include "storm/solver/stateelimination/EliminatorBase.h"
 
+#include <iterator>
+
 #include "storm/utility/stateelimination.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
@@ -72,10 +74,13 @@ namespace storm {
                 FlexibleRowType rowsKeepingEntryInColumnEqualRow;
                 
                 // For each entry in the row d, we need to build a list of other rows that will contain an element in the
-                // column d.
-                std::vector<FlexibleRowType> newBackwardEntries(entriesInRow.size());
-                for (auto& backwardEntry : newBackwardEntries) {
-                    backwardEntry.reserve(elementsWithEntryInColumnEqualRow.size());
+                // column d. The lists are kept across eliminations, so we only clear the ones we are going to use.
+                if (newBackwardEntries.size() < entriesInRow.size()) {
+                    newBackwardEntries.resize(entriesInRow.size());
+                }
+                for (uint_fast64_t index = 0; index < entriesInRow.size(); ++index) {
+                    newBackwardEntries[index].clear();
+                    newBackwardEntries[index].reserve(elementsWithEntryInColumnEqualRow.size());
                 }
                 
                 // Now go through the rows with an entry in the column corresponding to the current row and substitute
@@ -114,9 +119,11 @@ namespace storm {
                     FlexibleRowIterator first2 = entriesInRow.begin();
                     FlexibleRowIterator last2 = entriesInRow.end();
                     
-                    FlexibleRowType newSuccessors;
+                    // Merge into the scratch buffer, which (after swapping) takes over the storage of the old row.
+                    FlexibleRowType& newSuccessors = mergeBuffer;
+                    newSuccessors.clear();
                     newSuccessors.reserve((last1 - first1) + (last2 - first2));
-                    std::insert_iterator<FlexibleRowType> result(newSuccessors, newSuccessors.end());
+                    std::back_insert_iterator<FlexibleRowType> result(newSuccessors);
                     
                     uint_fast64_t successorOffsetInNewBackwardTransitions = 0;
                     // Now we merge the two successor lists. (Code taken from std::set_union and modified to suit our needs).
@@ -166,7 +173,7 @@ namespace storm {
                     }
                     
                     // Now move the new transitions in place.
-                    predecessorForwardTransitions = std::move(newSuccessors);
+                    predecessorForwardTransitions.swap(newSuccessors);
                     STORM_LOG_TRACE("Fixed new next-state probabilities of predecessor state " << predecessor << ".");
                     
                     updatePredecessor(predecessor, multiplyFactor, row);
@@ -197,9 +204,10 @@ namespace storm {
                     FlexibleRowIterator first2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].begin();
                     FlexibleRowIterator last2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].end();
                     
-                    FlexibleRowType newPredecessors;
+                    FlexibleRowType& newPredecessors = mergeBuffer;
+                    newPredecessors.clear();
                     newPredecessors.reserve((last1 - first1) + (last2 - first2));
-                    std::insert_iterator<FlexibleRowType> result(newPredecessors, newPredecessors.end());
+                    std::back_insert_iterator<FlexibleRowType> result(newPredecessors);
                     
                     for (; first1 != last1; ++result) {
                         if (first2 == last2) {
@@ -230,7 +238,7 @@ namespace storm {
                         std::copy_if(first2, last2, result, [&] (storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() != row; });
                     }
                     // Now move the new predecessors in place.
-                    successorBackwardTransitions = std::move(newPredecessors);
+                    successorBackwardTransitions.swap(newPredecessors);
                     ++successorOffsetInNewBackwardTransitions;
                 }
                 STORM_LOG_TRACE("Fixed predecessor lists of successor states.");
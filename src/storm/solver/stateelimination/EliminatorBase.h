@@ -32,6 +32,15 @@ namespace storm {
             protected:
                 storm::storage::FlexibleSparseMatrix<ValueType>& matrix;
                 storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix;
+                
+            private:
+                // A buffer into which rows are merged. After merging, it is swapped with the target row, so the storage
+                // of the old row is recycled for the next merge instead of allocating a fresh row every time.
+                FlexibleRowType mergeBuffer;
+                
+                // For every successor of the eliminated state, the new entries of its backward row. The buffers are
+                // reused across eliminations.
+                std::vector<FlexibleRowType> newBackwardEntries;
             };
             
         } // namespace stateelimination
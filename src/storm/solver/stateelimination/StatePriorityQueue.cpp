@@ -8,6 +8,10 @@ namespace storm {
                 // Intentionally left empty.
             }
             
+            bool StatePriorityQueue::hasStaticPriorities() const {
+                return false;
+            }
+            
         }
     }
 }
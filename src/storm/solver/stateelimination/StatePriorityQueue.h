@@ -14,6 +14,12 @@ namespace storm {
                 virtual storm::storage::sparse::state_type pop() = 0;
                 virtual void update(storm::storage::sparse::state_type state);
                 virtual std::size_t size() const = 0;
+                
+                /*!
+                 * Retrieves whether the order of the states is fixed, i.e. updating the priority of a state has no effect.
+                 * Unless overridden, priorities are assumed to be dynamic.
+                 */
+                virtual bool hasStaticPriorities() const;
             };
             
         }
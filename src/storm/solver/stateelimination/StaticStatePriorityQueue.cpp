@@ -23,6 +23,10 @@ namespace storm {
                 return sortedStates.size() - currentPosition;
             }
             
+            bool StaticStatePriorityQueue::hasStaticPriorities() const {
+                return true;
+            }
+            
         }
     }
 }
@@ -15,6 +15,7 @@ namespace storm {
                 virtual bool hasNext() const override;
                 virtual storm::storage::sparse::state_type pop() override;
                 virtual std::size_t size() const override;
+                virtual bool hasStaticPriorities() const override;
                 
             private:
                 std::vector<uint_fast64_t> sortedStates;
@@ -115,8 +115,14 @@ namespace storm {
         BitVector& BitVector::operator=(BitVector const& other) {
             // Only perform the assignment if the source and target are not identical.
             if (this != &other) {
+                // Reuse the existing storage if it has the right size.
+                if (buckets == nullptr || bucketCount() != other.bucketCount()) {
+                    if (buckets != nullptr) {
+                        delete[] buckets;
+                    }
+                    buckets = new uint64_t[other.bucketCount()];
+                }
                 bitCount = other.bitCount;
-                buckets = new uint64_t[other.bucketCount()];
                 std::copy_n(other.buckets, other.bucketCount(), buckets);
             }
             return *this;
@@ -2,6 +2,8 @@
 
 #include <cstdio>
 
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
 #include <boost/container/flat_map.hpp>
 
@@ -250,10 +252,360 @@ namespace storm {
                 spp::sparse_hash_map<DdNode const*, ReuseWrapper> reuseBlocksCache;
             };
             
+            /*!
+             * A lock-free hash table (with open addressing and linear probing) that maps pairs of Sylvan nodes to
+             * nodes. It is shared by the Lace workers that perform a refinement step in parallel. Entries are never
+             * removed individually. Instead, all entries are invalidated at once by advancing the epoch of the table,
+             * which keeps the allocated buckets for the next refinement.
+             */
+            class ConcurrentNodePairCache {
+            public:
+                // The value of an entry that was inserted but not yet assigned a value.
+                static const MTBDD EMPTY;
+                
+                // The value of an entry whose value is currently computed by some worker.
+                static const MTBDD RESERVED;
+                
+                // The number of buckets that are probed before an insertion is considered to have failed.
+                static const uint64_t MAXIMAL_PROBES;
+                
+                ConcurrentNodePairCache() : capacity(0), epoch(0), numberOfEntries(0) {
+                    // Intentionally left empty.
+                }
+                
+                /*!
+                 * Invalidates all entries and makes sure that the table has at least the given number of buckets.
+                 */
+                void reset(uint64_t minimalCapacity) {
+                    uint64_t newCapacity = 1024;
+                    while (newCapacity < minimalCapacity) {
+                        newCapacity <<= 1;
+                    }
+                    
+                    if (newCapacity > capacity) {
+                        buckets.reset(new Bucket[newCapacity]);
+                        for (uint64_t index = 0; index < newCapacity; ++index) {
+                            buckets[index].state.store(0, std::memory_order_relaxed);
+                        }
+                        capacity = newCapacity;
+                        epoch = 0;
+                    }
+                    ++epoch;
+                    numberOfEntries.store(0, std::memory_order_relaxed);
+                }
+                
+                /*!
+                 * Retrieves the value slot of the entry with the given key. If there is no such entry and insertion is
+                 * requested, a new entry with value EMPTY is created.
+                 *
+                 * @return The value slot of the entry or null if there is no such entry (or it could not be inserted,
+                 * because the probed buckets are all occupied).
+                 */
+                std::atomic<MTBDD>* find(MTBDD first, MTBDD second, bool insert) {
+                    uint64_t const writingState = epoch << 1;
+                    uint64_t const readyState = writingState | 1;
+                    
+                    uint64_t index = SylvanMTBDDPairHash()(std::make_pair(first, second)) & (capacity - 1);
+                    for (uint64_t probe = 0; probe < MAXIMAL_PROBES && probe < capacity; ++probe, index = (index + 1) & (capacity - 1)) {
+                        Bucket& bucket = buckets[index];
+                        uint64_t state = bucket.state.load(std::memory_order_acquire);
+                        
+                        // Buckets of older epochs are free. As entries are never removed, the key is not contained if
+                        // the probing hits a free bucket.
+                        if ((state >> 1) != epoch) {
+                            if (!insert) {
+                                return nullptr;
+                            }
+                            if (bucket.state.compare_exchange_strong(state, writingState, std::memory_order_acq_rel)) {
+                                bucket.first = first;
+                                bucket.second = second;
+                                bucket.value.store(EMPTY, std::memory_order_relaxed);
+                                bucket.state.store(readyState, std::memory_order_release);
+                                numberOfEntries.fetch_add(1, std::memory_order_relaxed);
+                                return &bucket.value;
+                            }
+                        }
+                        
+                        // Wait for a concurrent insertion to write the key of the bucket.
+                        while (state != readyState) {
+                            state = bucket.state.load(std::memory_order_acquire);
+                        }
+                        if (bucket.first == first && bucket.second == second) {
+                            return &bucket.value;
+                        }
+                    }
+                    return nullptr;
+                }
+                
+                /*!
+                 * Marks the values of all entries, such that they survive a garbage collection of Sylvan.
+                 */
+                void mark() const {
+                    LACE_ME;
+                    uint64_t const readyState = (epoch << 1) | 1;
+                    for (uint64_t index = 0; index < capacity; ++index) {
+                        Bucket const& bucket = buckets[index];
+                        if (bucket.state.load(std::memory_order_acquire) == readyState) {
+                            MTBDD value = bucket.value.load(std::memory_order_acquire);
+                            if (value != EMPTY && value != RESERVED) {
+                                mtbdd_gc_mark_rec(value);
+                            }
+                        }
+                    }
+                }
+                
+                uint64_t size() const {
+                    return numberOfEntries.load(std::memory_order_relaxed);
+                }
+                
+            private:
+                struct Bucket {
+                    // The epoch in which the bucket was last written (shifted by one bit) and a flag that indicates
+                    // whether the key was completely written.
+                    std::atomic<uint64_t> state;
+                    MTBDD first;
+                    MTBDD second;
+                    std::atomic<MTBDD> value;
+                };
+                
+                std::unique_ptr<Bucket[]> buckets;
+                uint64_t capacity;
+                uint64_t epoch;
+                std::atomic<uint64_t> numberOfEntries;
+            };
+            
+            const MTBDD ConcurrentNodePairCache::EMPTY = mtbdd_invalid;
+            const MTBDD ConcurrentNodePairCache::RESERVED = mtbdd_invalid - 1;
+            const uint64_t ConcurrentNodePairCache::MAXIMAL_PROBES = 64;
+            
+            /*!
+             * The data that is shared by the Lace tasks that perform a refinement step with Sylvan.
+             */
+            struct SylvanRefinementContext {
+                bool shiftStateVariables;
+                uint64_t numberOfBlockVariables;
+                BDD blockCube;
+                
+                // The current number of blocks of the new partition.
+                std::atomic<uint64_t> nextFreeBlockIndex;
+                
+                // The cache used to identify states with identical signature.
+                ConcurrentNodePairCache signatureCache;
+                
+                // The cache used to identify which old block numbers have already been reused.
+                ConcurrentNodePairCache reuseBlocksCache;
+                
+                // If the lock-free caches run out of buckets, the remaining entries are stored in the following
+                // (locked) caches. The signature cache stores whether the old block was reused and the block index
+                // otherwise, such that no Sylvan operation is performed while the lock is held.
+                std::mutex overflowSignatureCacheMutex;
+                spp::sparse_hash_map<std::pair<MTBDD, MTBDD>, std::pair<bool, uint64_t>, SylvanMTBDDPairHash> overflowSignatureCache;
+                std::mutex overflowReuseBlocksCacheMutex;
+                spp::sparse_hash_map<MTBDD, ReuseWrapper> overflowReuseBlocksCache;
+            };
+            
+            // The context of the currently running refinement (if any). It is used to protect the cached results from
+            // being collected by a garbage collection during the refinement.
+            static SylvanRefinementContext* currentSylvanRefinementContext = nullptr;
+            
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wzero-length-array"
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#endif
+            
+            VOID_TASK_0(storm_mark_signature_refinement_caches) {
+                if (currentSylvanRefinementContext != nullptr) {
+                    currentSylvanRefinementContext->signatureCache.mark();
+                }
+            }
+            
+            static BDD encodeBlock(SylvanRefinementContext const& context, uint64_t blockIndex) {
+                std::vector<uint8_t> e(context.numberOfBlockVariables);
+                for (uint64_t i = 0; i < context.numberOfBlockVariables; ++i) {
+                    e[i] = blockIndex & 1 ? 1 : 0;
+                    blockIndex >>= 1;
+                }
+                return sylvan_cube(context.blockCube, e.data());
+            }
+            
+            /*!
+             * Checks whether the given (old) block has not been reused yet and, if so, marks it as reused.
+             */
+            static bool claimOldBlock(SylvanRefinementContext& context, BDD partitionNode) {
+                std::atomic<MTBDD>* reuseEntry = context.reuseBlocksCache.find(partitionNode, 0, true);
+                if (reuseEntry != nullptr) {
+                    MTBDD expected = ConcurrentNodePairCache::EMPTY;
+                    return reuseEntry->compare_exchange_strong(expected, partitionNode, std::memory_order_acq_rel);
+                }
+                
+                std::lock_guard<std::mutex> lock(context.overflowReuseBlocksCacheMutex);
+                auto& reuseBlockEntry = context.overflowReuseBlocksCache[partitionNode];
+                if (!reuseBlockEntry.isReused()) {
+                    reuseBlockEntry.setReused();
+                    return true;
+                }
+                return false;
+            }
+            
+            TASK_DECL_5(BDD, storm_refine_partition, void*, BDD, MTBDD, BDD, BDD)
+            TASK_IMPL_5(BDD, storm_refine_partition, void*, contextPointer, BDD, partitionNode, MTBDD, signatureNode, BDD, nondeterminismVariablesNode, BDD, nonBlockVariablesNode) {
+                SylvanRefinementContext& context = *static_cast<SylvanRefinementContext*>(contextPointer);
+                
+                // If we arrived at the constant zero node, then this was an illegal state encoding (we require
+                // all states to be non-deadlock).
+                if (partitionNode == sylvan_false) {
+                    return partitionNode;
+                }
+                
+                STORM_LOG_ASSERT(partitionNode != mtbdd_false, "Expected non-false node.");
+                
+                // Check the cache whether we have seen the same node before.
+                std::atomic<MTBDD>* cacheEntry = context.signatureCache.find(signatureNode, partitionNode, false);
+                if (cacheEntry != nullptr) {
+                    MTBDD cachedResult = cacheEntry->load(std::memory_order_acquire);
+                    if (cachedResult != ConcurrentNodePairCache::EMPTY && cachedResult != ConcurrentNodePairCache::RESERVED) {
+                        // If so, we return the corresponding result.
+                        return cachedResult;
+                    }
+                }
+                
+                sylvan_gc_test();
+                
+                // If there are no more non-block variables, we hit the signature.
+                if (sylvan_isconst(nonBlockVariablesNode)) {
+                    // The first worker to encounter this signature (in this traversal) determines its block. The block
+                    // is the old one if no other signature has reused it yet and a new one otherwise.
+                    cacheEntry = context.signatureCache.find(signatureNode, partitionNode, true);
+                    if (cacheEntry == nullptr) {
+                        std::pair<bool, uint64_t> block;
+                        {
+                            std::lock_guard<std::mutex> lock(context.overflowSignatureCacheMutex);
+                            auto overflowIt = context.overflowSignatureCache.find(std::make_pair(signatureNode, partitionNode));
+                            if (overflowIt != context.overflowSignatureCache.end()) {
+                                block = overflowIt->second;
+                            } else {
+                                block.first = claimOldBlock(context, partitionNode);
+                                block.second = block.first ? 0 : context.nextFreeBlockIndex.fetch_add(1);
+                                context.overflowSignatureCache.emplace(std::make_pair(signatureNode, partitionNode), block);
+                            }
+                        }
+                        return block.first ? partitionNode : encodeBlock(context, block.second);
+                    }
+                    
+                    MTBDD result = ConcurrentNodePairCache::EMPTY;
+                    if (cacheEntry->compare_exchange_strong(result, ConcurrentNodePairCache::RESERVED, std::memory_order_acq_rel)) {
+                        if (claimOldBlock(context, partitionNode)) {
+                            result = partitionNode;
+                        } else {
+                            result = encodeBlock(context, context.nextFreeBlockIndex.fetch_add(1));
+                        }
+                        cacheEntry->store(result, std::memory_order_release);
+                        return result;
+                    }
+                    
+                    // Another worker determines the block, so we wait for it (while taking part in garbage
+                    // collections that the other worker may trigger).
+                    while (result == ConcurrentNodePairCache::RESERVED) {
+                        sylvan_gc_test();
+                        result = cacheEntry->load(std::memory_order_acquire);
+                    }
+                    return result;
+                } else {
+                    // If there are more variables that belong to the non-block part of the encoding, we need to recursively descend.
+                    
+                    bool skippedBoth = true;
+                    BDD partitionThen;
+                    BDD partitionElse;
+                    MTBDD signatureThen;
+                    MTBDD signatureElse;
+                    short offset;
+                    bool isNondeterminismVariable = false;
+                    while (skippedBoth && !sylvan_isconst(nonBlockVariablesNode)) {
+                        // Remember an offset that indicates whether the top variable is a nondeterminism variable or not.
+                        offset = context.shiftStateVariables ? 1 : 0;
+                        if (!sylvan_isconst(nondeterminismVariablesNode) && sylvan_var(nondeterminismVariablesNode) == sylvan_var(nonBlockVariablesNode)) {
+                            offset = 0;
+                            isNondeterminismVariable = true;
+                        }
+                        
+                        if (storm::dd::InternalAdd<storm::dd::DdType::Sylvan, double>::matchesVariableIndex(partitionNode, sylvan_var(nonBlockVariablesNode), -offset)) {
+                            partitionThen = sylvan_high(partitionNode);
+                            partitionElse = sylvan_low(partitionNode);
+                            skippedBoth = false;
+                        } else {
+                            partitionThen = partitionElse = partitionNode;
+                        }
+                        
+                        if (storm::dd::InternalAdd<storm::dd::DdType::Sylvan, double>::matchesVariableIndex(signatureNode, sylvan_var(nonBlockVariablesNode))) {
+                            signatureThen = sylvan_high(signatureNode);
+                            signatureElse = sylvan_low(signatureNode);
+                            skippedBoth = false;
+                        } else {
+                            signatureThen = signatureElse = signatureNode;
+                        }
+                        
+                        // If both (signature and partition) skipped the next variable, we fast-forward.
+                        if (skippedBoth) {
+                            // If the current variable is a nondeterminism variable, we need to advance both variable sets otherwise just the non-block variables.
+                            nonBlockVariablesNode = sylvan_high(nonBlockVariablesNode);
+                            if (isNondeterminismVariable) {
+                                nondeterminismVariablesNode = sylvan_high(nondeterminismVariablesNode);
+                            }
+                        }
+                    }
+                    
+                    // If there are no more non-block variables remaining, make a recursive call to enter the base case.
+                    if (sylvan_isconst(nonBlockVariablesNode)) {
+                        return CALL(storm_refine_partition, contextPointer, partitionNode, signatureNode, nondeterminismVariablesNode, nonBlockVariablesNode);
+                    }
+                    
+                    // Refine the else-branch in parallel to the then-branch.
+                    BDD nextNondeterminismVariablesNode = isNondeterminismVariable ? sylvan_high(nondeterminismVariablesNode) : nondeterminismVariablesNode;
+                    bdd_refs_spawn(SPAWN(storm_refine_partition, contextPointer, partitionElse, signatureElse, nextNondeterminismVariablesNode, sylvan_high(nonBlockVariablesNode)));
+                    BDD thenResult = bdd_refs_push(CALL(storm_refine_partition, contextPointer, partitionThen, signatureThen, nextNondeterminismVariablesNode, sylvan_high(nonBlockVariablesNode)));
+                    BDD elseResult = bdd_refs_push(bdd_refs_sync(SYNC(storm_refine_partition)));
+                    
+                    BDD result;
+                    if (thenResult == elseResult) {
+                        result = thenResult;
+                    } else {
+                        // Get the node to connect the subresults.
+                        result = sylvan_makenode(sylvan_var(nonBlockVariablesNode) + offset, elseResult, thenResult);
+                    }
+                    
+                    // Dispose of the intermediate results.
+                    bdd_refs_pop(2);
+                    
+                    // Store the result in the cache. As the result of an inner node is canonical, it does not matter
+                    // if another worker stored it concurrently or if the cache has run out of buckets.
+                    cacheEntry = context.signatureCache.find(signatureNode, partitionNode, true);
+                    if (cacheEntry != nullptr) {
+                        MTBDD expected = ConcurrentNodePairCache::EMPTY;
+                        cacheEntry->compare_exchange_strong(expected, result, std::memory_order_acq_rel);
+                    }
+                    
+                    return result;
+                }
+            }
+            
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+            
             template<typename ValueType>
             class InternalSignatureRefiner<storm::dd::DdType::Sylvan, ValueType> {
             public:
-                InternalSignatureRefiner(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& manager, storm::expressions::Variable const& blockVariable, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& nondeterminismVariables, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& nonBlockVariables, bool shiftStateVariables) : manager(manager), internalDdManager(manager.getInternalDdManager()), blockVariable(blockVariable), nondeterminismVariables(nondeterminismVariables), nonBlockVariables(nonBlockVariables), shiftStateVariables(shiftStateVariables), numberOfBlockVariables(manager.getMetaVariable(blockVariable).getNumberOfDdVariables()), blockCube(manager.getMetaVariable(blockVariable).getCube()), nextFreeBlockIndex(0), numberOfRefinements(0), signatureCache() {
+                InternalSignatureRefiner(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& manager, storm::expressions::Variable const& blockVariable, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& nondeterminismVariables, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& nonBlockVariables, bool shiftStateVariables) : manager(manager), internalDdManager(manager.getInternalDdManager()), blockVariable(blockVariable), nondeterminismVariables(nondeterminismVariables), nonBlockVariables(nonBlockVariables), blockCube(manager.getMetaVariable(blockVariable).getCube()), numberOfRefinements(0) {
+                    context.shiftStateVariables = shiftStateVariables;
+                    context.numberOfBlockVariables = manager.getMetaVariable(blockVariable).getNumberOfDdVariables();
+                    context.blockCube = blockCube.getInternalBdd().getSylvanBdd().GetBDD();
+                    context.nextFreeBlockIndex.store(0);
+                    
+                    // Register the marking of the cached results with the garbage collection. The manager re-registers it
+                    // whenever Sylvan is initialized again.
+                    storm::dd::InternalDdManager<storm::dd::DdType::Sylvan>::addGarbageCollectionMark(TASK(storm_mark_signature_refinement_caches));
+                    
                     // Perform garbage collection to clean up stuff not needed anymore.
                     LACE_ME;
                     sylvan_gc();
@@ -261,7 +613,7 @@ namespace storm {
                 
                 Partition<storm::dd::DdType::Sylvan, ValueType> refine(Partition<storm::dd::DdType::Sylvan, ValueType> const& oldPartition, Signature<storm::dd::DdType::Sylvan, ValueType> const& signature) {
                     storm::dd::Bdd<storm::dd::DdType::Sylvan> newPartitionBdd = refine(oldPartition, signature.getSignatureAdd());
-                    return oldPartition.replacePartition(newPartitionBdd, nextFreeBlockIndex);
+                    return oldPartition.replacePartition(newPartitionBdd, context.nextFreeBlockIndex.load());
                 }
                 
             private:
@@ -273,165 +625,27 @@ namespace storm {
                     // Set up next refinement.
                     ++numberOfRefinements;
                     
-                    // Clear the caches.
-                    std::size_t oldSize = signatureCache.size();
-                    signatureCache.clear();
-                    signatureCache.reserve(3 * oldSize);
-                    reuseBlocksCache.clear();
-                    reuseBlocksCache.reserve(3 * oldPartition.getNumberOfBlocks());
-                    nextFreeBlockIndex = oldPartition.getNextFreeBlockIndex();
-
-                    // Clear performance counters.
-//                    signatureCacheLookups = 0;
-//                    signatureCacheHits = 0;
-//                    numberOfVisitedNodes = 0;
-//                    totalSignatureCacheLookupTime = std::chrono::high_resolution_clock::duration(0);
-//                    totalSignatureCacheStoreTime = std::chrono::high_resolution_clock::duration(0);
-//                    totalReuseBlocksLookupTime = std::chrono::high_resolution_clock::duration(0);
-//                    totalLevelLookupTime = std::chrono::high_resolution_clock::duration(0);
-//                    totalBlockEncodingTime = std::chrono::high_resolution_clock::duration(0);
-//                    totalMakeNodeTime = std::chrono::high_resolution_clock::duration(0);
+                    // Invalidate the caches. Their buckets are only reallocated if they are expected to be too small.
+                    context.signatureCache.reset(3 * context.signatureCache.size());
+                    context.reuseBlocksCache.reset(3 * oldPartition.getNumberOfBlocks());
+                    context.overflowSignatureCache.clear();
+                    context.overflowReuseBlocksCache.clear();
+                    context.nextFreeBlockIndex.store(oldPartition.getNextFreeBlockIndex());
                     
-                    // Perform the actual recursive refinement step.
-                    BDD result = refine(oldPartition.asBdd().getInternalBdd().getSylvanBdd().GetBDD(), signatureAdd.getInternalAdd().getSylvanMtbdd().GetMTBDD(), nondeterminismVariables.getInternalBdd().getSylvanBdd().GetBDD(), nonBlockVariables.getInternalBdd().getSylvanBdd().GetBDD());
+                    // Perform the actual recursive refinement step (in parallel).
+                    currentSylvanRefinementContext = &context;
+                    BDD result = CALL(storm_refine_partition, &context, oldPartition.asBdd().getInternalBdd().getSylvanBdd().GetBDD(), signatureAdd.getInternalAdd().getSylvanMtbdd().GetMTBDD(), nondeterminismVariables.getInternalBdd().getSylvanBdd().GetBDD(), nonBlockVariables.getInternalBdd().getSylvanBdd().GetBDD());
+                    currentSylvanRefinementContext = nullptr;
+                    
+                    STORM_LOG_TRACE("Refinement stored " << context.signatureCache.size() << " entries in the signature cache and " << context.overflowSignatureCache.size() << " in its overflow.");
 
                     // Construct resulting BDD from the obtained node and the meta information.
                     storm::dd::InternalBdd<storm::dd::DdType::Sylvan> internalNewPartitionBdd(&internalDdManager, sylvan::Bdd(result));
                     storm::dd::Bdd<storm::dd::DdType::Sylvan> newPartitionBdd(oldPartition.asBdd().getDdManager(), internalNewPartitionBdd, oldPartition.asBdd().getContainedMetaVariables());
                     
-//                    // Display some statistics.
-//                    STORM_LOG_TRACE("Refinement visited " << numberOfVisitedNodes << " nodes.");
-//                    STORM_LOG_TRACE("Current #nodes in table: " << llmsset_count_marked(nodes) << " of " << llmsset_get_size(nodes) << ", cache: " << cache_getused() << " of " << cache_getsize() << ".");
-//                    STORM_LOG_TRACE("Signature cache hits: " << signatureCacheHits << ", misses: " << (signatureCacheLookups - signatureCacheHits) << ".");
-//                    STORM_LOG_TRACE("Signature cache lookup time: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalSignatureCacheLookupTime).count() << "ms");
-//                    STORM_LOG_TRACE("Signature cache store time: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalSignatureCacheStoreTime).count() << "ms");
-//                    STORM_LOG_TRACE("Signature cache total time: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalSignatureCacheStoreTime + totalSignatureCacheLookupTime).count() << "ms");
-//                    STORM_LOG_TRACE("Reuse blocks lookup time: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalReuseBlocksLookupTime).count() << "ms");
-//                    STORM_LOG_TRACE("Level lookup time: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalLevelLookupTime).count() << "ms");
-//                    STORM_LOG_TRACE("Block encoding time: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalBlockEncodingTime).count() << "ms");
-//                    STORM_LOG_TRACE("Make node time: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalMakeNodeTime).count() << "ms");
-                    
                     return newPartitionBdd;
                 }
                 
-                BDD encodeBlock(uint64_t blockIndex) {
-                    std::vector<uint8_t> e(numberOfBlockVariables);
-                    for (uint64_t i = 0; i < numberOfBlockVariables; ++i) {
-                        e[i] = blockIndex & 1 ? 1 : 0;
-                        blockIndex >>= 1;
-                    }
-                    return sylvan_cube(blockCube.getInternalBdd().getSylvanBdd().GetBDD(), e.data());
-                }
-                
-                BDD refine(BDD partitionNode, MTBDD signatureNode, BDD nondeterminismVariablesNode, BDD nonBlockVariablesNode) {
-                    LACE_ME;
-                    
-                    // If we arrived at the constant zero node, then this was an illegal state encoding (we require
-                    // all states to be non-deadlock).
-                    if (partitionNode == sylvan_false) {
-                        return partitionNode;
-                    }
-                    
-                    STORM_LOG_ASSERT(partitionNode != mtbdd_false, "Expected non-false node.");
-
-                    // Check the cache whether we have seen the same node before.
-                    auto nodePair = std::make_pair(signatureNode, partitionNode);
-                    auto it = signatureCache.find(nodePair);
-                    if (it != signatureCache.end()) {
-                        // If so, we return the corresponding result.
-                        return it->second;
-                    }
-                    
-                    sylvan_gc_test();
-                    
-                    // If there are no more non-block variables, we hit the signature.
-                    if (sylvan_isconst(nonBlockVariablesNode)) {
-                        // If this is the first time (in this traversal) that we encounter this signature, we check
-                        // whether we can assign the old block number to it.
-
-                        auto& reuseBlockEntry = reuseBlocksCache[partitionNode];
-                        if (!reuseBlockEntry.isReused()) {
-                            reuseBlockEntry.setReused();
-                            reuseBlocksCache.emplace(partitionNode, true);
-                            signatureCache[nodePair] = partitionNode;
-                            return partitionNode;
-                        } else {
-                            BDD result = encodeBlock(nextFreeBlockIndex++);
-                            signatureCache[nodePair] = result;
-                            return result;
-                        }
-                    } else {
-                        // If there are more variables that belong to the non-block part of the encoding, we need to recursively descend.
-                        
-                        bool skippedBoth = true;
-                        BDD partitionThen;
-                        BDD partitionElse;
-                        MTBDD signatureThen;
-                        MTBDD signatureElse;
-                        short offset;
-                        bool isNondeterminismVariable = false;
-                        while (skippedBoth && !sylvan_isconst(nonBlockVariablesNode)) {
-                            // Remember an offset that indicates whether the top variable is a nondeterminism variable or not.
-                            offset = shiftStateVariables ? 1 : 0;
-                            if (!sylvan_isconst(nondeterminismVariablesNode) && sylvan_var(nondeterminismVariablesNode) == sylvan_var(nonBlockVariablesNode)) {
-                                offset = 0;
-                                isNondeterminismVariable = true;
-                            }
-
-                            if (storm::dd::InternalAdd<storm::dd::DdType::Sylvan, ValueType>::matchesVariableIndex(partitionNode, sylvan_var(nonBlockVariablesNode), -offset)) {
-                                partitionThen = sylvan_high(partitionNode);
-                                partitionElse = sylvan_low(partitionNode);
-                                skippedBoth = false;
-                            } else {
-                                partitionThen = partitionElse = partitionNode;
-                            }
-                            
-                            if (storm::dd::InternalAdd<storm::dd::DdType::Sylvan, ValueType>::matchesVariableIndex(signatureNode, sylvan_var(nonBlockVariablesNode))) {
-                                signatureThen = sylvan_high(signatureNode);
-                                signatureElse = sylvan_low(signatureNode);
-                                skippedBoth = false;
-                            } else {
-                                signatureThen = signatureElse = signatureNode;
-                            }
-                            
-                            // If both (signature and partition) skipped the next variable, we fast-forward.
-                            if (skippedBoth) {
-                                // If the current variable is a nondeterminism variable, we need to advance both variable sets otherwise just the non-block variables.
-                                nonBlockVariablesNode = sylvan_high(nonBlockVariablesNode);
-                                if (isNondeterminismVariable) {
-                                    nondeterminismVariablesNode = sylvan_high(nondeterminismVariablesNode);
-                                }
-                            }
-                        }
-                        
-                        // If there are no more non-block variables remaining, make a recursive call to enter the base case.
-                        if (sylvan_isconst(nonBlockVariablesNode)) {
-                            return refine(partitionNode, signatureNode, nondeterminismVariablesNode, nonBlockVariablesNode);
-                        }
-                        
-                        BDD thenResult = refine(partitionThen, signatureThen, isNondeterminismVariable ? sylvan_high(nondeterminismVariablesNode) : nondeterminismVariablesNode, sylvan_high(nonBlockVariablesNode));
-                        bdd_refs_push(thenResult);
-                        BDD elseResult = refine(partitionElse, signatureElse, isNondeterminismVariable ? sylvan_high(nondeterminismVariablesNode) : nondeterminismVariablesNode, sylvan_high(nonBlockVariablesNode));
-                        bdd_refs_push(elseResult);
-                        
-                        BDD result;
-                        if (thenResult == elseResult) {
-                            result = thenResult;
-                        } else {
-                            // Get the node to connect the subresults.
-                            result = sylvan_makenode(sylvan_var(nonBlockVariablesNode) + offset, elseResult, thenResult);
-                        }
-                        
-                        // Dispose of the intermediate results.
-                        bdd_refs_pop(2);
-                        
-                        // Store the result in the cache.
-                        signatureCache[nodePair] = result;
-                        
-                        return result;
-                    }
-                }
-                
                 storm::dd::DdManager<storm::dd::DdType::Sylvan> const& manager;
                 storm::dd::InternalDdManager<storm::dd::DdType::Sylvan> const& internalDdManager;
                 storm::expressions::Variable const& blockVariable;
@@ -439,35 +653,13 @@ namespace storm {
                 storm::dd::Bdd<storm::dd::DdType::Sylvan> nondeterminismVariables;
                 storm::dd::Bdd<storm::dd::DdType::Sylvan> nonBlockVariables;
                 
-                bool shiftStateVariables;
-                
-                uint64_t numberOfBlockVariables;
-                
                 storm::dd::Bdd<storm::dd::DdType::Sylvan> blockCube;
                 
-                // The current number of blocks of the new partition.
-                uint64_t nextFreeBlockIndex;
-                
                 // The number of completed refinements.
                 uint64_t numberOfRefinements;
                 
-                // The cache used to identify states with identical signature.
-                spp::sparse_hash_map<std::pair<MTBDD, MTBDD>, MTBDD, SylvanMTBDDPairHash> signatureCache;
-                
-                // The cache used to identify which old block numbers have already been reused.
-                spp::sparse_hash_map<MTBDD, ReuseWrapper> reuseBlocksCache;
-                
-                // Performance counters.
-//                uint64_t signatureCacheLookups;
-//                uint64_t signatureCacheHits;
-//                uint64_t numberOfVisitedNodes;
-//                std::chrono::high_resolution_clock::duration totalSignatureCacheLookupTime;
-//                std::chrono::high_resolution_clock::duration totalSignatureCacheStoreTime;
-//                std::chrono::high_resolution_clock::duration totalReuseBlocksLookupTime;
-//                std::chrono::high_resolution_clock::duration totalLevelLookupTime;
-//                std::chrono::high_resolution_clock::duration totalBlockEncodingTime;
-//                std::chrono::high_resolution_clock::duration totalMakeNodeTime;
-                
+                // The data shared by the tasks of the refinement.
+                SylvanRefinementContext context;
             };
             
             template<storm::dd::DdType DdType, typename ValueType>
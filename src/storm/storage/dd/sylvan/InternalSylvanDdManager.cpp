@@ -1,5 +1,7 @@
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <iostream>
 
@@ -8,6 +10,7 @@
 
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/resources.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 
@@ -18,7 +21,48 @@
 namespace storm {
     namespace dd {
         
-#ifndef NDEBUG
+        namespace detail {
+            // Statistics about the garbage collections and the node table. They are kept across the lifetime of
+            // Sylvan, such that they can be reported after the last manager was destroyed.
+            struct SylvanStatistics {
+                bool initialized = false;
+                uint64_t numberOfGarbageCollections = 0;
+                std::chrono::high_resolution_clock::duration totalGarbageCollectionTime = std::chrono::high_resolution_clock::duration::zero();
+                std::chrono::high_resolution_clock::duration maximalGarbageCollectionTime = std::chrono::high_resolution_clock::duration::zero();
+                std::chrono::high_resolution_clock::time_point garbageCollectionStart;
+                uint64_t peakNumberOfNodes = 0;
+                uint64_t maximalTableSize = 0;
+                uint64_t cacheLookups = 0;
+                uint64_t cacheHits = 0;
+            };
+            
+            static SylvanStatistics statistics;
+            
+            // The fill rate (in percent) of the node table after a garbage collection above which the tables are grown.
+            static uint64_t resizeThreshold = 50;
+            
+            void updateStatistics(size_t numberOfNodes, size_t tableSize) {
+                statistics.peakNumberOfNodes = std::max(statistics.peakNumberOfNodes, static_cast<uint64_t>(numberOfNodes));
+                statistics.maximalTableSize = std::max(statistics.maximalTableSize, static_cast<uint64_t>(tableSize));
+            }
+            
+            void updateCacheStatistics() {
+#if SYLVAN_STATS
+                LACE_ME;
+                sylvan_stats_t snapshot;
+                sylvan_stats_snapshot(&snapshot);
+                
+                // The counters of the operations come in triples of calls, cache insertions and cache hits.
+                statistics.cacheLookups = 0;
+                statistics.cacheHits = 0;
+                for (uint64_t counter = BDD_ITE; counter < SYLVAN_GC_COUNT; counter += 3) {
+                    statistics.cacheLookups += snapshot.counters[counter];
+                    statistics.cacheHits += snapshot.counters[counter + 2];
+                }
+#endif
+            }
+        }
+        
 #if defined(__clang__)
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wzero-length-array"
@@ -27,16 +71,34 @@ namespace storm {
         
         VOID_TASK_0(gc_start) {
             STORM_LOG_TRACE("Starting sylvan garbage collection...");
+            detail::statistics.garbageCollectionStart = std::chrono::high_resolution_clock::now();
         }
         
         VOID_TASK_0(gc_end) {
-            STORM_LOG_TRACE("Sylvan garbage collection done.");
+            std::chrono::high_resolution_clock::duration duration = std::chrono::high_resolution_clock::now() - detail::statistics.garbageCollectionStart;
+            ++detail::statistics.numberOfGarbageCollections;
+            detail::statistics.totalGarbageCollectionTime += duration;
+            detail::statistics.maximalGarbageCollectionTime = std::max(detail::statistics.maximalGarbageCollectionTime, duration);
+            STORM_LOG_TRACE("Sylvan garbage collection done in " << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() << "ms.");
+        }
+        
+        VOID_TASK_0(gc_resize) {
+            // At this point, all live nodes are marked, so the number of filled buckets is the number of live nodes.
+            size_t numberOfNodes = 0;
+            size_t tableSize = 0;
+            sylvan_table_usage(&numberOfNodes, &tableSize);
+            detail::updateStatistics(numberOfNodes, tableSize);
+            
+            // Only grow the tables if the garbage collection did not free enough of the node table. Otherwise, the
+            // footprint stays the same and Sylvan runs into the next garbage collection earlier.
+            if (numberOfNodes * 100 > detail::resizeThreshold * tableSize) {
+                STORM_LOG_TRACE("Growing sylvan tables, because " << numberOfNodes << " of " << tableSize << " nodes are live.");
+                CALL(sylvan_gc_aggressive_resize);
+            }
         }
         
 #if defined(__clang__)
 #pragma clang diagnostic pop
-#endif
-        
 #endif
         
         uint_fast64_t InternalDdManager<DdType::Sylvan>::numberOfInstances = 0;
@@ -45,14 +107,7 @@ namespace storm {
         // some operations.
         uint_fast64_t InternalDdManager<DdType::Sylvan>::nextFreeVariableIndex = 0;
         
-        uint_fast64_t findLargestPowerOfTwoFitting(uint_fast64_t number) {
-            for (uint_fast64_t index = 0; index < 64; ++index) {
-                if ((number & (1ull << (63 - index))) != 0) {
-                    return 63 - index;
-                }
-            }
-            return 0;
-        }
+        std::vector<gc_hook_cb> InternalDdManager<DdType::Sylvan>::garbageCollectionMarks;
         
         InternalDdManager<DdType::Sylvan>::InternalDdManager() {
             if (numberOfInstances == 0) {
@@ -64,35 +119,34 @@ namespace storm {
                 }
                 lace_startup(0, 0, 0);
                 
-                // Each node takes 24 bytes and the maximal memory is specified in megabytes.
-                uint_fast64_t totalNodesToStore = storm::settings::getModule<storm::settings::modules::SylvanSettings>().getMaximalMemory() * 1024 * 1024 / 24;
-                
-                // Compute the power of two that still fits within the total numbers to store.
-                uint_fast64_t powerOfTwo = findLargestPowerOfTwoFitting(totalNodesToStore);
-                
-                STORM_LOG_THROW(powerOfTwo >= 16, storm::exceptions::InvalidSettingsException, "Too little memory assigned to sylvan.");
-                
-                uint64_t maxTableSize = 1ull << powerOfTwo;
-                uint64_t maxCacheSize = 1ull << (powerOfTwo - 1);
-                if (maxTableSize + maxCacheSize > totalNodesToStore) {
-                    maxTableSize >>= 1;
+                // If the memory available to Sylvan was not set explicitly, it must not claim more than half of the
+                // memory the process is limited to (if any).
+                uint_fast64_t maximalMemory = settings.getMaximalMemory();
+                if (!settings.isMaximalMemorySet()) {
+                    std::size_t memoryLimit = storm::utility::resources::getMemoryLimit();
+                    if (memoryLimit != 0 && memoryLimit != static_cast<std::size_t>(RLIM_INFINITY)) {
+                        maximalMemory = std::min(maximalMemory, static_cast<uint_fast64_t>(memoryLimit / 2 / 1024 / 1024));
+                    }
                 }
+                uint_fast64_t maximalMemoryInBytes = maximalMemory * 1024 * 1024;
                 
-                uint64_t initialTableSize = 1ull << std::max(powerOfTwo - 4, static_cast<uint_fast64_t>(16));
-                uint64_t initialCacheSize = initialTableSize;
+                TableSizes sizes = computeTableSizes(maximalMemoryInBytes, settings.getTableCacheRatio());
                 
-                STORM_LOG_DEBUG("Initializing sylvan. Initial/max table size: " << initialTableSize << "/" << maxTableSize << ", initial/max cache size: " << initialCacheSize << "/" << maxCacheSize << ".");
-                sylvan::Sylvan::initPackage(initialTableSize, maxTableSize, initialCacheSize, maxCacheSize);
+                STORM_LOG_DEBUG("Initializing sylvan with " << maximalMemory << "MB. Initial/max table size: " << sizes.initialTableSize << "/" << sizes.maxTableSize << ", initial/max cache size: " << sizes.initialCacheSize << "/" << sizes.maxCacheSize << ".");
+                sylvan::Sylvan::initPackage(sizes.initialTableSize, sizes.maxTableSize, sizes.initialCacheSize, sizes.maxCacheSize);
 
                 sylvan::Sylvan::initBdd();
                 sylvan::Sylvan::initMtbdd();
                 sylvan::Sylvan::initCustomMtbdd();
                 
-#ifndef NDEBUG
+                detail::resizeThreshold = settings.getResizeThreshold();
+                detail::statistics.initialized = true;
                 sylvan_gc_hook_pregc(TASK(gc_start));
                 sylvan_gc_hook_postgc(TASK(gc_end));
-#endif
-
+                sylvan_gc_hook_main(TASK(gc_resize));
+                for (auto const& mark : garbageCollectionMarks) {
+                    sylvan_gc_add_mark(mark);
+                }
             }
             ++numberOfInstances;
         }
@@ -105,11 +159,74 @@ namespace storm {
 //                sylvan_stats_report(filePointer, 0);
 //                fclose(filePointer);
                 
+                // Retrieve the final statistics while Sylvan is still running.
+                LACE_ME;
+                size_t numberOfNodes = 0;
+                size_t tableSize = 0;
+                sylvan_table_usage(&numberOfNodes, &tableSize);
+                detail::updateStatistics(numberOfNodes, tableSize);
+                detail::updateCacheStatistics();
+                
                 sylvan::Sylvan::quitPackage();
                 lace_exit();
             }
         }
         
+        InternalDdManager<DdType::Sylvan>::TableSizes InternalDdManager<DdType::Sylvan>::computeTableSizes(uint_fast64_t maximalMemory, int_fast64_t tableCacheRatio) {
+            // Each node takes 24 bytes and each entry of the operation cache 36 bytes (both including the overhead of
+            // the tables).
+            auto getCacheSize = [tableCacheRatio] (uint64_t tableSize) { return tableCacheRatio >= 0 ? std::max(tableSize >> tableCacheRatio, static_cast<uint64_t>(1)) : tableSize << -tableCacheRatio; };
+            
+            // Find the largest power of two (Sylvan supports at most 2^42 nodes) such that both tables fit into the
+            // available memory.
+            uint_fast64_t powerOfTwo = 42;
+            while (powerOfTwo >= 16 && (1ull << powerOfTwo) * 24 + getCacheSize(1ull << powerOfTwo) * 36 > maximalMemory) {
+                --powerOfTwo;
+            }
+            
+            STORM_LOG_THROW(powerOfTwo >= 16, storm::exceptions::InvalidSettingsException, "Too little memory assigned to sylvan.");
+            
+            TableSizes result;
+            result.maxTableSize = 1ull << powerOfTwo;
+            result.maxCacheSize = getCacheSize(result.maxTableSize);
+            result.initialTableSize = 1ull << std::max(powerOfTwo - 4, static_cast<uint_fast64_t>(16));
+            result.initialCacheSize = getCacheSize(result.initialTableSize);
+            return result;
+        }
+        
+        void InternalDdManager<DdType::Sylvan>::addGarbageCollectionMark(gc_hook_cb mark) {
+            if (std::find(garbageCollectionMarks.begin(), garbageCollectionMarks.end(), mark) != garbageCollectionMarks.end()) {
+                return;
+            }
+            garbageCollectionMarks.push_back(mark);
+            
+            // If Sylvan is already running, the task needs to be registered right away.
+            if (numberOfInstances > 0) {
+                sylvan_gc_add_mark(mark);
+            }
+        }
+        
+        void InternalDdManager<DdType::Sylvan>::printStatistics(std::ostream& out) {
+            if (!detail::statistics.initialized) {
+                return;
+            }
+            
+            if (numberOfInstances > 0) {
+                LACE_ME;
+                size_t numberOfNodes = 0;
+                size_t tableSize = 0;
+                sylvan_table_usage(&numberOfNodes, &tableSize);
+                detail::updateStatistics(numberOfNodes, tableSize);
+                detail::updateCacheStatistics();
+            }
+            
+            out << "  * Sylvan garbage collections: " << detail::statistics.numberOfGarbageCollections << " (total " << std::chrono::duration_cast<std::chrono::milliseconds>(detail::statistics.totalGarbageCollectionTime).count() << "ms, longest " << std::chrono::duration_cast<std::chrono::milliseconds>(detail::statistics.maximalGarbageCollectionTime).count() << "ms)" << std::endl;
+            out << "  * Sylvan nodes: " << detail::statistics.peakNumberOfNodes << " live at peak, table size " << detail::statistics.maximalTableSize << std::endl;
+            if (detail::statistics.cacheLookups > 0) {
+                out << "  * Sylvan cache hit rate: " << (100.0 * detail::statistics.cacheHits / detail::statistics.cacheLookups) << "%" << std::endl;
+            }
+        }
+        
         InternalBdd<DdType::Sylvan> InternalDdManager<DdType::Sylvan>::getBddOne() const {
             return InternalBdd<DdType::Sylvan>(this, sylvan::Bdd::bddOne());
         }
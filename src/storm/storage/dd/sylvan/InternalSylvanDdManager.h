@@ -1,6 +1,9 @@
 #ifndef STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANDDMANAGER_H_
 #define STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANDDMANAGER_H_
 
+#include <ostream>
+#include <vector>
+
 #include <boost/optional.hpp>
 
 #include "storm/storage/dd/DdType.h"
@@ -139,6 +142,42 @@ namespace storm {
              */
             uint_fast64_t getNumberOfDdVariables() const;
             
+            /*!
+             * Prints statistics about the garbage collections, the node table and the operation cache of Sylvan (if
+             * it was used at all) to the given stream.
+             *
+             * @param out The stream to print to.
+             */
+            static void printStatistics(std::ostream& out);
+            
+            // The initial and maximal sizes (in entries) of the node table and the operation cache of Sylvan.
+            struct TableSizes {
+                uint64_t initialTableSize;
+                uint64_t maxTableSize;
+                uint64_t initialCacheSize;
+                uint64_t maxCacheSize;
+            };
+            
+            /*!
+             * Computes the sizes of the node table and the operation cache of Sylvan such that both tables fit into
+             * the given amount of memory at their maximal size.
+             *
+             * @param maximalMemory The memory (in bytes) available to the tables.
+             * @param tableCacheRatio The node table has 2^tableCacheRatio times as many entries as the cache.
+             * @return The sizes of the tables.
+             */
+            static TableSizes computeTableSizes(uint_fast64_t maximalMemory, int_fast64_t tableCacheRatio);
+            
+            /*!
+             * Registers the given task with the garbage collection of Sylvan, such that it can mark nodes that are to
+             * survive the garbage collection (see sylvan_gc_add_mark). As Sylvan drops all registered tasks when it
+             * quits, the task is registered again whenever Sylvan is initialized. Registering a task several times has
+             * no effect.
+             *
+             * @param mark The marking task.
+             */
+            static void addGarbageCollectionMark(gc_hook_cb mark);
+            
         private:
             // Helper function to create the BDD whose encodings are below a given bound.
             BDD getBddEncodingLessOrEqualThanRec(uint64_t minimalValue, uint64_t maximalValue, uint64_t bound, BDD cube, uint64_t remainingDdVariables) const;
@@ -151,6 +190,9 @@ namespace storm {
             // The index of the next free variable index. This needs to be shared across all instances since the sylvan
             // manager is implicitly 'global'.
             static uint_fast64_t nextFreeVariableIndex;
+            
+            // The tasks that mark nodes during the garbage collection of Sylvan.
+            static std::vector<gc_hook_cb> garbageCollectionMarks;
         };
         
         template<>
@@ -14,30 +14,41 @@ namespace storm {
             
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> computeReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables) {
-
-                STORM_LOG_TRACE("Computing reachable states: transition matrix BDD has " << transitions.getNodeCount() << " node(s) and " << transitions.getNonZeroCount() << " non-zero(s), " << initialStates.getNonZeroCount() << " initial states).");
+                return computeReachableStates(initialStates, std::vector<storm::dd::Bdd<Type>>({transitions}), rowMetaVariables, columnMetaVariables, ReachabilityOrder::BreadthFirst);
+            }
+            
+            template <storm::dd::DdType Type>
+            storm::dd::Bdd<Type> computeReachableStates(storm::dd::Bdd<Type> const& initialStates, std::vector<storm::dd::Bdd<Type>> const& transitionRelationParts, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, ReachabilityOrder const& order) {
+                STORM_LOG_TRACE("Computing reachable states: transition relation is split into " << transitionRelationParts.size() << " part(s), " << initialStates.getNonZeroCount() << " initial states).");
 
                 auto start = std::chrono::high_resolution_clock::now();
                 storm::dd::Bdd<Type> reachableStates = initialStates;
                 
-                // Perform the BFS to discover all reachable states.
-                bool changed = true;
+                // Perform the search to discover all reachable states. In each iteration, only the states that were
+                // newly discovered in the previous iteration (the frontier) need to be explored.
+                storm::dd::Bdd<Type> frontier = initialStates;
                 uint_fast64_t iteration = 0;
-                do {
-                    changed = false;
-                    storm::dd::Bdd<Type> tmp = reachableStates.relationalProduct(transitions, rowMetaVariables, columnMetaVariables);
-                    storm::dd::Bdd<Type> newReachableStates = tmp && (!reachableStates);
+                while (!frontier.isZero()) {
+                    storm::dd::Bdd<Type> newFrontier = initialStates.getDdManager().getBddZero();
                     
-                    // Check whether new states were indeed discovered.
-                    if (!newReachableStates.isZero()) {
-                        changed = true;
+                    for (auto const& part : transitionRelationParts) {
+                        storm::dd::Bdd<Type> newReachableStates = frontier.relationalProduct(part, rowMetaVariables, columnMetaVariables) && !reachableStates;
+                        if (newReachableStates.isZero()) {
+                            continue;
+                        }
+                        
+                        reachableStates |= newReachableStates;
+                        newFrontier |= newReachableStates;
+                        if (order == ReachabilityOrder::Chaining) {
+                            frontier |= newReachableStates;
+                        }
                     }
                     
-                    reachableStates |= newReachableStates;
+                    frontier = newFrontier;
 
                     ++iteration;
                     STORM_LOG_TRACE("Iteration " << iteration << " of reachability computation completed: " << reachableStates.getNonZeroCount() << " reachable states found.");
-                } while (changed);
+                }
 
                 auto end = std::chrono::high_resolution_clock::now();
                 STORM_LOG_TRACE("Reachability computation completed in " << iteration << " iterations (" << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms).");
@@ -45,6 +56,103 @@ namespace storm {
                 return reachableStates;
             }
             
+            template <storm::dd::DdType Type>
+            std::vector<storm::dd::Bdd<Type>> computeTopologicalSccBlocks(storm::dd::Bdd<Type> const& states, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, uint64_t minimalBlockSize) {
+                auto start = std::chrono::high_resolution_clock::now();
+                storm::dd::DdManager<Type> const& manager = states.getDdManager();
+                
+                std::vector<storm::dd::Bdd<Type>> blocks;
+                storm::dd::Bdd<Type> currentBlock = manager.getBddZero();
+                uint64_t currentBlockSize = 0;
+                uint64_t numberOfComponents = 0;
+                auto addComponents = [&] (storm::dd::Bdd<Type> const& components) {
+                    currentBlock |= components;
+                    currentBlockSize += components.getNonZeroCount();
+                    ++numberOfComponents;
+                    if (currentBlockSize >= minimalBlockSize) {
+                        blocks.push_back(currentBlock);
+                        currentBlock = manager.getBddZero();
+                        currentBlockSize = 0;
+                    }
+                };
+                
+                // Every set on the stack only depends on itself and on the states that were already assigned to a
+                // block. Sets that are flagged are unions of components that can be assigned to a block right away.
+                std::vector<std::pair<storm::dd::Bdd<Type>, bool>> stack;
+                stack.emplace_back(states, false);
+                while (!stack.empty()) {
+                    storm::dd::Bdd<Type> remainingStates = stack.back().first;
+                    bool isFinal = stack.back().second;
+                    stack.pop_back();
+                    
+                    if (remainingStates.isZero()) {
+                        continue;
+                    }
+                    if (isFinal) {
+                        addComponents(remainingStates);
+                        continue;
+                    }
+                    
+                    // States without successors among the remaining states are trivial components that only depend on
+                    // states that were already handled, so they can be handled first.
+                    storm::dd::Bdd<Type> sinks = remainingStates && !remainingStates.inverseRelationalProduct(transitions, rowMetaVariables, columnMetaVariables);
+                    if (!sinks.isZero()) {
+                        addComponents(sinks);
+                        stack.emplace_back(remainingStates && !sinks, false);
+                        continue;
+                    }
+                    
+                    // Conversely, states without predecessors among the remaining states need to be handled last.
+                    storm::dd::Bdd<Type> sources = remainingStates && !remainingStates.relationalProduct(transitions, rowMetaVariables, columnMetaVariables);
+                    if (!sources.isZero()) {
+                        stack.emplace_back(sources, true);
+                        stack.emplace_back(remainingStates && !sources, false);
+                        continue;
+                    }
+                    
+                    // Otherwise, determine the component of some pivot state as the states that are both reachable from
+                    // and can reach the pivot.
+                    storm::dd::Bdd<Type> pivot = remainingStates.existsAbstractRepresentative(rowMetaVariables);
+                    storm::dd::Bdd<Type> forward = pivot;
+                    storm::dd::Bdd<Type> frontier = pivot;
+                    while (!frontier.isZero()) {
+                        frontier = frontier.relationalProduct(transitions, rowMetaVariables, columnMetaVariables) && remainingStates && !forward;
+                        forward |= frontier;
+                    }
+                    storm::dd::Bdd<Type> component = pivot;
+                    frontier = pivot;
+                    while (!frontier.isZero()) {
+                        frontier = frontier.inverseRelationalProduct(transitions, rowMetaVariables, columnMetaVariables) && forward && !component;
+                        component |= frontier;
+                    }
+                    
+                    // The states that are not reachable from the pivot may depend on the forward set, which in turn may
+                    // only depend on itself. Within the forward set, the component depends on the remaining states.
+                    stack.emplace_back(remainingStates && !forward, false);
+                    stack.emplace_back(component, true);
+                    stack.emplace_back(forward && !component, false);
+                }
+                if (!currentBlock.isZero()) {
+                    blocks.push_back(currentBlock);
+                }
+                
+                auto end = std::chrono::high_resolution_clock::now();
+                STORM_LOG_TRACE("Decomposed " << states.getNonZeroCount() << " states into " << blocks.size() << " block(s) of " << numberOfComponents << " (groups of) components in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
+                
+                return blocks;
+            }
+            
+            template <storm::dd::DdType Type, typename ValueType>
+            uint64_t estimateExplicitMatrixSize(storm::dd::Add<Type, ValueType> const& matrix, std::set<storm::expressions::Variable> const& columnMetaVariables) {
+                storm::dd::Bdd<Type> rows = matrix.notZero().existsAbstract(columnMetaVariables);
+                uint64_t numberOfRows = rows.getNonZeroCount();
+                uint64_t numberOfEntries = matrix.getNonZeroCount();
+                
+                // The ODD has at most one node per node of the rows and each node stores two successors and two offsets.
+                uint64_t oddSize = rows.getNodeCount() * 4 * sizeof(uint64_t);
+                return numberOfEntries * (sizeof(uint64_t) + sizeof(ValueType)) + numberOfRows * (sizeof(uint64_t) + 2 * sizeof(ValueType)) + oddSize;
+            }
+            
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs) {
                 return ddManager.getIdentity(rowColumnMetaVariablePairs);
@@ -52,7 +160,17 @@ namespace storm {
             
             template storm::dd::Bdd<storm::dd::DdType::CUDD> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
+            template storm::dd::Bdd<storm::dd::DdType::CUDD> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> const& transitionRelationParts, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, ReachabilityOrder const& order);
+            template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> const& transitionRelationParts, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, ReachabilityOrder const& order);
+
+            template std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> computeTopologicalSccBlocks(storm::dd::Bdd<storm::dd::DdType::CUDD> const& states, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, uint64_t minimalBlockSize);
+            template std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> computeTopologicalSccBlocks(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& states, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, uint64_t minimalBlockSize);
 
+            template uint64_t estimateExplicitMatrixSize(storm::dd::Add<storm::dd::DdType::CUDD, double> const& matrix, std::set<storm::expressions::Variable> const& columnMetaVariables);
+            template uint64_t estimateExplicitMatrixSize(storm::dd::Add<storm::dd::DdType::Sylvan, double> const& matrix, std::set<storm::expressions::Variable> const& columnMetaVariables);
+            template uint64_t estimateExplicitMatrixSize(storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalNumber> const& matrix, std::set<storm::expressions::Variable> const& columnMetaVariables);
+            template uint64_t estimateExplicitMatrixSize(storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalFunction> const& matrix, std::set<storm::expressions::Variable> const& columnMetaVariables);
+            
             template storm::dd::Bdd<storm::dd::DdType::CUDD> getRowColumnDiagonal(storm::dd::DdManager<storm::dd::DdType::CUDD> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> getRowColumnDiagonal(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
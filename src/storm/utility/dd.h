@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <set>
 #include <vector>
 
@@ -23,9 +24,45 @@ namespace storm {
     namespace utility {
         namespace dd {
             
+            /*!
+             * The order in which the parts of a partitioned transition relation are applied during reachability
+             * analysis. In breadth-first order, all parts are applied to the states discovered in the previous
+             * iteration. With chaining, the states discovered by one part are immediately passed on to the subsequent
+             * parts within the same iteration, which typically reduces the number of iterations.
+             */
+            enum class ReachabilityOrder { BreadthFirst, Chaining };
+            
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> computeReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             
+            /*!
+             * Computes the states reachable from the initial states via the given transition relation, which is given
+             * as a list of parts whose disjunction forms the relation (e.g. one part per action). The monolithic
+             * relation is never built.
+             */
+            template <storm::dd::DdType Type>
+            storm::dd::Bdd<Type> computeReachableStates(storm::dd::Bdd<Type> const& initialStates, std::vector<storm::dd::Bdd<Type>> const& transitionRelationParts, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, ReachabilityOrder const& order = ReachabilityOrder::Chaining);
+            
+            /*!
+             * Decomposes the given states into the strongly connected components of the given transition relation (which
+             * must only contain row and column variables) and returns them in a topological order in which every
+             * component comes after all components it can reach. Consecutive components are merged into blocks until
+             * the block contains at least the given number of states, so solving the blocks in the returned order
+             * only ever requires the results of preceding blocks.
+             */
+            template <storm::dd::DdType Type>
+            std::vector<storm::dd::Bdd<Type>> computeTopologicalSccBlocks(storm::dd::Bdd<Type> const& states, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, uint64_t minimalBlockSize = 1);
+            
+            /*!
+             * Estimates the number of bytes that are needed to represent the given matrix explicitly. This covers the
+             * entries and row indices of the sparse matrix, two vectors with one value per row (as needed to solve the
+             * corresponding equation system) as well as the ODD that is used to translate between the representations.
+             * Rows are identified by all non-column variables of the matrix, so for nondeterministic models the estimate
+             * is in terms of choices.
+             */
+            template <storm::dd::DdType Type, typename ValueType>
+            uint64_t estimateExplicitMatrixSize(storm::dd::Add<Type, ValueType> const& matrix, std::set<storm::expressions::Variable> const& columnMetaVariables);
+            
             template <storm::dd::DdType Type, typename ValueType>
             storm::dd::Add<Type, ValueType> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
@@ -0,0 +1,147 @@
+#include "storm/utility/engine.h"
+
+#include <type_traits>
+
+#include "storm/logic/Formula.h"
+#include "storm/logic/FragmentSpecification.h"
+
+#include "storm/models/symbolic/Model.h"
+#include "storm/models/symbolic/NondeterministicModel.h"
+#include "storm/storage/dd/Add.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/dd.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace utility {
+        namespace engine {
+            namespace detail {
+                // The number of bytes the sparse engine needs per state in addition to the matrix, e.g. for the state
+                // storage of the builder, the labeling and the solution vectors.
+                static const uint64_t SPARSE_BYTES_PER_STATE = 64;
+
+                // The number of bytes the hybrid engine needs per state for the explicit solution vectors.
+                static const uint64_t HYBRID_BYTES_PER_STATE = 32;
+
+                // The (conservatively estimated) number of states the sparse model builder explores per second.
+                static const uint64_t SPARSE_STATES_PER_SECOND = 250000;
+
+                // The maximal number of states of MDPs for which policy iteration is selected.
+                static const uint64_t POLICY_ITERATION_MAXIMAL_STATES = 10000;
+
+                bool canHandleAll(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::logic::FragmentSpecification const& fragment) {
+                    for (auto const& formula : formulas) {
+                        if (!formula->isInFragment(fragment)) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                // The following mirrors the model types and fragments the hybrid and dd model checkers can handle.
+                bool canHybridEngineHandle(ModelStatistics const& statistics, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+                    switch (statistics.modelType) {
+                        case storm::models::ModelType::Dtmc:
+                            return canHandleAll(formulas, storm::logic::prctl().setLongRunAverageRewardFormulasAllowed(true).setLongRunAverageProbabilitiesAllowed(true));
+                        case storm::models::ModelType::Ctmc:
+                            if (statistics.exact) {
+                                return canHandleAll(formulas, storm::logic::prctl().setGloballyFormulasAllowed(false).setLongRunAverageRewardFormulasAllowed(true).setLongRunAverageProbabilitiesAllowed(true));
+                            }
+                            return canHandleAll(formulas, storm::logic::csrl().setGloballyFormulasAllowed(false).setLongRunAverageRewardFormulasAllowed(true).setLongRunAverageProbabilitiesAllowed(true));
+                        case storm::models::ModelType::Mdp:
+                            return !statistics.exact && canHandleAll(formulas, storm::logic::prctl().setLongRunAverageRewardFormulasAllowed(false));
+                        default:
+                            return false;
+                    }
+                }
+
+                bool canDdEngineHandle(ModelStatistics const& statistics, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+                    switch (statistics.modelType) {
+                        case storm::models::ModelType::Dtmc:
+                            return canHandleAll(formulas, storm::logic::prctl().setLongRunAverageRewardFormulasAllowed(false));
+                        case storm::models::ModelType::Mdp:
+                            return !statistics.exact && canHandleAll(formulas, storm::logic::prctl().setLongRunAverageRewardFormulasAllowed(false));
+                        default:
+                            return false;
+                    }
+                }
+            }
+
+            template<storm::dd::DdType Type, typename ValueType>
+            ModelStatistics getModelStatistics(storm::models::symbolic::Model<Type, ValueType> const& model) {
+                ModelStatistics statistics;
+                statistics.modelType = model.getType();
+                statistics.exact = !std::is_same<ValueType, double>::value;
+                statistics.numberOfStates = model.getNumberOfStates();
+                statistics.numberOfTransitions = model.getNumberOfTransitions();
+                if (model.getType() == storm::models::ModelType::Mdp || model.getType() == storm::models::ModelType::MarkovAutomaton) {
+                    statistics.numberOfChoices = static_cast<storm::models::symbolic::NondeterministicModel<Type, ValueType> const&>(model).getNumberOfChoices();
+                } else {
+                    statistics.numberOfChoices = statistics.numberOfStates;
+                }
+                statistics.numberOfTransitionMatrixNodes = model.getTransitionMatrix().getNodeCount();
+                statistics.estimatedExplicitMatrixSize = storm::utility::dd::estimateExplicitMatrixSize(model.getTransitionMatrix(), model.getColumnVariables());
+                return statistics;
+            }
+
+            uint64_t estimateSparseEngineMemory(ModelStatistics const& statistics) {
+                return statistics.estimatedExplicitMatrixSize + statistics.numberOfStates * detail::SPARSE_BYTES_PER_STATE;
+            }
+
+            uint64_t estimateHybridEngineMemory(ModelStatistics const& statistics) {
+                return statistics.estimatedExplicitMatrixSize + statistics.numberOfStates * detail::HYBRID_BYTES_PER_STATE;
+            }
+
+            EngineSelection selectEngine(ModelStatistics const& statistics, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, uint64_t memoryBudget, uint64_t timeBudget) {
+                STORM_LOG_INFO("Selecting engine for " << statistics.modelType << " with " << statistics.numberOfStates << " states, " << statistics.numberOfChoices << " choices, " << statistics.numberOfTransitions << " transitions and " << statistics.numberOfTransitionMatrixNodes << " nodes in the transition matrix.");
+
+                EngineSelection selection;
+                selection.engine = storm::settings::modules::CoreSettings::Engine::Sparse;
+
+                bool hybridPossible = detail::canHybridEngineHandle(statistics, formulas);
+                bool ddPossible = detail::canDdEngineHandle(statistics, formulas);
+                uint64_t sparseMemory = estimateSparseEngineMemory(statistics);
+                uint64_t hybridMemory = estimateHybridEngineMemory(statistics);
+                bool sparseFitsMemory = memoryBudget == 0 || sparseMemory <= memoryBudget;
+                bool sparseFitsTime = timeBudget == 0 || statistics.numberOfStates <= timeBudget * detail::SPARSE_STATES_PER_SECOND;
+
+                if (!hybridPossible && !ddPossible) {
+                    STORM_LOG_INFO("Selecting sparse engine, because the symbolic engines cannot handle the model type or the properties.");
+                    STORM_LOG_WARN_COND(sparseFitsMemory, "The sparse engine is estimated to need " << sparseMemory / (1024 * 1024) << "MB, which exceeds the memory budget of " << memoryBudget / (1024 * 1024) << "MB.");
+                } else if (sparseFitsMemory && sparseFitsTime) {
+                    STORM_LOG_INFO("Selecting sparse engine, because it is estimated to need " << sparseMemory / (1024 * 1024) << "MB, which is within the budget.");
+                } else if (hybridPossible && (memoryBudget == 0 || hybridMemory <= memoryBudget)) {
+                    selection.engine = storm::settings::modules::CoreSettings::Engine::Hybrid;
+                    if (sparseFitsMemory) {
+                        STORM_LOG_INFO("Selecting hybrid engine, because building " << statistics.numberOfStates << " states explicitly is unlikely to finish within " << timeBudget << "s.");
+                    } else {
+                        STORM_LOG_INFO("Selecting hybrid engine, because the sparse engine is estimated to need " << sparseMemory / (1024 * 1024) << "MB, but the explicit transition matrix only needs " << hybridMemory / (1024 * 1024) << "MB.");
+                    }
+                } else if (ddPossible) {
+                    selection.engine = storm::settings::modules::CoreSettings::Engine::Dd;
+                    STORM_LOG_INFO("Selecting dd engine, because the explicit transition matrix is estimated to need " << hybridMemory / (1024 * 1024) << "MB" << (hybridPossible ? ", which exceeds the memory budget." : " and the hybrid engine cannot handle the properties."));
+                } else {
+                    // Among the engines that can handle the properties, the hybrid engine is the most frugal one.
+                    selection.engine = storm::settings::modules::CoreSettings::Engine::Hybrid;
+                    STORM_LOG_WARN("Selecting hybrid engine, although it is estimated to need " << hybridMemory / (1024 * 1024) << "MB, which exceeds the memory budget of " << memoryBudget / (1024 * 1024) << "MB.");
+                }
+
+                // Small MDPs are solved precisely by policy iteration at virtually no cost.
+                if (statistics.modelType == storm::models::ModelType::Mdp && !statistics.exact && selection.engine == storm::settings::modules::CoreSettings::Engine::Sparse && statistics.numberOfStates <= detail::POLICY_ITERATION_MAXIMAL_STATES) {
+                    selection.minMaxMethod = storm::solver::MinMaxMethod::PolicyIteration;
+                    STORM_LOG_INFO("Selecting policy iteration, because the MDP has at most " << detail::POLICY_ITERATION_MAXIMAL_STATES << " states.");
+                }
+
+                return selection;
+            }
+
+            template ModelStatistics getModelStatistics(storm::models::symbolic::Model<storm::dd::DdType::CUDD, double> const& model);
+            template ModelStatistics getModelStatistics(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double> const& model);
+            template ModelStatistics getModelStatistics(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalNumber> const& model);
+            template ModelStatistics getModelStatistics(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalFunction> const& model);
+
+        }
+    }
+}
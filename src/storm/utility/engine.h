@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/models/ModelType.h"
+#include "storm/storage/dd/DdType.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/solver/SolverSelectionOptions.h"
+
+namespace storm {
+    namespace logic {
+        class Formula;
+    }
+
+    namespace models {
+        namespace symbolic {
+            template<storm::dd::DdType Type, typename ValueType>
+            class Model;
+        }
+    }
+
+    namespace utility {
+        namespace engine {
+
+            /*!
+             * Cheap statistics of a model that are obtained from its symbolic representation and that allow to estimate
+             * the resources the individual engines need.
+             */
+            struct ModelStatistics {
+                // The type of the model.
+                storm::models::ModelType modelType;
+
+                // Whether the model uses exact (or parametric) arithmetic.
+                bool exact;
+
+                // The number of (reachable) states, choices and transitions.
+                uint64_t numberOfStates;
+                uint64_t numberOfChoices;
+                uint64_t numberOfTransitions;
+
+                // The number of nodes of the symbolic transition matrix.
+                uint64_t numberOfTransitionMatrixNodes;
+
+                // The estimated size (in bytes) of the explicit transition matrix.
+                uint64_t estimatedExplicitMatrixSize;
+            };
+
+            /*!
+             * The outcome of the engine selection.
+             */
+            struct EngineSelection {
+                // The engine to use.
+                storm::settings::modules::CoreSettings::Engine engine;
+
+                // If set, the method that is to be used for solving min/max equation systems.
+                boost::optional<storm::solver::MinMaxMethod> minMaxMethod;
+            };
+
+            /*!
+             * Retrieves the statistics of the given symbolic model.
+             */
+            template<storm::dd::DdType Type, typename ValueType>
+            ModelStatistics getModelStatistics(storm::models::symbolic::Model<Type, ValueType> const& model);
+
+            /*!
+             * Selects the engine (and the solution methods) for checking the given formulas on the model with the given
+             * statistics. The sparse engine is preferred as long as the explicit model fits within the memory budget and
+             * is likely to be built within the time budget. Otherwise, the hybrid engine is chosen if the explicit
+             * transition matrix fits and the dd engine if not. Engines that cannot handle the model type or one of the
+             * formulas are never selected. The reasons for the selection are logged.
+             *
+             * @param statistics The statistics of the model.
+             * @param formulas The formulas that are to be checked.
+             * @param memoryBudget The memory (in bytes) that may be used or zero if the memory is not limited.
+             * @param timeBudget The time (in seconds) that may be used or zero if the time is not limited.
+             */
+            EngineSelection selectEngine(ModelStatistics const& statistics, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, uint64_t memoryBudget, uint64_t timeBudget);
+
+            /*!
+             * Estimates the memory (in bytes) the sparse engine needs to build and check the model with the given
+             * statistics.
+             */
+            uint64_t estimateSparseEngineMemory(ModelStatistics const& statistics);
+
+            /*!
+             * Estimates the memory (in bytes) the hybrid engine needs to check the model with the given statistics in
+             * addition to the symbolic representation.
+             */
+            uint64_t estimateHybridEngineMemory(ModelStatistics const& statistics);
+
+        }
+    }
+}
@@ -20,14 +20,160 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/utility/constants.h"
+#include "storm/utility/instrumentation.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
 #include <queue>
 
 namespace storm {
     namespace utility {
         namespace graph {
+            namespace detail {
+                bool useWorklistAlgorithms() {
+                    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isProb01WorklistSet();
+                }
+                
+                /*!
+                 * The choices of a nondeterministic model that lead to each state, i.e. the backward transitions on the
+                 * level of choices rather than states. Together with the state of every choice, this allows to propagate
+                 * information from a state to all choices leading to it without rescanning the choices.
+                 */
+                struct ChoicePredecessors {
+                    template <typename T>
+                    ChoicePredecessors(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices) : indices(transitionMatrix.getColumnCount() + 1), choiceToState(transitionMatrix.getRowCount()) {
+                        uint_fast64_t numberOfStates = nondeterministicChoiceIndices.size() - 1;
+                        for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+                            for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                                choiceToState[row] = state;
+                                for (auto const& entry : transitionMatrix.getRow(row)) {
+                                    ++indices[entry.getColumn() + 1];
+                                }
+                            }
+                        }
+                        for (uint_fast64_t state = 1; state < indices.size(); ++state) {
+                            indices[state] += indices[state - 1];
+                        }
+                        
+                        choices.resize(indices.back());
+                        std::vector<uint_fast64_t> nextPosition(indices.begin(), indices.end() - 1);
+                        for (uint_fast64_t row = 0; row < transitionMatrix.getRowCount(); ++row) {
+                            for (auto const& entry : transitionMatrix.getRow(row)) {
+                                choices[nextPosition[entry.getColumn()]++] = row;
+                            }
+                        }
+                    }
+                    
+                    // For every state, the (start) index of its predecessor choices in the choices vector.
+                    std::vector<uint_fast64_t> indices;
+                    
+                    // The choices leading to the states.
+                    std::vector<uint_fast64_t> choices;
+                    
+                    // The state of every choice.
+                    std::vector<uint_fast64_t> choiceToState;
+                };
+                
+                /*!
+                 * Computes the states that reach a psi state with positive probability under all schedulers. A state is
+                 * added as soon as the last of its (permitted) choices obtained a successor in the result, which is
+                 * detected with a counter per state, so every transition is considered at most once.
+                 */
+                template <typename T>
+                storm::storage::BitVector performProbGreater0AWorklist(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+                    uint_fast64_t numberOfStates = phiStates.size();
+                    ChoicePredecessors predecessors(transitionMatrix, nondeterministicChoiceIndices);
+                    
+                    // For every state, count the permitted choices that do not yet have a successor in the result.
+                    std::vector<uint_fast64_t> remainingChoices(numberOfStates);
+                    for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+                        if (choiceConstraint) {
+                            remainingChoices[state] = choiceConstraint->getNumberOfSetBitsBeforeIndex(nondeterministicChoiceIndices[state + 1]) - choiceConstraint->getNumberOfSetBitsBeforeIndex(nondeterministicChoiceIndices[state]);
+                        } else {
+                            remainingChoices[state] = nondeterministicChoiceIndices[state + 1] - nondeterministicChoiceIndices[state];
+                        }
+                    }
+                    storm::storage::BitVector satisfiedChoices(transitionMatrix.getRowCount());
+                    
+                    storm::storage::BitVector statesWithProbabilityGreater0(psiStates);
+                    std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
+                    while (!stack.empty()) {
+                        uint_fast64_t currentState = stack.back();
+                        stack.pop_back();
+                        
+                        for (uint_fast64_t index = predecessors.indices[currentState]; index < predecessors.indices[currentState + 1]; ++index) {
+                            uint_fast64_t choice = predecessors.choices[index];
+                            if (satisfiedChoices.get(choice) || (choiceConstraint && !choiceConstraint->get(choice))) {
+                                continue;
+                            }
+                            satisfiedChoices.set(choice);
+                            
+                            uint_fast64_t predecessor = predecessors.choiceToState[choice];
+                            if (phiStates.get(predecessor) && !statesWithProbabilityGreater0.get(predecessor)) {
+                                --remainingChoices[predecessor];
+                                if (remainingChoices[predecessor] == 0) {
+                                    statesWithProbabilityGreater0.set(predecessor);
+                                    stack.push_back(predecessor);
+                                }
+                            }
+                        }
+                    }
+                    
+                    return statesWithProbabilityGreater0;
+                }
+                
+                /*!
+                 * Computes the states that reach a psi state with probability one under some scheduler. This is the
+                 * greatest fixpoint of the states from which psi is reachable while only using choices that stay within
+                 * the fixpoint. Since choices that leave the candidate states are disabled exactly once and every round
+                 * performs a single backward search, each round only considers every transition a bounded number of
+                 * times.
+                 */
+                template <typename T>
+                storm::storage::BitVector performProb1EWorklist(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                    uint_fast64_t numberOfStates = phiStates.size();
+                    ChoicePredecessors predecessors(transitionMatrix, nondeterministicChoiceIndices);
+                    
+                    storm::storage::BitVector currentStates(numberOfStates, true);
+                    storm::storage::BitVector disabledChoices(transitionMatrix.getRowCount());
+                    std::vector<uint_fast64_t> stack;
+                    stack.reserve(numberOfStates);
+                    
+                    while (true) {
+                        // Search backwards from the psi states using the choices that stay within the current states.
+                        storm::storage::BitVector nextStates(psiStates);
+                        stack.assign(psiStates.begin(), psiStates.end());
+                        while (!stack.empty()) {
+                            uint_fast64_t currentState = stack.back();
+                            stack.pop_back();
+                            
+                            for (uint_fast64_t index = predecessors.indices[currentState]; index < predecessors.indices[currentState + 1]; ++index) {
+                                uint_fast64_t choice = predecessors.choices[index];
+                                uint_fast64_t predecessor = predecessors.choiceToState[choice];
+                                if (!disabledChoices.get(choice) && phiStates.get(predecessor) && !nextStates.get(predecessor)) {
+                                    nextStates.set(predecessor);
+                                    stack.push_back(predecessor);
+                                }
+                            }
+                        }
+                        
+                        if (currentStates == nextStates) {
+                            return currentStates;
+                        }
+                        
+                        // Disable all choices that lead to a state that was removed.
+                        for (auto removedState : currentStates & ~nextStates) {
+                            for (uint_fast64_t index = predecessors.indices[removedState]; index < predecessors.indices[removedState + 1]; ++index) {
+                                disabledChoices.set(predecessors.choices[index]);
+                            }
+                        }
+                        currentStates = std::move(nextStates);
+                    }
+                }
+            }
             
             template<typename T>
             storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps) {
@@ -239,6 +385,7 @@ namespace storm {
             
             template <typename T>
             storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+                storm::utility::instrumentation::ScopedPhase phase("graph analysis");
                 // Prepare the resulting bit vector.
                 uint_fast64_t numberOfStates = phiStates.size();
                 storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
@@ -297,6 +444,7 @@ namespace storm {
             
             template <typename T>
             storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const&, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0) {
+                storm::utility::instrumentation::ScopedPhase phase("graph analysis");
                 storm::storage::BitVector statesWithProbability1 = performProbGreater0(backwardTransitions, ~psiStates, ~statesWithProbabilityGreater0);
                 statesWithProbability1.complement();
                 return statesWithProbability1;
@@ -534,6 +682,7 @@ namespace storm {
             
             template <typename T>
             storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+                storm::utility::instrumentation::ScopedPhase phase("graph analysis");
                 size_t numberOfStates = phiStates.size();
                 
                 // Prepare resulting bit vector.
@@ -597,6 +746,11 @@ namespace storm {
             
             template <typename T>
             storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                storm::utility::instrumentation::ScopedPhase phase("graph analysis");
+                if (detail::useWorklistAlgorithms()) {
+                    return detail::performProb1EWorklist(transitionMatrix, nondeterministicChoiceIndices, phiStates, psiStates);
+                }
+                
                 size_t numberOfStates = phiStates.size();
                 
                 // Initialize the environment for the iterative algorithm.
@@ -677,6 +831,11 @@ namespace storm {
             
             template <typename T>
             storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+                storm::utility::instrumentation::ScopedPhase phase("graph analysis");
+                if (!useStepBound && detail::useWorklistAlgorithms()) {
+                    return detail::performProbGreater0AWorklist(transitionMatrix, nondeterministicChoiceIndices, phiStates, psiStates, choiceConstraint);
+                }
+                
                 size_t numberOfStates = phiStates.size();
                 
                 // Prepare resulting bit vector.
@@ -808,6 +967,17 @@ namespace storm {
             
             template <typename T>
             storm::storage::BitVector performProb1A( storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                storm::utility::instrumentation::ScopedPhase phase("graph analysis");
+                if (detail::useWorklistAlgorithms()) {
+                    // A state reaches psi with a probability below one under some scheduler iff it can reach a state in
+                    // which some scheduler avoids psi altogether via (phi and not psi)-states. Both sets are computed by
+                    // a single backward search each.
+                    storm::storage::BitVector statesWithProbability0 = performProb0E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+                    storm::storage::BitVector statesWithProbability1 = performProbGreater0E(backwardTransitions, phiStates & ~psiStates, statesWithProbability0);
+                    statesWithProbability1.complement();
+                    return statesWithProbability1;
+                }
+                
                 size_t numberOfStates = phiStates.size();
                 
                 // Initialize the environment for the iterative algorithm.
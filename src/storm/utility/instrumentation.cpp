@@ -0,0 +1,199 @@
+#include "storm/utility/instrumentation.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <sys/resource.h>
+
+// JSON parser
+#include "json.hpp"
+namespace modernjson {
+    using json = nlohmann::json;
+}
+
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/file.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidOperationException.h"
+
+namespace storm {
+    namespace utility {
+        namespace instrumentation {
+            namespace detail {
+                struct Phase {
+                    Phase(std::string const& name, Phase* parent) : name(name), parent(parent), numberOfCalls(0), time(0), peakMemory(0), peakMemoryIncrease(0) {
+                        // Intentionally left empty.
+                    }
+
+                    Phase* getChild(std::string const& childName) {
+                        for (auto const& child : children) {
+                            if (child->name == childName) {
+                                return child.get();
+                            }
+                        }
+                        children.push_back(std::make_unique<Phase>(childName, this));
+                        return children.back().get();
+                    }
+
+                    modernjson::json toJson() const {
+                        modernjson::json result;
+                        result["name"] = name;
+                        result["calls"] = numberOfCalls;
+                        result["time"] = std::chrono::duration<double>(time).count();
+                        result["peak-memory"] = peakMemory;
+                        result["peak-memory-increase"] = peakMemoryIncrease;
+                        modernjson::json counterJson = modernjson::json::object();
+                        for (auto const& counter : counters) {
+                            counterJson[counter.first] = counter.second;
+                        }
+                        result["counters"] = counterJson;
+                        modernjson::json childrenJson = modernjson::json::array();
+                        for (auto const& child : children) {
+                            childrenJson.push_back(child->toJson());
+                        }
+                        result["phases"] = childrenJson;
+                        return result;
+                    }
+
+                    // The name of the phase.
+                    std::string name;
+
+                    // The phase in which this phase was entered.
+                    Phase* parent;
+
+                    // The measurements accumulated over all times the phase was entered.
+                    uint64_t numberOfCalls;
+                    std::chrono::nanoseconds time;
+                    uint64_t peakMemory;
+                    uint64_t peakMemoryIncrease;
+                    std::map<std::string, uint64_t> counters;
+
+                    // The phases entered within this phase in the order in which they were first entered.
+                    std::vector<std::unique_ptr<Phase>> children;
+                };
+
+                // The flag is read by every hook, so it is kept outside of the mutex.
+                static std::atomic<bool> enabled(false);
+
+                // The thread that enabled recording. Only this thread enters phases.
+                static std::thread::id recordingThread;
+
+                // Guards the phase tree and the active phase, which are also accessed when other threads add to counters.
+                static std::mutex mutex;
+                static std::unique_ptr<Phase> root;
+                static Phase* activePhase = nullptr;
+                static std::chrono::high_resolution_clock::time_point rootStart;
+
+                uint64_t getPeakMemory() {
+                    struct rusage ru;
+                    getrusage(RUSAGE_SELF, &ru);
+#ifdef MACOS
+                    // For Mac OS, this is returned in bytes.
+                    return ru.ru_maxrss;
+#else
+                    // For Linux, this is returned in kilobytes.
+                    return ru.ru_maxrss * 1024;
+#endif
+                }
+
+                void createRoot() {
+                    root = std::make_unique<Phase>("total", nullptr);
+                    root->numberOfCalls = 1;
+                    activePhase = root.get();
+                    rootStart = std::chrono::high_resolution_clock::now();
+                }
+            }
+
+            void enable() {
+                std::lock_guard<std::mutex> lock(detail::mutex);
+                if (!detail::root) {
+                    detail::createRoot();
+                }
+                detail::recordingThread = std::this_thread::get_id();
+                detail::enabled = true;
+            }
+
+            void disable() {
+                detail::enabled = false;
+            }
+
+            bool isEnabled() {
+                return detail::enabled;
+            }
+
+            void reset() {
+                std::lock_guard<std::mutex> lock(detail::mutex);
+                STORM_LOG_ASSERT(!detail::root || detail::activePhase == detail::root.get(), "Cannot reset instrumentation data while a phase is active.");
+                detail::createRoot();
+            }
+
+            ScopedPhase::ScopedPhase(char const* name) : phase(nullptr), startPeakMemory(0) {
+                if (!detail::enabled || std::this_thread::get_id() != detail::recordingThread) {
+                    return;
+                }
+                std::lock_guard<std::mutex> lock(detail::mutex);
+                if (detail::activePhase->name == name) {
+                    return;
+                }
+                phase = detail::activePhase->getChild(name);
+                detail::activePhase = phase;
+                startPeakMemory = detail::getPeakMemory();
+                start = std::chrono::high_resolution_clock::now();
+            }
+
+            ScopedPhase::~ScopedPhase() {
+                if (!phase) {
+                    return;
+                }
+                std::lock_guard<std::mutex> lock(detail::mutex);
+                phase->time += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+                ++phase->numberOfCalls;
+                uint64_t peakMemory = detail::getPeakMemory();
+                phase->peakMemory = std::max(phase->peakMemory, peakMemory);
+                phase->peakMemoryIncrease = std::max(phase->peakMemoryIncrease, peakMemory - startPeakMemory);
+                STORM_LOG_ASSERT(detail::activePhase == phase, "Phases were not left in the order in which they were entered.");
+                detail::activePhase = phase->parent;
+            }
+
+            void addToCounter(char const* name, uint64_t value) {
+                if (detail::enabled) {
+                    std::lock_guard<std::mutex> lock(detail::mutex);
+                    detail::activePhase->counters[name] += value;
+                }
+            }
+
+            void addSolverIterations(char const* name, uint64_t iterations, uint64_t matrixVectorProducts, uint64_t nonzeros) {
+                if (detail::enabled) {
+                    std::lock_guard<std::mutex> lock(detail::mutex);
+                    std::map<std::string, uint64_t>& counters = detail::activePhase->counters;
+                    counters[name] += iterations;
+                    counters["matrix-vector products"] += matrixVectorProducts;
+                    counters["nonzeros touched"] += matrixVectorProducts * nonzeros;
+                }
+            }
+
+            void exportToJson(std::ostream& out) {
+                std::lock_guard<std::mutex> lock(detail::mutex);
+                STORM_LOG_THROW(detail::root, storm::exceptions::InvalidOperationException, "Cannot export instrumentation data, because recording was never enabled.");
+                detail::root->time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - detail::rootStart);
+                detail::root->peakMemory = detail::getPeakMemory();
+                detail::root->peakMemoryIncrease = detail::root->peakMemory;
+                out << detail::root->toJson().dump(4) << std::endl;
+            }
+
+            void exportToJsonFile(std::string const& filename) {
+                std::ofstream stream;
+                storm::utility::openFile(filename, stream);
+                exportToJson(stream);
+                storm::utility::closeFile(stream);
+            }
+
+        }
+    }
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace storm {
+    namespace utility {
+        namespace instrumentation {
+            namespace detail {
+                struct Phase;
+            }
+
+            /*!
+             * Enables the recording of phases and counters. As long as recording is disabled (the default), a hook
+             * costs a function call that checks a flag. Names are passed as C strings, so no string is constructed
+             * unless something is recorded. The arguments of a hook are still evaluated, so hooks should be placed
+             * outside of inner loops. Phases are only recorded on the thread that enabled recording; phases entered on
+             * other threads (e.g. TBB workers) are ignored and their time is part of the enclosing phase of the
+             * recording thread. Counters may be added to from any thread and are attributed to the phase that is
+             * currently active on the recording thread.
+             */
+            void enable();
+
+            /*!
+             * Disables the recording of phases and counters. The data recorded so far is kept and phases that are
+             * active are still left properly.
+             */
+            void disable();
+
+            /*!
+             * Retrieves whether recording is enabled.
+             */
+            bool isEnabled();
+
+            /*!
+             * Discards all recorded phases and counters. This must not be called while a phase is active.
+             */
+            void reset();
+
+            /*!
+             * Records the time spent in a phase and the peak memory of the process when leaving it, from construction
+             * to destruction of the object. Phases are recorded hierarchically, i.e. a phase entered while another one
+             * is active becomes its child. Entering a phase with the same name several times accumulates the
+             * measurements and entering a phase with the same name as the active phase has no effect, so recursive or
+             * nested calls of an instrumented function are only recorded once.
+             */
+            class ScopedPhase {
+            public:
+                /*!
+                 * Enters the phase with the given name (if recording is enabled).
+                 *
+                 * @param name The name of the phase.
+                 */
+                ScopedPhase(char const* name);
+
+                ScopedPhase(ScopedPhase const& other) = delete;
+                ScopedPhase& operator=(ScopedPhase const& other) = delete;
+
+                /*!
+                 * Leaves the phase.
+                 */
+                ~ScopedPhase();
+
+            private:
+                // The phase that was entered or null if nothing is recorded.
+                detail::Phase* phase;
+
+                // The time point at which the phase was entered.
+                std::chrono::high_resolution_clock::time_point start;
+
+                // The peak memory of the process when the phase was entered.
+                uint64_t startPeakMemory;
+            };
+
+            /*!
+             * Adds the given value to the counter with the given name of the currently active phase (if recording is
+             * enabled).
+             *
+             * @param name The name of the counter, e.g. "iterations".
+             * @param value The value to add.
+             */
+            void addToCounter(char const* name, uint64_t value);
+
+            /*!
+             * Adds the work of an iterative solver to the counters of the currently active phase (if recording is
+             * enabled), namely the given number of iterations to the counter with the given name, the matrix-vector
+             * products to "matrix-vector products" and the nonzero entries read by these products to
+             * "nonzeros touched".
+             *
+             * @param name The name of the iteration counter, e.g. "value iterations".
+             * @param iterations The number of iterations.
+             * @param matrixVectorProducts The number of products with the matrix performed in these iterations.
+             * @param nonzeros The number of nonzero entries of the matrix.
+             */
+            void addSolverIterations(char const* name, uint64_t iterations, uint64_t matrixVectorProducts, uint64_t nonzeros);
+
+            /*!
+             * Writes the recorded phases and counters as JSON to the given stream. Every phase is given by its name,
+             * the number of times it was entered, the accumulated time (in seconds), the peak memory of the process
+             * at the end of the phase and the largest increase of the peak memory within the phase (in bytes), its
+             * counters and its child phases.
+             */
+            void exportToJson(std::ostream& out);
+
+            /*!
+             * Writes the recorded phases and counters as JSON to the file with the given name.
+             */
+            void exportToJsonFile(std::string const& filename);
+
+        }
+    }
+}
@@ -3,6 +3,8 @@
 
 #include <cstdlib>
 #include <csignal>
+#include <fstream>
+#include <unistd.h>
 #include <sys/time.h>
 #include <sys/times.h>
 #include <sys/resource.h>
@@ -49,6 +51,22 @@ namespace storm {
 #endif
             }
             
+            /*!
+             * Retrieves the size (in bytes) of the address space the process currently uses, which is what the memory
+             * limit restricts.
+             */
+            inline std::size_t getUsedMemory() {
+#if defined LINUX
+                std::size_t pages = 0;
+                std::ifstream statm("/proc/self/statm");
+                statm >> pages;
+                return pages * sysconf(_SC_PAGESIZE);
+#else
+                STORM_LOG_WARN("Retrieving the used memory is not supported for your operating system.");
+                return 0;
+#endif
+            }
+            
             inline void setMemoryLimit(std::size_t megabytes) {
 #if defined LINUX
                 rlimit rl;
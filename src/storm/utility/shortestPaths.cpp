@@ -1,5 +1,5 @@
+#include <algorithm>
 #include <ostream>
-#include <queue>
 #include <set>
 #include <string>
 
@@ -31,15 +31,8 @@ namespace storm {
 
                 computePredecessors();
 
-                // gives us SP-predecessors, SP-distances
+                // gives us SP-predecessors, SP-distances, which implicitly represent the (1-)shortest paths
                 performDijkstra();
-
-                computeSPSuccessors();
-
-                // constructs the recursive shortest path representations
-                initializeShortestPaths();
-
-                candidatePaths.resize(numStates);
             }
 
             template <typename T>
@@ -70,7 +63,7 @@ namespace storm {
             template <typename T>
             T ShortestPathsGenerator<T>::getDistance(unsigned long k) {
                 computeKSP(k);
-                return kShortestPaths[metaTarget][k - 1].distance;
+                return getKShortestPath(metaTarget, k).distance;
             }
 
             template <typename T>
@@ -78,7 +71,7 @@ namespace storm {
                 computeKSP(k);
                 BitVector stateSet(numStates - 1, false); // no meta-target
 
-                Path<T> currentPath = kShortestPaths[metaTarget][k - 1];
+                Path<T> currentPath = getKShortestPath(metaTarget, k);
                 boost::optional<state_t> maybePredecessor = currentPath.predecessorNode;
                 // this omits the first node, which is actually convenient since that's the meta-target
 
@@ -86,7 +79,7 @@ namespace storm {
                     state_t predecessor = maybePredecessor.get();
                     stateSet.set(predecessor, true);
 
-                    currentPath = kShortestPaths[predecessor][currentPath.predecessorK - 1]; // god damn you, index
+                    currentPath = getKShortestPath(predecessor, currentPath.predecessorK);
                     maybePredecessor = currentPath.predecessorNode;
                 }
 
@@ -99,7 +92,7 @@ namespace storm {
 
                 std::vector<state_t> backToFrontList;
 
-                Path<T> currentPath = kShortestPaths[metaTarget][k - 1];
+                Path<T> currentPath = getKShortestPath(metaTarget, k);
                 boost::optional<state_t> maybePredecessor = currentPath.predecessorNode;
                 // this omits the first node, which is actually convenient since that's the meta-target
 
@@ -107,26 +100,41 @@ namespace storm {
                     state_t predecessor = maybePredecessor.get();
                     backToFrontList.push_back(predecessor);
 
-                    currentPath = kShortestPaths[predecessor][currentPath.predecessorK - 1];
+                    currentPath = getKShortestPath(predecessor, currentPath.predecessorK);
                     maybePredecessor = currentPath.predecessorNode;
                 }
 
                 return backToFrontList;
             }
 
+            template <typename T>
+            unsigned long ShortestPathsGenerator<T>::computeKSPUntil(T const& probabilityThreshold, std::function<bool(unsigned long, T const&)> const& pathCallback) {
+                T accumulatedDistance = zero<T>();
+                unsigned long k = 0;
+                while (accumulatedDistance < probabilityThreshold && tryComputeKSP(k + 1)) {
+                    ++k;
+                    T distance = getKShortestPath(metaTarget, k).distance;
+                    accumulatedDistance += distance;
+                    if (pathCallback && !pathCallback(k, distance)) {
+                        break;
+                    }
+                }
+                return k;
+            }
+
             template <typename T>
             void ShortestPathsGenerator<T>::computePredecessors() {
                 assert(transitionMatrix.hasTrivialRowGrouping());
 
-                // one more for meta-target
-                graphPredecessors.resize(numStates);
-
+                // the predecessor lists are stored contiguously; first count the predecessors of each node
+                // (one more for meta-target)
+                graphPredecessorIndications.assign(numStates + 1, 0);
                 for (state_t i = 0; i < numStates - 1; i++) {
-                    for (auto const& transition : transitionMatrix.getRowGroup(i)) {
-                        // to avoid non-minimal paths, the meta-target-predecessors are
-                        // *not* predecessors of any state but the meta-target
-                        if (!isMetaTargetPredecessor(i)) {
-                            graphPredecessors[transition.getColumn()].push_back(i);
+                    // to avoid non-minimal paths, the meta-target-predecessors are
+                    // *not* predecessors of any state but the meta-target
+                    if (!isMetaTargetPredecessor(i)) {
+                        for (auto const& transition : transitionMatrix.getRowGroup(i)) {
+                            ++graphPredecessorIndications[transition.getColumn() + 1];
                         }
                     }
                 }
@@ -134,8 +142,24 @@ namespace storm {
                 // meta-target has exactly the meta-target-predecessors as predecessors
                 // (duh. note that the meta-target-predecessors used to be called target,
                 // but that's not necessarily true in the matrix/value invocation case)
-                for (auto targetProbPair : targetProbMap) {
-                    graphPredecessors[metaTarget].push_back(targetProbPair.first);
+                graphPredecessorIndications[metaTarget + 1] = targetProbMap.size();
+
+                for (state_t i = 0; i < numStates; i++) {
+                    graphPredecessorIndications[i + 1] += graphPredecessorIndications[i];
+                }
+
+                // now fill in the predecessors
+                graphPredecessorStates.resize(graphPredecessorIndications.back());
+                std::vector<uint_fast64_t> nextPosition(graphPredecessorIndications.begin(), graphPredecessorIndications.end() - 1);
+                for (state_t i = 0; i < numStates - 1; i++) {
+                    if (!isMetaTargetPredecessor(i)) {
+                        for (auto const& transition : transitionMatrix.getRowGroup(i)) {
+                            graphPredecessorStates[nextPosition[transition.getColumn()]++] = i;
+                        }
+                    }
+                }
+                for (auto const& targetProbPair : targetProbMap) {
+                    graphPredecessorStates[nextPosition[metaTarget]++] = targetProbPair.first;
                 }
             }
 
@@ -189,48 +213,28 @@ namespace storm {
             }
 
             template <typename T>
-            void ShortestPathsGenerator<T>::computeSPSuccessors() {
-                shortestPathSuccessors.resize(numStates);
-
-                for (state_t i = 0; i < numStates; i++) {
-                    if (shortestPathPredecessors[i]) {
-                        state_t predecessor = shortestPathPredecessors[i].get();
-                        shortestPathSuccessors[predecessor].push_back(i);
-                    }
+            unsigned long ShortestPathsGenerator<T>::getNumberOfComputedPaths(state_t node) const {
+                if (!shortestPathPredecessors[node] && !isInitialState(node)) {
+                    // node is unreachable, so not even a shortest path exists
+                    return 0;
                 }
+                auto pathsIt = kShortestPaths.find(node);
+                return 1 + (pathsIt == kShortestPaths.end() ? 0 : pathsIt->second.size());
             }
 
             template <typename T>
-            void ShortestPathsGenerator<T>::initializeShortestPaths() {
-                kShortestPaths.resize(numStates);
-
-                // BFS in Dijkstra-SP order
-                std::queue<state_t> bfsQueue;
-                for (state_t initialState : initialStates) {
-                    bfsQueue.push(initialState);
-                }
-
-                while (!bfsQueue.empty()) {
-                    state_t currentNode = bfsQueue.front();
-                    bfsQueue.pop();
-
-                    if (!kShortestPaths[currentNode].empty()) {
-                        continue; // already visited
-                    }
-
-                    for (state_t successorNode : shortestPathSuccessors[currentNode]) {
-                        bfsQueue.push(successorNode);
-                    }
-
+            Path<T> ShortestPathsGenerator<T>::getKShortestPath(state_t node, unsigned long k) const {
+                assert(k >= 1 && getNumberOfComputedPaths(node) >= k);
+                if (k == 1) {
                     // note that `shortestPathPredecessor` may not be present
                     // if current node is an initial state
-                    // in this case, the boost::optional copy of an uninitialized optional is hopefully also uninitialized
-                    kShortestPaths[currentNode].push_back(Path<T> {
-                            shortestPathPredecessors[currentNode],
+                    return Path<T> {
+                            shortestPathPredecessors[node],
                             1,
-                            shortestPathDistances[currentNode]
-                    });
+                            shortestPathDistances[node]
+                    };
                 }
+                return kShortestPaths.at(node)[k - 2]; // index shift: the first stored path is the 2-shortest
             }
 
             template <typename T>
@@ -260,36 +264,45 @@ namespace storm {
             template <typename T>
             void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
                 assert(k >= 2); // Dijkstra is used for k=1
-                assert(kShortestPaths[node].size() == k - 1); // if not, the previous SP must not exist
+                assert(getNumberOfComputedPaths(node) == k - 1); // if not, the previous SP must not exist
+
+                // note that references to the elements of the maps stay valid when other nodes are inserted during the recursion
+                std::vector<Path<T>>& candidates = candidatePaths[node];
 
                 // TODO: I could extract the candidate generation to make this function more succinct
                 if (k == 2) {
                     // Step B.1 in J&M paper
 
-                    Path<T> shortestPathToNode = kShortestPaths[node][1 - 1]; // never forget index shift :-|
+                    Path<T> shortestPathToNode = getKShortestPath(node, 1);
+
+                    for (uint_fast64_t index = graphPredecessorIndications[node]; index < graphPredecessorIndications[node + 1]; ++index) {
+                        state_t predecessor = graphPredecessorStates[index];
+                        if (getNumberOfComputedPaths(predecessor) == 0) {
+                            // predecessor is unreachable, so there is no path through it
+                            continue;
+                        }
 
-                    for (state_t predecessor : graphPredecessors[node]) {
                         // add shortest paths to predecessors plus edge to current node
                         Path<T> pathToPredecessorPlusEdge = {
                             boost::optional<state_t>(predecessor),
                             1,
                             shortestPathDistances[predecessor] * getEdgeDistance(predecessor, node)
                         };
-                        candidatePaths[node].insert(pathToPredecessorPlusEdge);
 
                         // ... but not the actual shortest path
-                        auto it = std::find(candidatePaths[node].begin(), candidatePaths[node].end(), shortestPathToNode);
-                        if (it != candidatePaths[node].end()) {
-                            candidatePaths[node].erase(it);
+                        if (!(pathToPredecessorPlusEdge == shortestPathToNode)) {
+                            candidates.push_back(pathToPredecessorPlusEdge);
+                            std::push_heap(candidates.begin(), candidates.end(), isWorseCandidate);
                         }
                     }
                 }
 
-                if (not (k == 2 && isInitialState(node))) {
-                    // Steps B.2-5 in J&M paper
+                // the (k-1)th shortest path (i.e., one better than the one we want to compute)
+                Path<T> previousShortestPath = getKShortestPath(node, k - 1);
 
-                    // the (k-1)th shortest path (i.e., one better than the one we want to compute)
-                    Path<T> previousShortestPath = kShortestPaths[node][k - 1 - 1]; // oh god, I forgot index shift AGAIN
+                // only the shortest path to an initial state has no predecessor
+                if (previousShortestPath.predecessorNode) {
+                    // Steps B.2-5 in J&M paper
 
                     // the predecessor node on that path
                     state_t predecessor = previousShortestPath.predecessorNode.get();
@@ -299,34 +312,29 @@ namespace storm {
                     // i.e. source ~~tailK-shortest path~~> predecessor --> node
 
                     // compute one-worse-shortest path to the predecessor (if it hasn't yet been computed)
-                    if (kShortestPaths[predecessor].size() < tailK + 1) {
+                    if (getNumberOfComputedPaths(predecessor) < tailK + 1) {
                         // TODO: investigate recursion depth and possible iterative alternative
                         computeNextPath(predecessor, tailK + 1);
                     }
 
-                    if (kShortestPaths[predecessor].size() >= tailK + 1) {
+                    if (getNumberOfComputedPaths(predecessor) >= tailK + 1) {
                         // take that path, add an edge to the current node; that's a candidate
                         Path<T> pathToPredecessorPlusEdge = {
                                 boost::optional<state_t>(predecessor),
                                 tailK + 1,
-                                kShortestPaths[predecessor][tailK + 1 - 1].distance * getEdgeDistance(predecessor, node)
+                                getKShortestPath(predecessor, tailK + 1).distance * getEdgeDistance(predecessor, node)
                         };
-                        candidatePaths[node].insert(pathToPredecessorPlusEdge);
+                        candidates.push_back(pathToPredecessorPlusEdge);
+                        std::push_heap(candidates.begin(), candidates.end(), isWorseCandidate);
                     }
                     // else there was no path; TODO: does this need handling? -- yes, but not here (because the step B.1 may have added candidates)
                 }
 
                 // Step B.6 in J&M paper
-                if (!candidatePaths[node].empty()) {
-                    Path<T> minDistanceCandidate = *(candidatePaths[node].begin());
-                    for (auto path : candidatePaths[node]) {
-                        if (path.distance > minDistanceCandidate.distance) {
-                            minDistanceCandidate = path;
-                        }
-                    }
-
-                    candidatePaths[node].erase(std::find(candidatePaths[node].begin(), candidatePaths[node].end(), minDistanceCandidate));
-                    kShortestPaths[node].push_back(minDistanceCandidate);
+                if (!candidates.empty()) {
+                    std::pop_heap(candidates.begin(), candidates.end(), isWorseCandidate);
+                    kShortestPaths[node].push_back(candidates.back());
+                    candidates.pop_back();
                 } else {
                     // TODO: kSP does not exist. this is handled later, but it would be nice to catch it as early as possble, wouldn't it?
                     STORM_LOG_TRACE("KSP: no candidates, this will trigger nonexisting ksp after exiting these recursions. TODO: handle here");
@@ -334,29 +342,38 @@ namespace storm {
             }
 
             template <typename T>
-            void ShortestPathsGenerator<T>::computeKSP(unsigned long k) {
+            bool ShortestPathsGenerator<T>::tryComputeKSP(unsigned long k) {
                 if (k == 0) {
                     throw std::invalid_argument("Index 0 is invalid, since we use 1-based indices (sorry)!");
                 }
 
-                unsigned long alreadyComputedK = kShortestPaths[metaTarget].size();
+                unsigned long alreadyComputedK = getNumberOfComputedPaths(metaTarget);
 
                 for (unsigned long nextK = alreadyComputedK + 1; nextK <= k; nextK++) {
+                    if (nextK == 1) {
+                        // the shortest path is computed by Dijkstra, so the meta-target is not reachable at all
+                        return false;
+                    }
                     computeNextPath(metaTarget, nextK);
-                    if (kShortestPaths[metaTarget].size() < nextK) {
-                        unsigned long lastExistingK = nextK - 1;
-                        STORM_LOG_DEBUG("KSP throws (as expected) due to nonexistence -- maybe this is unhandled and causes the Python interface to segfault?");
-                        STORM_LOG_DEBUG("last existing k-SP has k=" + std::to_string(lastExistingK));
-                        STORM_LOG_DEBUG("maybe this is unhandled and causes the Python interface to segfault?");
-                        throw std::invalid_argument("k-SP does not exist for k=" + std::to_string(k));
+                    if (getNumberOfComputedPaths(metaTarget) < nextK) {
+                        STORM_LOG_DEBUG("last existing k-SP has k=" + std::to_string(nextK - 1));
+                        return false;
                     }
                 }
+                return true;
+            }
+
+            template <typename T>
+            void ShortestPathsGenerator<T>::computeKSP(unsigned long k) {
+                if (!tryComputeKSP(k)) {
+                    throw std::invalid_argument("k-SP does not exist for k=" + std::to_string(k));
+                }
             }
 
             template <typename T>
             void ShortestPathsGenerator<T>::printKShortestPath(state_t targetNode, unsigned long k, bool head) const {
                 // note the index shift! risk of off-by-one
-                Path<T> p = kShortestPaths[targetNode][k - 1];
+                Path<T> p = getKShortestPath(targetNode, k);
 
                 if (head) {
                     std::cout << "Path (reversed";
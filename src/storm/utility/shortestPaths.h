@@ -1,6 +1,8 @@
 #ifndef STORM_UTIL_SHORTESTPATHS_H_
 #define STORM_UTIL_SHORTESTPATHS_H_
 
+#include <functional>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 #include <boost/optional/optional.hpp>
@@ -47,7 +49,7 @@ namespace storm {
                     if (predecessorNode != rhs.predecessorNode) {
                         return predecessorNode < rhs.predecessorNode;
                     }
-                    return predecessorK < predecessorK;
+                    return predecessorK < rhs.predecessorK;
                 }
 
                 bool operator==(const Path<T>& rhs) const {
@@ -116,6 +118,19 @@ namespace storm {
                  */
                 OrderedStateList getPathAsList(unsigned long k);
 
+                /*!
+                 * Computes the shortest paths one after another (in order of decreasing probability) until their
+                 * accumulated probability reaches the given threshold or no further path exists. Only the states
+                 * touched by the search are expanded, so this is much cheaper than asking for a fixed (large) k.
+                 * The given callback (if any) is invoked with the index and the probability of each newly computed
+                 * path; the search stops early if it returns false.
+                 * Paths that were already computed by earlier calls are considered again, i.e., the search always
+                 * starts at k=1.
+                 *
+                 * @return The number of paths whose probabilities were accumulated.
+                 */
+                unsigned long computeKSPUntil(T const& probabilityThreshold, std::function<bool(unsigned long, T const&)> const& pathCallback = nullptr);
+
 
             private:
                 Matrix const& transitionMatrix;
@@ -126,19 +141,23 @@ namespace storm {
 
                 MatrixFormat matrixFormat;
 
-                std::vector<OrderedStateList>         graphPredecessors;
+                // the predecessors of node i are graphPredecessorStates[graphPredecessorIndications[i] .. graphPredecessorIndications[i+1])
+                std::vector<uint_fast64_t>            graphPredecessorIndications;
+                std::vector<state_t>                  graphPredecessorStates;
                 std::vector<boost::optional<state_t>> shortestPathPredecessors;
-                std::vector<OrderedStateList>         shortestPathSuccessors;
                 std::vector<T>                        shortestPathDistances;
 
-                std::vector<std::vector<Path<T>>> kShortestPaths;
-                std::vector<std::set<Path<T>>>    candidatePaths;
+                // the (1-)shortest paths are given implicitly by the Dijkstra results; the k-shortest paths for k >= 2
+                // and the candidates are only stored for the nodes touched by the search.
+                // The candidates of each node are organized as a heap (see `isWorseCandidate`).
+                std::unordered_map<state_t, std::vector<Path<T>>> kShortestPaths;
+                std::unordered_map<state_t, std::vector<Path<T>>> candidatePaths;
 
                 /*!
                  * Computes list of predecessors for all nodes.
                  * Reachability is not considered; a predecessor is simply any node that has an edge leading to the node in question.
                  * Requires `transitionMatrix`.
-                 * Modifies `graphPredecessors`.
+                 * Modifies `graphPredecessorIndications` and `graphPredecessorStates`.
                  */
                 void computePredecessors();
 
@@ -150,30 +169,44 @@ namespace storm {
                 void performDijkstra();
 
                 /*!
-                 * Computes list of shortest path successor nodes from predecessor list.
-                 * Requires `shortestPathPredecessors`, `numStates`.
-                 * Modifies `shortestPathSuccessors`.
+                 * Returns the number of shortest paths to the given node that have been computed so far.
+                 * The (1-)shortest path is available right after Dijkstra (if the node is reachable at all).
                  */
-                void computeSPSuccessors();
+                unsigned long getNumberOfComputedPaths(state_t node) const;
 
                 /*!
-                 * Constructs and stores the implicit shortest path representations (see `Path`) for the (1-)shortest paths.
-                 * Requires `shortestPathPredecessors`, `shortestPathDistances`, `model`, `numStates`.
-                 * Modifies `kShortestPaths`.
+                 * Returns the implicit representation of the (already computed) k-shortest path to the given node.
                  */
-                void initializeShortestPaths();
+                Path<T> getKShortestPath(state_t node, unsigned long k) const;
 
                 /*!
                  * Main step of REA algorithm. TODO: Document further.
                  */
                 void computeNextPath(state_t node, unsigned long k);
 
+                /*!
+                 * Computes k-shortest path if not yet computed.
+                 * @return false iff no such k-shortest path exists
+                 */
+                bool tryComputeKSP(unsigned long k);
+
                 /*!
                  * Computes k-shortest path if not yet computed.
                  * @throws std::invalid_argument if no such k-shortest path exists
                  */
                 void computeKSP(unsigned long k);
 
+                /*!
+                 * Order of the candidate heaps: the best candidate (i.e., the one with the highest probability and,
+                 * among those, the one with the smallest predecessor) is at the top.
+                 */
+                static bool isWorseCandidate(Path<T> const& lhs, Path<T> const& rhs) {
+                    if (lhs.distance != rhs.distance) {
+                        return lhs.distance < rhs.distance;
+                    }
+                    return rhs.predecessorNode < lhs.predecessorNode;
+                }
+
                 /*!
                  * Recurses over the path and prints the nodes. Intended for debugging.
                  */
@@ -188,7 +221,7 @@ namespace storm {
                 // --- tiny helper fcts ---
 
                 inline bool isInitialState(state_t node) const {
-                    return find(initialStates.begin(), initialStates.end(), node) != initialStates.end();
+                    return node != metaTarget && initialStates.get(node);
                 }
 
                 inline bool isMetaTargetPredecessor(state_t node) const {
@@ -0,0 +1,41 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/storm.h"
+
+#include "storm-dft/builder/ExplicitDFTModelBuilder.h"
+#include "storm-dft/parser/DFTGalileoParser.h"
+
+namespace {
+    std::shared_ptr<storm::models::sparse::Model<double>> buildDft(std::string const& file) {
+        storm::parser::DFTGalileoParser<double> parser;
+        storm::storage::DFT<double> dft = parser.parseDFT(file);
+        std::vector<std::shared_ptr<storm::logic::Formula const>> properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties("P=? [F<=1 \"failed\"]"));
+
+        std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+        storm::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+        storm::builder::ExplicitDFTModelBuilder<double> builder(dft, symmetries, true);
+        storm::builder::ExplicitDFTModelBuilder<double>::LabelOptions labeloptions(properties);
+        builder.buildModel(labeloptions, 0, 0.0);
+        return builder.getModel();
+    }
+}
+
+TEST(ExplicitDftModelBuilderTest, And) {
+    // Every subset of failed BEs is a state, except that all failed states are merged into one.
+    // Most successors already exist when they are generated.
+    std::shared_ptr<storm::models::sparse::Model<double>> model = buildDft(STORM_TEST_RESOURCES_DIR "/dft/and.dft");
+    ASSERT_TRUE(model->isOfType(storm::models::ModelType::Ctmc));
+    EXPECT_EQ(8ul, model->getNumberOfStates());
+    EXPECT_EQ(13ul, model->getNumberOfTransitions());
+    EXPECT_EQ(1ul, model->getStates("failed").getNumberOfSetBits());
+}
+
+TEST(ExplicitDftModelBuilderTest, Pand) {
+    // Failing the second child first makes the PAND failsafe.
+    std::shared_ptr<storm::models::sparse::Model<double>> model = buildDft(STORM_TEST_RESOURCES_DIR "/dft/pand.dft");
+    ASSERT_TRUE(model->isOfType(storm::models::ModelType::Ctmc));
+    EXPECT_EQ(4ul, model->getNumberOfStates());
+    EXPECT_EQ(5ul, model->getNumberOfTransitions());
+    EXPECT_EQ(1ul, model->getStates("failed").getNumberOfSetBits());
+}
@@ -0,0 +1,67 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/storm.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/GeneralSettings.h"
+
+#include "storm-dft/modelchecker/dft/DFTModelChecker.h"
+#include "storm-dft/parser/DFTGalileoParser.h"
+
+TEST(DftModelCheckerTest, ParallelModules) {
+    storm::parser::DFTGalileoParser<double> parser;
+    storm::storage::DFT<double> dft = parser.parseDFT(STORM_TEST_RESOURCES_DIR "/dft/modules.dft");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties("P=? [F<=1 \"failed\"]; P=? [F<=3 \"failed\"]"));
+    
+    // The top level AND gate splits the DFT into three independent modules.
+    storm::modelchecker::DFTModelChecker<double> sequentialChecker;
+    {
+        std::unique_ptr<storm::settings::SettingMemento> intelTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+        sequentialChecker.check(dft, properties, true, true, true, 0.0);
+    }
+    
+    // With TBB enabled (if available), the modules are checked in parallel.
+    storm::modelchecker::DFTModelChecker<double> parallelChecker;
+    {
+        std::unique_ptr<storm::settings::SettingMemento> intelTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        parallelChecker.check(dft, properties, true, true, true, 0.0);
+    }
+    
+    // Checking the DFT as a whole yields the same results.
+    storm::modelchecker::DFTModelChecker<double> monolithicChecker;
+    monolithicChecker.check(dft, properties, true, false, true, 0.0);
+    
+    ASSERT_EQ(properties.size(), sequentialChecker.getResults().size());
+    ASSERT_EQ(properties.size(), parallelChecker.getResults().size());
+    ASSERT_EQ(properties.size(), monolithicChecker.getResults().size());
+    for (size_t i = 0; i < properties.size(); ++i) {
+        double sequentialResult = boost::get<double>(sequentialChecker.getResults()[i]);
+        EXPECT_NEAR(sequentialResult, boost::get<double>(parallelChecker.getResults()[i]), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+        EXPECT_NEAR(sequentialResult, boost::get<double>(monolithicChecker.getResults()[i]), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    }
+}
+
+TEST(DftModelCheckerTest, ApproximationBounds) {
+    storm::parser::DFTGalileoParser<double> parser;
+    storm::storage::DFT<double> dft = parser.parseDFT(STORM_TEST_RESOURCES_DIR "/dft/modules.dft");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties("P=? [F<=1 \"failed\"]"));
+    double precision = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision();
+    
+    storm::modelchecker::DFTModelChecker<double> exactChecker;
+    exactChecker.check(dft, properties, true, false, true, 0.0);
+    double exactResult = boost::get<double>(exactChecker.getResults().front());
+    
+    // Check the bounds one after another and (if TBB is available) concurrently.
+    for (bool useIntelTbb : {false, true}) {
+        std::unique_ptr<storm::settings::SettingMemento> intelTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(useIntelTbb);
+        storm::modelchecker::DFTModelChecker<double> approximationChecker;
+        approximationChecker.check(dft, properties, true, false, true, 0.1);
+        ASSERT_EQ(1ul, approximationChecker.getResults().size());
+        
+        storm::modelchecker::DFTModelChecker<double>::approximation_result bounds = boost::get<storm::modelchecker::DFTModelChecker<double>::approximation_result>(approximationChecker.getResults().front());
+        EXPECT_LE(bounds.first, exactResult + precision);
+        EXPECT_GE(bounds.second, exactResult - precision);
+    }
+}
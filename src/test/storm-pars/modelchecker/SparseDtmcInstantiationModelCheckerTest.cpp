@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include<carl/core/VariablePool.h>
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/GeneralSettings.h"
+
+#include "storm-pars/api/storm-pars.h"
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm/api/storm.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Checks the given valuations as one batch and compares the results to the ones of checking each valuation with a fresh
+    // checker, so that the latter do not profit from the results of other valuations.
+    void expectBatchMatchesIndividualChecks(std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> const& model, std::shared_ptr<const storm::logic::Formula> const& formula, std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> const& valuations) {
+        uint64_t initialState = *model->getInitialStates().begin();
+        auto task = storm::api::createTask<storm::RationalFunction>(formula, true);
+        storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> batchChecker(*model);
+        batchChecker.specifyFormula(task);
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> batchResults = batchChecker.checkBatch(valuations);
+        ASSERT_EQ(valuations.size(), batchResults.size());
+
+        double precision = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision();
+        for (uint64_t i = 0; i < valuations.size(); ++i) {
+            storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> checker(*model);
+            checker.specifyFormula(task);
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(valuations[i]);
+
+            double expected = result->asExplicitQuantitativeCheckResult<double>()[initialState];
+            EXPECT_NEAR(expected, batchResults[i]->asExplicitQuantitativeCheckResult<double>()[initialState], 10 * precision * std::max(1.0, std::abs(expected)));
+        }
+    }
+
+    // Creates the valuations of the given grid. The values are given in an order that differs from the one in which the batch processes them.
+    std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> createGrid(storm::RationalFunctionVariable const& x, std::vector<double> const& xValues, storm::RationalFunctionVariable const& y, std::vector<double> const& yValues) {
+        std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations;
+        for (double xValue : xValues) {
+            for (double yValue : yValues) {
+                storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+                valuation.insert(std::make_pair(x, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(xValue)));
+                valuation.insert(std::make_pair(y, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(yValue)));
+                valuations.push_back(std::move(valuation));
+            }
+        }
+        return valuations;
+    }
+}
+
+TEST(SparseDtmcInstantiationModelCheckerTest, Brp_Prob_Batch) {
+    carl::VariablePool::getInstance().clear();
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+
+    // The grid spans several blocks. For pK=1, the graph of the model changes, so these valuations are checked individually.
+    expectBatchMatchesIndividualChecks(model, formulas[0], createGrid(pK, {0.9, 0.3, 1.0, 0.6, 0.1, 0.75}, pL, {0.2, 0.8, 0.5, 0.95}));
+
+    carl::VariablePool::getInstance().clear();
+}
+
+TEST(SparseDtmcInstantiationModelCheckerTest, Brp_Rew_Batch) {
+    carl::VariablePool::getInstance().clear();
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp_rewards16_2.pm";
+    std::string formulaAsString = "R=? [F ((s=5) | (s=0&srep=3)) ]";
+    std::string constantsAsString = "pL=0.9,TOAck=0.5";
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsAsString);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& TOMsg = carl::VariablePool::getInstance().findVariableWithName("TOMsg");
+    ASSERT_NE(TOMsg, carl::Variable::NO_VARIABLE);
+
+    // A reward of zero does not change the graph of the model, so all valuations are solved in blocks.
+    expectBatchMatchesIndividualChecks(model, formulas[0], createGrid(pK, {0.7, 0.2, 0.875, 0.5}, TOMsg, {0.95, 0.0, 0.5, 0.75, 0.3}));
+
+    carl::VariablePool::getInstance().clear();
+}
+
+#endif
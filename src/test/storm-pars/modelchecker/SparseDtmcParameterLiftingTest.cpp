@@ -3,6 +3,9 @@
 
 #ifdef STORM_HAVE_CARL
 
+#include <queue>
+#include <set>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm-pars/api/storm-pars.h"
@@ -38,6 +41,81 @@ TEST(SparseDtmcParameterLiftingTest, Brp_Prob) {
     carl::VariablePool::getInstance().clear();
 }
 
+TEST(SparseDtmcParameterLiftingTest, Brp_Prob_Refinement) {
+    
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P<=0.84 [F s=5 ]";
+    std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsAsString);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+    modelParameters.insert(rewParameters.begin(), rewParameters.end());
+    
+    auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, double>(model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+    auto region = storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.9,0.1<=pK<=0.9", modelParameters);
+    uint64_t depthThreshold = 3;
+    auto refinementResult = regionChecker->performRegionRefinement(region, storm::utility::zero<storm::RationalFunction>(), depthThreshold);
+    
+    // Compute the expected result with a plain refinement of the region: larger regions first, then the subregions of the
+    // regions whose bound was closest to the threshold and then the regions that were created first.
+    struct ExpectedRegion {
+        storm::storage::ParameterRegion<storm::RationalFunction> region;
+        storm::modelchecker::RegionResult result;
+        uint64_t depth;
+        double distanceOfParentToThreshold;
+        uint64_t index;
+    };
+    auto compareRegions = [] (ExpectedRegion const& lhs, ExpectedRegion const& rhs) {
+        if (lhs.region.area() != rhs.region.area()) {
+            return lhs.region.area() < rhs.region.area();
+        }
+        if (lhs.distanceOfParentToThreshold != rhs.distanceOfParentToThreshold) {
+            return lhs.distanceOfParentToThreshold > rhs.distanceOfParentToThreshold;
+        }
+        return lhs.index > rhs.index;
+    };
+    std::vector<std::pair<storm::storage::ParameterRegion<storm::RationalFunction>, storm::modelchecker::RegionResult>> expectedResult;
+    std::priority_queue<ExpectedRegion, std::vector<ExpectedRegion>, decltype(compareRegions)> unprocessedRegions(compareRegions);
+    uint64_t numberOfRegions = 0;
+    unprocessedRegions.push(ExpectedRegion {region, storm::modelchecker::RegionResult::Unknown, 0, 0.0, numberOfRegions++});
+    std::set<double> distancesOfInconclusiveRegions;
+    while (!unprocessedRegions.empty()) {
+        ExpectedRegion current = unprocessedRegions.top();
+        unprocessedRegions.pop();
+        current.result = regionChecker->analyzeRegion(current.region, storm::modelchecker::RegionResultHypothesis::Unknown, current.result, false);
+        if (current.result == storm::modelchecker::RegionResult::AllSat || current.result == storm::modelchecker::RegionResult::AllViolated || current.depth >= depthThreshold) {
+            expectedResult.emplace_back(current.region, current.result);
+        } else {
+            boost::optional<double> distanceToThreshold = regionChecker->getDistanceToThresholdOfLastAnalysis();
+            ASSERT_TRUE(static_cast<bool>(distanceToThreshold));
+            distancesOfInconclusiveRegions.insert(distanceToThreshold.get());
+            std::vector<storm::storage::ParameterRegion<storm::RationalFunction>> newRegions;
+            current.region.split(current.region.getCenterPoint(), newRegions);
+            storm::modelchecker::RegionResult initResForNewRegions = (current.result == storm::modelchecker::RegionResult::CenterSat) ? storm::modelchecker::RegionResult::ExistsSat : ((current.result == storm::modelchecker::RegionResult::CenterViolated) ? storm::modelchecker::RegionResult::ExistsViolated : storm::modelchecker::RegionResult::Unknown);
+            for (auto& newRegion : newRegions) {
+                unprocessedRegions.push(ExpectedRegion {std::move(newRegion), initResForNewRegions, current.depth + 1, distanceToThreshold.get(), numberOfRegions++});
+            }
+        }
+    }
+    // The distances of the inconclusive regions differ, so they actually determine the order of the refinement.
+    EXPECT_LT(1ull, distancesOfInconclusiveRegions.size());
+    
+    auto const& regionResults = refinementResult->getRegionResults();
+    ASSERT_EQ(expectedResult.size(), regionResults.size());
+    for (uint64_t i = 0; i < expectedResult.size(); ++i) {
+        EXPECT_EQ(expectedResult[i].first.toString(), regionResults[i].first.toString());
+        EXPECT_EQ(expectedResult[i].second, regionResults[i].second);
+    }
+    
+    carl::VariablePool::getInstance().clear();
+}
+
 TEST(SparseDtmcParameterLiftingTest, Brp_Rew) {
     std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp_rewards16_2.pm";
     std::string formulaAsString = "R>2.5 [F ((s=5) | (s=0&srep=3)) ]";
@@ -0,0 +1,52 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include<carl/numbers/numbers.h>
+#include<carl/core/VariablePool.h>
+
+#include "storm-pars/utility/CompiledFunctions.h"
+#include "storm/api/storm.h"
+#include "storm/models/sparse/Dtmc.h"
+
+TEST(CompiledFunctionsTest, BrpExact) {
+    carl::VariablePool::getInstance().clear();
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size()==1);
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    storm::utility::parametric::CompiledFunctions<storm::RationalFunction, storm::RationalNumber> compiledFunctions;
+    std::vector<storm::RationalFunction> functions;
+    for (auto const& entry : dtmc->getTransitionMatrix()) {
+        functions.push_back(entry.getValue());
+        EXPECT_EQ(functions.size() - 1, compiledFunctions.addFunction(entry.getValue()));
+    }
+    EXPECT_EQ(functions.size(), compiledFunctions.getNumberOfFunctions());
+    EXPECT_EQ(2ull, compiledFunctions.getVariables().size());
+
+    std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+    valuation.insert(std::make_pair(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.8)));
+    valuation.insert(std::make_pair(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.9)));
+
+    std::vector<storm::RationalNumber> result;
+    compiledFunctions.evaluateAll(compiledFunctions.getPoint(valuation), result);
+    ASSERT_EQ(functions.size(), result.size());
+    for (uint64_t i = 0; i < functions.size(); ++i) {
+        EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(functions[i].evaluate(valuation)), result[i]);
+    }
+}
+
+#endif
@@ -203,6 +203,58 @@ TEST(ModelInstantiatorTest, Brp_Rew) {
     }
     
 }
+
+TEST(ModelInstantiatorTest, Brp_Rew_Compiled) {
+    carl::VariablePool::getInstance().clear();
+    
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "R=? [F ((s=5) | (s=0&srep=3)) ]";
+    
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size()==1);
+    // Parametric model
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    // The compiled functions are evaluated in double arithmetic, so the results may differ from the rounded exact values in the last bits.
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> modelInstantiator(*dtmc, true);
+    
+    std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+    for (auto const& parameterValuePair : std::vector<std::pair<std::string, double>>({{"pL", 0.9}, {"pK", 0.3}, {"TOMsg", 0.3}, {"TOAck", 0.5}})) {
+        storm::RationalFunctionVariable const& parameter = carl::VariablePool::getInstance().findVariableWithName(parameterValuePair.first);
+        ASSERT_NE(parameter, carl::Variable::NO_VARIABLE);
+        valuation.insert(std::make_pair(parameter, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(parameterValuePair.second)));
+    }
+
+    storm::models::sparse::Dtmc<double> const& instantiated(modelInstantiator.instantiate(valuation));
+
+    ASSERT_EQ(dtmc->getTransitionMatrix().getRowGroupIndices(), instantiated.getTransitionMatrix().getRowGroupIndices());
+    for(std::size_t row = 0; row < dtmc->getTransitionMatrix().getRowCount(); ++row){
+        auto instantiatedEntry = instantiated.getTransitionMatrix().getRow(row).begin();
+        for(auto const& paramEntry : dtmc->getTransitionMatrix().getRow(row)){
+            EXPECT_EQ(paramEntry.getColumn(), instantiatedEntry->getColumn());
+            double evaluatedValue = carl::toDouble(paramEntry.getValue().evaluate(valuation));
+            EXPECT_NEAR(evaluatedValue, instantiatedEntry->getValue(), 1e-12);
+            ++instantiatedEntry;
+        }
+        EXPECT_EQ(instantiated.getTransitionMatrix().getRow(row).end(),instantiatedEntry);
+    }
+    ASSERT_TRUE(instantiated.hasUniqueRewardModel());
+    std::size_t stateActionEntries = dtmc->getUniqueRewardModel().getStateActionRewardVector().size();
+    ASSERT_EQ(stateActionEntries, instantiated.getUniqueRewardModel().getStateActionRewardVector().size());
+    for(std::size_t i =0; i<stateActionEntries; ++i){
+        double evaluatedValue = carl::toDouble(dtmc->getUniqueRewardModel().getStateActionRewardVector()[i].evaluate(valuation));
+        EXPECT_NEAR(evaluatedValue, instantiated.getUniqueRewardModel().getStateActionRewardVector()[i], 1e-12);
+    }
+
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> modelchecker(instantiated);
+    std::unique_ptr<storm::modelchecker::CheckResult> chkResult = modelchecker.check(*formulas[0]);
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double>& quantitativeChkResult = chkResult->asExplicitQuantitativeCheckResult<double>();
+    EXPECT_NEAR(1.308324495, quantitativeChkResult[*instantiated.getInitialStates().begin()], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+}
     
 
 TEST(ModelInstantiatorTest, Consensus) {
@@ -20,7 +20,9 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/modules/AbstractionSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 TEST(PrismMenuGame, DieAbstractionTest_Cudd) {
     storm::settings::mutableAbstractionSettings().setAddAllGuards(false);
@@ -1106,4 +1108,67 @@ TEST(PrismMenuGame, WlanFullAbstractionTest_Sylvan) {
     storm::settings::mutableAbstractionSettings().restoreDefaults();
 }
 
+#ifdef STORM_HAVE_INTELTBB
+namespace {
+    struct MenuGameSizes {
+        uint64_t numberOfStates;
+        uint64_t numberOfTransitions;
+        uint64_t numberOfChoices;
+        uint64_t numberOfBottomStates;
+        uint64_t numberOfTransitionMatrixNodes;
+    };
+    
+    template<storm::dd::DdType Type>
+    MenuGameSizes abstractAndRefineCrowds(bool parallel) {
+        std::unique_ptr<storm::settings::SettingMemento> intelTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(parallel);
+        storm::settings::mutableAbstractionSettings().setAddAllGuards(false);
+        
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+        program = program.substituteConstants();
+        
+        std::vector<storm::expressions::Expression> initialPredicates;
+        storm::expressions::ExpressionManager& manager = program.getManager();
+        
+        initialPredicates.push_back(manager.getVariableExpression("phase") < manager.integer(3));
+        
+        std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>();
+        
+        storm::abstraction::prism::PrismMenuGameAbstractor<Type, double> abstractor(program, smtSolverFactory);
+        storm::abstraction::MenuGameRefiner<Type, double> refiner(abstractor, smtSolverFactory->create(manager));
+        refiner.refine(initialPredicates);
+        
+        // Refining changes the relevant predicates of some commands, so their solutions need to be enumerated again.
+        refiner.refine({manager.getVariableExpression("observe0") + manager.getVariableExpression("observe1") + manager.getVariableExpression("observe2") + manager.getVariableExpression("observe3") + manager.getVariableExpression("observe4") <= manager.getVariableExpression("runCount")});
+        
+        storm::abstraction::MenuGame<Type, double> game = abstractor.abstract();
+        MenuGameSizes result = {game.getNumberOfStates(), game.getNumberOfTransitions(), game.getNumberOfChoices(), game.getBottomStates().getNonZeroCount(), game.getExtendedTransitionMatrix().getNodeCount()};
+        
+        storm::settings::mutableAbstractionSettings().restoreDefaults();
+        return result;
+    }
+    
+    template<storm::dd::DdType Type>
+    void checkParallelAbstraction() {
+        MenuGameSizes sequential = abstractAndRefineCrowds<Type>(false);
+        MenuGameSizes parallel = abstractAndRefineCrowds<Type>(true);
+        
+        EXPECT_EQ(8ull, sequential.numberOfStates);
+        EXPECT_EQ(68ull, sequential.numberOfTransitions);
+        EXPECT_EQ(sequential.numberOfStates, parallel.numberOfStates);
+        EXPECT_EQ(sequential.numberOfTransitions, parallel.numberOfTransitions);
+        EXPECT_EQ(sequential.numberOfChoices, parallel.numberOfChoices);
+        EXPECT_EQ(sequential.numberOfBottomStates, parallel.numberOfBottomStates);
+        EXPECT_EQ(sequential.numberOfTransitionMatrixNodes, parallel.numberOfTransitionMatrixNodes);
+    }
+}
+
+TEST(PrismMenuGame, CrowdsParallelAbstractionTest_Cudd) {
+    checkParallelAbstraction<storm::dd::DdType::CUDD>();
+}
+
+TEST(PrismMenuGame, CrowdsParallelAbstractionTest_Sylvan) {
+    checkParallelAbstraction<storm::dd::DdType::Sylvan>();
+}
+#endif
+
 #endif
@@ -12,6 +12,7 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm/parser/PrismParser.h"
 #include "storm/builder/DdJaniModelBuilder.h"
+#include "storm/utility/dd.h"
 
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
@@ -695,3 +696,43 @@ TEST(DdJaniModelBuilderTest_Sylvan, InputEnabling) {
     EXPECT_EQ(4ul, model->getNumberOfStates());
     EXPECT_EQ(5ul, model->getNumberOfTransitions());
 }
+
+namespace {
+    /*!
+     * Builds the given PRISM model with the JANI builder (which explores the state space over the transition relation
+     * partitioned by actions) and checks that the reachable states coincide with the ones obtained from the monolithic
+     * transition relation of the model, both explored at once and split into two parts in either order.
+     */
+    template<storm::dd::DdType Type>
+    void checkPartitionedReachability(std::string const& filename) {
+        storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(filename);
+        storm::jani::Model janiModel = modelDescription.toJani(true).preprocess().asJaniModel();
+        std::shared_ptr<storm::models::symbolic::Model<Type>> model = storm::builder::DdJaniModelBuilder<Type, double>().build(janiModel);
+        
+        storm::dd::Bdd<Type> transitions = model->getQualitativeTransitionMatrix(false);
+        storm::dd::Bdd<Type> monolithicReachableStates = storm::utility::dd::computeReachableStates(model->getInitialStates(), transitions, model->getRowVariables(), model->getColumnVariables());
+        EXPECT_TRUE(model->getReachableStates() == monolithicReachableStates) << filename;
+        
+        std::vector<storm::dd::Bdd<Type>> transitionRelationParts = {transitions && model->getInitialStates(), transitions && !model->getInitialStates()};
+        EXPECT_TRUE(monolithicReachableStates == storm::utility::dd::computeReachableStates(model->getInitialStates(), transitionRelationParts, model->getRowVariables(), model->getColumnVariables(), storm::utility::dd::ReachabilityOrder::BreadthFirst)) << filename;
+        EXPECT_TRUE(monolithicReachableStates == storm::utility::dd::computeReachableStates(model->getInitialStates(), transitionRelationParts, model->getRowVariables(), model->getColumnVariables(), storm::utility::dd::ReachabilityOrder::Chaining)) << filename;
+    }
+}
+
+TEST(DdJaniModelBuilderTest_Cudd, PartitionedReachability) {
+    checkPartitionedReachability<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm");
+    checkPartitionedReachability<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm");
+    checkPartitionedReachability<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm");
+    checkPartitionedReachability<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+    checkPartitionedReachability<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm");
+    checkPartitionedReachability<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/mdp/firewire3-0.5.nm");
+}
+
+TEST(DdJaniModelBuilderTest_Sylvan, PartitionedReachability) {
+    checkPartitionedReachability<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm");
+    checkPartitionedReachability<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm");
+    checkPartitionedReachability<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm");
+    checkPartitionedReachability<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+    checkPartitionedReachability<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm");
+    checkPartitionedReachability<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/mdp/firewire3-0.5.nm");
+}
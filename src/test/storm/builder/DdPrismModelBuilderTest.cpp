@@ -1,5 +1,8 @@
 #include "gtest/gtest.h"
 #include "storm-config.h"
+
+#include <boost/filesystem.hpp>
+
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
@@ -10,6 +13,7 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm/parser/PrismParser.h"
 #include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/builder/DdVariableOrdering.h"
 
 TEST(DdPrismModelBuilderTest_Sylvan, Dtmc) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -319,3 +323,133 @@ TEST(DdPrismModelBuilderTest_Cudd, Composition) {
     EXPECT_EQ(21ul, mdp->getNumberOfChoices());
 }
 
+namespace {
+    /*!
+     * Restores the variable order settings of the symbolic model builders to the values they had upon construction.
+     */
+    class DdVariableOrderSettingsMemento {
+    public:
+        DdVariableOrderSettingsMemento() : heuristic(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrderingHeuristic()) {
+            storm::settings::modules::BuildSettings const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+            if (buildSettings.isImportDdVariableOrderSet()) {
+                importFilename = buildSettings.getImportDdVariableOrderFilename();
+            }
+            if (buildSettings.isExportDdVariableOrderSet()) {
+                exportFilename = buildSettings.getExportDdVariableOrderFilename();
+            }
+        }
+        
+        ~DdVariableOrderSettingsMemento() {
+            storm::settings::mutableBuildSettings().setDdVariableOrderingHeuristic(heuristic);
+            storm::settings::mutableBuildSettings().setImportDdVariableOrderFilename(importFilename);
+            storm::settings::mutableBuildSettings().setExportDdVariableOrderFilename(exportFilename);
+        }
+        
+    private:
+        storm::builder::DdVariableOrderingHeuristic heuristic;
+        boost::optional<std::string> importFilename;
+        boost::optional<std::string> exportFilename;
+    };
+    
+    /*!
+     * Deletes the given file upon destruction.
+     */
+    struct TemporaryFile {
+        TemporaryFile() : path(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("DdPrismModelBuilderTest-%%%%-%%%%-%%%%.txt")) {
+            // Intentionally left empty.
+        }
+        
+        ~TemporaryFile() {
+            boost::system::error_code errorCode;
+            boost::filesystem::remove(path, errorCode);
+        }
+        
+        boost::filesystem::path path;
+    };
+    
+    template<storm::dd::DdType Type>
+    void checkModelSizesWithCurrentOrder() {
+        // The variable order must not change the model that is built.
+        storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm");
+        storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+        std::shared_ptr<storm::models::symbolic::Model<Type>> model = storm::builder::DdPrismModelBuilder<Type>().build(program);
+        EXPECT_EQ(677ul, model->getNumberOfStates());
+        EXPECT_EQ(867ul, model->getNumberOfTransitions());
+        
+        modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+        program = modelDescription.preprocess().asPrismProgram();
+        model = storm::builder::DdPrismModelBuilder<Type>().build(program);
+        EXPECT_EQ(8607ul, model->getNumberOfStates());
+        EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+        
+        modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm");
+        program = modelDescription.preprocess().asPrismProgram();
+        model = storm::builder::DdPrismModelBuilder<Type>().build(program);
+        EXPECT_EQ(273ul, model->getNumberOfStates());
+        EXPECT_EQ(397ul, model->getNumberOfTransitions());
+        
+        modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+        program = modelDescription.preprocess().asPrismProgram();
+        model = storm::builder::DdPrismModelBuilder<Type>().build(program);
+        ASSERT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+        std::shared_ptr<storm::models::symbolic::Mdp<Type>> mdp = model->template as<storm::models::symbolic::Mdp<Type>>();
+        EXPECT_EQ(272ul, mdp->getNumberOfStates());
+        EXPECT_EQ(492ul, mdp->getNumberOfTransitions());
+        EXPECT_EQ(400ul, mdp->getNumberOfChoices());
+        
+        modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/firewire3-0.5.nm");
+        program = modelDescription.preprocess().asPrismProgram();
+        model = storm::builder::DdPrismModelBuilder<Type>().build(program);
+        ASSERT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+        mdp = model->template as<storm::models::symbolic::Mdp<Type>>();
+        EXPECT_EQ(4093ul, mdp->getNumberOfStates());
+        EXPECT_EQ(5585ul, mdp->getNumberOfTransitions());
+        EXPECT_EQ(5519ul, mdp->getNumberOfChoices());
+    }
+}
+
+TEST(DdPrismModelBuilderTest_Sylvan, ForceOrder) {
+    DdVariableOrderSettingsMemento orderSettings;
+    storm::settings::mutableBuildSettings().setDdVariableOrderingHeuristic(storm::builder::DdVariableOrderingHeuristic::Force);
+    checkModelSizesWithCurrentOrder<storm::dd::DdType::Sylvan>();
+}
+
+TEST(DdPrismModelBuilderTest_Cudd, ForceOrder) {
+    DdVariableOrderSettingsMemento orderSettings;
+    storm::settings::mutableBuildSettings().setDdVariableOrderingHeuristic(storm::builder::DdVariableOrderingHeuristic::Force);
+    checkModelSizesWithCurrentOrder<storm::dd::DdType::CUDD>();
+}
+
+TEST(DdPrismModelBuilderTest_Cudd, ExportImportOrder) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    TemporaryFile orderFile;
+    std::string filename = orderFile.path.string();
+    
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> exportModel;
+    {
+        // Build the model with the order of the FORCE heuristic and export the order.
+        DdVariableOrderSettingsMemento orderSettings;
+        storm::settings::mutableBuildSettings().setDdVariableOrderingHeuristic(storm::builder::DdVariableOrderingHeuristic::Force);
+        storm::settings::mutableBuildSettings().setExportDdVariableOrderFilename(filename);
+        exportModel = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program);
+    }
+    ASSERT_TRUE(boost::filesystem::exists(orderFile.path));
+    
+    // Reading the order back yields the order of the heuristic.
+    storm::builder::DdVariableOrdering ordering = storm::builder::DdVariableOrdering::create(program);
+    EXPECT_EQ(ordering.computeOrder(storm::builder::DdVariableOrderingHeuristic::Force), ordering.importOrder(filename));
+    
+    // Building the model with the imported order yields the same decision diagrams.
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> importModel;
+    {
+        DdVariableOrderSettingsMemento orderSettings;
+        storm::settings::mutableBuildSettings().setImportDdVariableOrderFilename(filename);
+        importModel = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program);
+    }
+    
+    EXPECT_EQ(8607ul, importModel->getNumberOfStates());
+    EXPECT_EQ(15113ul, importModel->getNumberOfTransitions());
+    EXPECT_EQ(exportModel->getTransitionMatrix().getNodeCount(), importModel->getTransitionMatrix().getNodeCount());
+    EXPECT_EQ(exportModel->getReachableStates().getNodeCount(), importModel->getReachableStates().getNodeCount());
+}
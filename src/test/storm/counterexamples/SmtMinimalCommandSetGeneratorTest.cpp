@@ -0,0 +1,37 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_Z3
+
+#include "storm/api/storm.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/counterexamples/SMTMinimalLabelSetGenerator.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+TEST(SmtMinimalCommandSetGeneratorTest, MinimalCommands) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/minimal_commands.nm");
+    storm::generator::NextStateGeneratorOptions options;
+    options.setBuildAllLabels();
+    options.setBuildChoiceOrigins();
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::builder::ExplicitModelBuilder<double>(program, options).build()->as<storm::models::sparse::Mdp<double>>();
+    storm::storage::BitVector phiStates(mdp->getNumberOfStates(), true);
+    storm::storage::BitVector const& psiStates = mdp->getStates("target");
+
+    // Candidate command sets are checked one after another and (if TBB is available) in batches.
+    for (bool useIntelTbb : {false, true}) {
+        std::unique_ptr<storm::settings::SettingMemento> intelTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(useIntelTbb);
+
+        boost::container::flat_set<uint_fast64_t> commandSet = storm::counterexamples::SMTMinimalLabelSetGenerator<double>::getMinimalCommandSet(program, *mdp, phiStates, psiStates, 0.55, false, true);
+        EXPECT_EQ(2ul, commandSet.size());
+        EXPECT_EQ(boost::container::flat_set<uint_fast64_t>({1, 4}), commandSet);
+
+        commandSet = storm::counterexamples::SMTMinimalLabelSetGenerator<double>::getMinimalCommandSet(program, *mdp, phiStates, psiStates, 0.7, false, true);
+        EXPECT_EQ(3ul, commandSet.size());
+        EXPECT_EQ(boost::container::flat_set<uint_fast64_t>({0, 2, 3}), commandSet);
+    }
+}
+
+#endif
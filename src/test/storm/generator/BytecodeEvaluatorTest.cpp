@@ -0,0 +1,49 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/generator/BytecodeEvaluator.h"
+#include "storm/generator/VariableInformation.h"
+
+TEST(BytecodeEvaluatorTest, Evaluation) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+
+    storm::expressions::Variable x;
+    storm::expressions::Variable y;
+    storm::expressions::Variable z;
+    ASSERT_NO_THROW(x = manager->declareBooleanVariable("x"));
+    ASSERT_NO_THROW(y = manager->declareIntegerVariable("y"));
+    ASSERT_NO_THROW(z = manager->declareRationalVariable("z"));
+
+    // Only x and y are stored in the state: x at bit 0 and y (ranging from -2 to 5) in bits 1 to 3.
+    storm::generator::VariableInformation variableInformation;
+    variableInformation.booleanVariables.emplace_back(x, 0);
+    variableInformation.integerVariables.emplace_back(y, -2, 5, 1, 3);
+    variableInformation.totalBitOffset = 4;
+
+    storm::expressions::Expression guard = x && y > manager->integer(0);
+    storm::expressions::Expression iteExpression = storm::expressions::ite(x, y * manager->integer(2), y - manager->integer(1));
+    storm::expressions::Expression ratio = y / manager->rational(4);
+    storm::expressions::Expression unsupported = x || z > manager->integer(1);
+
+    storm::generator::BytecodeEvaluator evaluator(variableInformation);
+    EXPECT_FALSE(evaluator.canCompile(unsupported));
+    evaluator.addProgram({guard, iteExpression, ratio, unsupported});
+    EXPECT_TRUE(evaluator.isCompiled(guard));
+    EXPECT_TRUE(evaluator.isCompiled(iteExpression));
+    EXPECT_TRUE(evaluator.isCompiled(ratio));
+    EXPECT_FALSE(evaluator.isCompiled(unsupported));
+
+    storm::generator::CompressedState state(64);
+    for (int_fast64_t yValue = -2; yValue <= 5; ++yValue) {
+        for (bool xValue : {false, true}) {
+            state.set(0, xValue);
+            state.setFromInt(1, 3, yValue + 2);
+            evaluator.load(state);
+
+            EXPECT_EQ(xValue && yValue > 0, evaluator.asBool(guard));
+            EXPECT_EQ(xValue ? yValue * 2 : yValue - 1, evaluator.asInt(iteExpression));
+            EXPECT_NEAR(yValue / 4.0, evaluator.asRational(ratio), 1e-6);
+        }
+    }
+}
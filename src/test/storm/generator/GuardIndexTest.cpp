@@ -0,0 +1,49 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/generator/GuardIndex.h"
+#include "storm/generator/VariableInformation.h"
+
+TEST(GuardIndexTest, ComputeCandidates) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+
+    storm::expressions::Variable x;
+    storm::expressions::Variable y;
+    ASSERT_NO_THROW(x = manager->declareBooleanVariable("x"));
+    ASSERT_NO_THROW(y = manager->declareIntegerVariable("y"));
+
+    // The variable x is stored at bit 0 and y (ranging from -2 to 5) in bits 1 to 3.
+    storm::generator::VariableInformation variableInformation;
+    variableInformation.booleanVariables.emplace_back(x, 0);
+    variableInformation.integerVariables.emplace_back(y, -2, 5, 1, 3);
+    variableInformation.totalBitOffset = 4;
+
+    std::vector<storm::expressions::Expression> guards;
+    guards.push_back(x && y == manager->integer(1));
+    guards.push_back(!x);
+    guards.push_back(y == manager->integer(0) || manager->integer(3) == y);
+    guards.push_back(y > manager->integer(2));
+    guards.push_back(y == manager->integer(1) && y == manager->integer(2));
+
+    storm::generator::GuardIndex index(variableInformation, guards);
+    EXPECT_EQ(5ull, index.getNumberOfGuards());
+    EXPECT_FALSE(index.isTrivial());
+
+    storm::generator::CompressedState state(64);
+    storm::storage::BitVector candidates;
+    for (int_fast64_t yValue = -2; yValue <= 5; ++yValue) {
+        for (bool xValue : {false, true}) {
+            state.set(0, xValue);
+            state.setFromInt(1, 3, yValue + 2);
+            index.computeCandidates(state, candidates);
+
+            ASSERT_EQ(5ull, candidates.size());
+            EXPECT_EQ(xValue && yValue == 1, candidates.get(0));
+            EXPECT_EQ(!xValue, candidates.get(1));
+            EXPECT_EQ(yValue == 0 || yValue == 3, candidates.get(2));
+            EXPECT_TRUE(candidates.get(3));
+            EXPECT_FALSE(candidates.get(4));
+        }
+    }
+}
@@ -1,6 +1,9 @@
 #include "gtest/gtest.h"
 #include "storm-config.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "storm/parser/FormulaParser.h"
 #include "storm/logic/Formulas.h"
 #include "storm/solver/NativeLinearEquationSolver.h"
@@ -14,9 +17,12 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/GmmxxEquationSolverSettings.h"
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
+#include "storm/utility/dd.h"
+#include "storm/utility/graph.h"
 
 TEST(NativeHybridDtmcPrctlModelCheckerTest, Die_Cudd) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -337,3 +343,103 @@ TEST(NativeHybridDtmcPrctlModelCheckerTest, SynchronousLeader_Sylvan) {
     EXPECT_NEAR(1.0416666666666643, quantitativeResult3.getMin(), storm::settings::getModule<storm::settings::modules::GmmxxEquationSolverSettings>().getPrecision());
     EXPECT_NEAR(1.0416666666666643, quantitativeResult3.getMax(), storm::settings::getModule<storm::settings::modules::GmmxxEquationSolverSettings>().getPrecision());
 }
+
+namespace {
+    /*!
+     * Retrieves a memory budget (in bytes) that is exceeded by the largest but not by the smallest block into which
+     * the given equation system is decomposed, so that it is solved partly explicitly and partly symbolically.
+     */
+    uint64_t getMixedBudget(storm::models::symbolic::Model<storm::dd::DdType::CUDD, double> const& model, storm::dd::Add<storm::dd::DdType::CUDD, double> const& submatrix, storm::dd::Bdd<storm::dd::DdType::CUDD> const& maybeStates) {
+        uint64_t minimalSize = std::numeric_limits<uint64_t>::max();
+        uint64_t maximalSize = 0;
+        for (auto const& block : storm::utility::dd::computeTopologicalSccBlocks(maybeStates, submatrix.notZero(), model.getRowVariables(), model.getColumnVariables())) {
+            storm::dd::Add<storm::dd::DdType::CUDD, double> blockAdd = block.toAdd<double>();
+            uint64_t size = storm::utility::dd::estimateExplicitMatrixSize(submatrix * blockAdd * blockAdd.swapVariables(model.getRowColumnMetaVariablePairs()), model.getColumnVariables());
+            minimalSize = std::min(minimalSize, size);
+            maximalSize = std::max(maximalSize, size);
+        }
+        EXPECT_LT(minimalSize, maximalSize);
+        return maximalSize - 1;
+    }
+    
+    /*!
+     * Removes the memory budget of the hybrid engine when going out of scope.
+     */
+    struct HybridMemoryBudgetGuard {
+        ~HybridMemoryBudgetGuard() {
+            storm::settings::mutableCoreSettings().setHybridMemoryBudget(boost::none);
+        }
+    };
+}
+
+TEST(NativeHybridDtmcPrctlModelCheckerTest, Die_Budget_Cudd) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+
+    // Build the die model with its reward model.
+#ifdef WINDOWS
+    storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>::Options options;
+#else
+    typename storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>::Options options;
+#endif
+    options.buildAllRewardModels = false;
+    options.rewardModelsToBuild.insert("coin_flips");
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program, options);
+    ASSERT_EQ(model->getType(), storm::models::ModelType::Dtmc);
+    std::shared_ptr<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD>> dtmc = model->as<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD>>();
+    double precision = storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision();
+    
+    std::shared_ptr<storm::logic::Formula const> probabilityFormula = formulaParser.parseSingleFormulaFromString("P=? [F \"one\"]");
+    std::shared_ptr<storm::logic::Formula const> rewardFormula = formulaParser.parseSingleFormulaFromString("R=? [F \"done\"]");
+    storm::modelchecker::SymbolicQualitativeCheckResult<storm::dd::DdType::CUDD> initialStatesFilter(model->getReachableStates(), model->getInitialStates());
+    
+    // Compute the reference values without a memory budget.
+    storm::modelchecker::HybridDtmcPrctlModelChecker<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>> checker(*dtmc, std::make_unique<storm::solver::NativeLinearEquationSolverFactory<double>>());
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(*probabilityFormula);
+    result->filter(initialStatesFilter);
+    double probability = result->asQuantitativeCheckResult<double>().getMin();
+    EXPECT_NEAR(1.0/6.0, probability, precision);
+    
+    result = checker.check(*rewardFormula);
+    result->filter(initialStatesFilter);
+    double reward = result->asQuantitativeCheckResult<double>().getMin();
+    EXPECT_NEAR(3.6666646003723145, reward, precision);
+    
+    // A budget of zero bytes solves all blocks symbolically.
+    HybridMemoryBudgetGuard budgetGuard;
+    storm::settings::mutableCoreSettings().setHybridMemoryBudget(0);
+    result = checker.check(*probabilityFormula);
+    result->filter(initialStatesFilter);
+    EXPECT_NEAR(probability, result->asQuantitativeCheckResult<double>().getMin(), precision);
+    
+    result = checker.check(*rewardFormula);
+    result->filter(initialStatesFilter);
+    EXPECT_NEAR(reward, result->asQuantitativeCheckResult<double>().getMin(), precision);
+    
+    // Set up the equation system for the probabilities as the helper does to find a budget for which it solves some
+    // blocks explicitly and some symbolically.
+    std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, storm::dd::Bdd<storm::dd::DdType::CUDD>> statesWithProbability01 = storm::utility::graph::performProb01(*model, dtmc->getTransitionMatrix(), model->getReachableStates(), model->getStates("one"));
+    storm::dd::Bdd<storm::dd::DdType::CUDD> maybeStates = !statesWithProbability01.first && !statesWithProbability01.second && model->getReachableStates();
+    storm::dd::Add<storm::dd::DdType::CUDD, double> maybeStatesAdd = maybeStates.toAdd<double>();
+    storm::dd::Add<storm::dd::DdType::CUDD, double> submatrix = dtmc->getTransitionMatrix() * maybeStatesAdd * maybeStatesAdd.swapVariables(model->getRowColumnMetaVariablePairs());
+    
+    storm::settings::mutableCoreSettings().setHybridMemoryBudget(getMixedBudget(*model, submatrix, maybeStates), 1);
+    result = checker.check(*probabilityFormula);
+    result->filter(initialStatesFilter);
+    EXPECT_NEAR(probability, result->asQuantitativeCheckResult<double>().getMin(), precision);
+    
+    // Do the same for the equation system of the rewards.
+    storm::dd::Bdd<storm::dd::DdType::CUDD> targetStates = model->getStates("done");
+    storm::dd::Bdd<storm::dd::DdType::CUDD> infinityStates = !storm::utility::graph::performProb1(*model, dtmc->getTransitionMatrix().notZero(), model->getReachableStates(), targetStates) && model->getReachableStates();
+    maybeStates = !targetStates && !infinityStates && model->getReachableStates();
+    maybeStatesAdd = maybeStates.toAdd<double>();
+    submatrix = dtmc->getTransitionMatrix() * maybeStatesAdd * maybeStatesAdd.swapVariables(model->getRowColumnMetaVariablePairs());
+    
+    storm::settings::mutableCoreSettings().setHybridMemoryBudget(getMixedBudget(*model, submatrix, maybeStates), 1);
+    result = checker.check(*rewardFormula);
+    result->filter(initialStatesFilter);
+    EXPECT_NEAR(reward, result->asQuantitativeCheckResult<double>().getMin(), precision);
+}
@@ -8,6 +8,7 @@
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/settings/SettingsManager.h"
 
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/parser/AutoParser.h"
@@ -135,3 +136,42 @@ TEST(SparseDtmcEliminationModelCheckerTest, SynchronousLeader) {
 
     EXPECT_NEAR(1.0448979, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
+
+#ifdef STORM_HAVE_INTELTBB
+TEST(SparseDtmcEliminationModelCheckerTest, ParallelElimination) {
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+    
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> crowds = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "")->as<storm::models::sparse::Dtmc<double>>();
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> leader = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/leader4_8.tra", STORM_TEST_RESOURCES_DIR "/lab/leader4_8.lab", "", STORM_TEST_RESOURCES_DIR "/rew/leader4_8.pick.trans.rew")->as<storm::models::sparse::Dtmc<double>>();
+    std::vector<std::pair<std::shared_ptr<storm::models::sparse::Dtmc<double>>, std::shared_ptr<storm::logic::Formula const>>> inputs = {
+        {crowds, formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]")},
+        {leader, formulaParser.parseSingleFormulaFromString("P=? [F \"elected\"]")},
+        {leader, formulaParser.parseSingleFormulaFromString("R=? [F \"elected\"]")}
+    };
+    
+    for (auto const& input : inputs) {
+        // Eliminate the states one after another (which reuses the row buffers) and in batches of independent states.
+        std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult;
+        {
+            std::unique_ptr<storm::settings::SettingMemento> intelTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+            storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<double>> sequentialChecker(*input.first);
+            sequentialResult = sequentialChecker.check(*input.second);
+        }
+        
+        std::unique_ptr<storm::modelchecker::CheckResult> parallelResult;
+        {
+            std::unique_ptr<storm::settings::SettingMemento> intelTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+            storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<double>> parallelChecker(*input.first);
+            parallelResult = parallelChecker.check(*input.second);
+        }
+        
+        std::vector<double> const& sequentialValues = sequentialResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        std::vector<double> const& parallelValues = parallelResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        ASSERT_EQ(sequentialValues.size(), parallelValues.size());
+        for (uint64_t state = 0; state < sequentialValues.size(); ++state) {
+            EXPECT_NEAR(sequentialValues[state], parallelValues[state], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+        }
+    }
+}
+#endif
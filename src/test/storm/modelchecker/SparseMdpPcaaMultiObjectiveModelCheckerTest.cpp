@@ -6,9 +6,14 @@
 #include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
 #include "storm/models/sparse/Mdp.h"
+#include "storm/storage/geometry/Polytope.h"
+#include "storm/storage/geometry/Hyperrectangle.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/api/storm.h"
 
 
@@ -40,6 +45,50 @@ TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, consensus) {
     
 }
 
+TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, consensusParetoBatched) {
+    
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/multiobj_consensus2_3_2.nm";
+    std::string formulasAsString = "multi(Pmax=? [ F \"one_proc_err\" ], Pmax=? [ G \"one_coin_ok\" ]) "; // pareto
+    
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    
+    // One weight vector per refinement step.
+    std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult;
+    {
+        std::unique_ptr<storm::settings::SettingMemento> tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+        sequentialResult = storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(*mdp, formulas[0]->asMultiObjectiveFormula(), storm::modelchecker::multiobjective::MultiObjectiveMethodSelection::Pcaa);
+    }
+    ASSERT_TRUE(sequentialResult->isExplicitParetoCurveCheckResult());
+    
+    // A batch of weight vectors per refinement step (if TBB is available).
+    std::unique_ptr<storm::modelchecker::CheckResult> batchedResult;
+    {
+        std::unique_ptr<storm::settings::SettingMemento> tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        batchedResult = storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(*mdp, formulas[0]->asMultiObjectiveFormula(), storm::modelchecker::multiobjective::MultiObjectiveMethodSelection::Pcaa);
+    }
+    ASSERT_TRUE(batchedResult->isExplicitParetoCurveCheckResult());
+    
+    // we do our checks with rationals to avoid numerical issues when doing polytope computations...
+    auto sequentialUnder = sequentialResult->asExplicitParetoCurveCheckResult<double>().getUnderApproximation()->convertNumberRepresentation<storm::RationalNumber>();
+    auto sequentialOver = sequentialResult->asExplicitParetoCurveCheckResult<double>().getOverApproximation()->convertNumberRepresentation<storm::RationalNumber>();
+    auto batchedUnder = batchedResult->asExplicitParetoCurveCheckResult<double>().getUnderApproximation()->convertNumberRepresentation<storm::RationalNumber>();
+    auto batchedOver = batchedResult->asExplicitParetoCurveCheckResult<double>().getOverApproximation()->convertNumberRepresentation<storm::RationalNumber>();
+    
+    // due to precision issues, we enlarge the over-approximations before checking containement
+    storm::RationalNumber eps = storm::utility::convertNumber<storm::RationalNumber>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    std::vector<storm::RationalNumber> lb(2,-eps), ub(2,eps);
+    auto bloatingBox = storm::storage::geometry::Hyperrectangle<storm::RationalNumber>(lb,ub).asPolytope();
+    
+    // Both runs approximate the same Pareto curve, so the points found by one run are not beyond the curve bounded by the other.
+    EXPECT_TRUE(sequentialOver->minkowskiSum(bloatingBox)->contains(batchedUnder));
+    EXPECT_TRUE(batchedOver->minkowskiSum(bloatingBox)->contains(sequentialUnder));
+    
+}
+
 TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, zeroconf) {
     
     std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/multiobj_zeroconf4.nm";
@@ -0,0 +1,47 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "storm/parser/JaniParser.h"
+#include "storm/storage/expressions/BaseExpression.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/jani/Variable.h"
+#include "storm/exceptions/InvalidJaniException.h"
+
+namespace {
+    // Exposes the expression parsing of the JANI parser.
+    class JaniExpressionParser : public storm::parser::JaniParser {
+    public:
+        storm::expressions::Expression parse(std::string const& expressionString) {
+            return parseExpression(json::parse(expressionString), "test", std::unordered_map<std::string, std::shared_ptr<storm::jani::Variable>>(), std::unordered_map<std::string, std::shared_ptr<storm::jani::Constant>>());
+        }
+    };
+}
+
+TEST(JaniParser, SharedSubexpressionTest) {
+    JaniExpressionParser parser;
+
+    storm::expressions::Expression product;
+    ASSERT_NO_THROW(product = parser.parse(R"({"op": "*", "left": {"op": "+", "left": 1, "right": 2}, "right": {"op": "+", "left": 1, "right": 2}})"));
+    ASSERT_TRUE(product.isFunctionApplication());
+    EXPECT_EQ(product.getBaseExpression().getOperand(0).get(), product.getBaseExpression().getOperand(1).get());
+
+    // Subexpressions are also shared across different expressions.
+    storm::expressions::Expression sum;
+    ASSERT_NO_THROW(sum = parser.parse(R"({"op": "-", "left": 3, "right": {"op": "+", "left": 1, "right": 2}})"));
+    EXPECT_EQ(product.getBaseExpression().getOperand(0).get(), sum.getBaseExpression().getOperand(1).get());
+    EXPECT_NE(sum.getBaseExpression().getOperand(0).get(), sum.getBaseExpression().getOperand(1).get());
+}
+
+TEST(JaniParser, NestedErrorTest) {
+    JaniExpressionParser parser;
+
+    std::string message;
+    try {
+        parser.parse(R"({"op": "+", "left": 1, "right": {"op": "ite", "if": true, "then": 2, "else": {"op": "*", "left": "unknown", "right": 3}}})");
+    } catch (storm::exceptions::InvalidJaniException const& e) {
+        message = e.what();
+    }
+    EXPECT_NE(std::string::npos, message.find("Unknown identifier 'unknown'"));
+    EXPECT_NE(std::string::npos, message.find("left argument of operator *"));
+    EXPECT_NE(std::string::npos, message.find("else-formula of operator ite"));
+    EXPECT_NE(std::string::npos, message.find("right argument of operator +"));
+}
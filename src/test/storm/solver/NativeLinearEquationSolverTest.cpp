@@ -34,6 +34,108 @@ TEST(NativeLinearEquationSolver, SolveWithStandardOptions) {
     ASSERT_LT(std::abs(x[2] - (-1)), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
 }
 
+TEST(NativeLinearEquationSolver, SolveMultipleWithStandardOptions) {
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 4));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, -1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, -5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, -1));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 4));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    // The values of the two systems are interleaved.
+    std::vector<double> x(6);
+    std::vector<double> b = {11, 10, -16, -3, 1, 0};
+    
+    storm::solver::NativeLinearEquationSolver<double> solver(A);
+    ASSERT_NO_THROW(solver.solveEquationsMultiple(x, b, 2));
+    double precision = storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision();
+    ASSERT_LT(std::abs(x[0] - 1), precision);
+    ASSERT_LT(std::abs(x[1] - 2), precision);
+    ASSERT_LT(std::abs(x[2] - 3), precision);
+    ASSERT_LT(std::abs(x[3] - 1), precision);
+    ASSERT_LT(std::abs(x[4] - (-1)), precision);
+    ASSERT_LT(std::abs(x[5] - 0), precision);
+}
+
+TEST(NativeLinearEquationSolver, SolveMultipleWithJacobi) {
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 4));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, -1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, -5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, -1));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 4));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    std::vector<double> x(6);
+    std::vector<double> b = {11, 10, -16, -3, 1, 0};
+    
+    storm::solver::NativeLinearEquationSolverSettings<double> settings;
+    settings.setSolutionMethod(storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::Jacobi);
+    storm::solver::NativeLinearEquationSolver<double> solver(A, settings);
+    ASSERT_NO_THROW(solver.solveEquationsMultiple(x, b, 2));
+    double precision = storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision();
+    ASSERT_LT(std::abs(x[0] - 1), precision);
+    ASSERT_LT(std::abs(x[1] - 2), precision);
+    ASSERT_LT(std::abs(x[2] - 3), precision);
+    ASSERT_LT(std::abs(x[3] - 1), precision);
+    ASSERT_LT(std::abs(x[4] - (-1)), precision);
+    ASSERT_LT(std::abs(x[5] - 0), precision);
+}
+
+TEST(NativeLinearEquationSolver, SolveMultipleWithSystemSpecificValues) {
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 4));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, -1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, -5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, -1));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 4));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    // The matrix of the second system is twice the matrix of the first one.
+    std::vector<double> matrixValues;
+    for (auto const& entry : A) {
+        matrixValues.push_back(entry.getValue());
+        matrixValues.push_back(2 * entry.getValue());
+    }
+    std::vector<double> b = {11, 20, -16, -6, 1, 0};
+    double precision = storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision();
+    
+    for (auto method : {storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::Jacobi, storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::GaussSeidel}) {
+        storm::solver::NativeLinearEquationSolverSettings<double> settings;
+        settings.setSolutionMethod(method);
+        storm::solver::NativeLinearEquationSolver<double> solver(A, settings);
+        ASSERT_TRUE(solver.supportsSystemSpecificMatrixValues());
+        
+        std::vector<double> x(6);
+        ASSERT_NO_THROW(solver.solveEquationsMultiple(x, b, 2, matrixValues));
+        ASSERT_LT(std::abs(x[0] - 1), precision);
+        ASSERT_LT(std::abs(x[1] - 2), precision);
+        ASSERT_LT(std::abs(x[2] - 3), precision);
+        ASSERT_LT(std::abs(x[3] - 1), precision);
+        ASSERT_LT(std::abs(x[4] - (-1)), precision);
+        ASSERT_LT(std::abs(x[5] - 0), precision);
+    }
+}
+
 TEST(NativeLinearEquationSolver, MatrixVectorMultiplication) {
     ASSERT_NO_THROW(storm::storage::SparseMatrixBuilder<double> builder);
     storm::storage::SparseMatrixBuilder<double> builder;
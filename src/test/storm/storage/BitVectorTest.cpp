@@ -201,6 +201,50 @@ TEST(BitVectorTest, Resize) {
     ASSERT_TRUE(vector.full());
 }
 
+TEST(BitVectorTest, CopyAssignment) {
+    storm::storage::BitVector vector1(100);
+    for (uint_fast64_t i = 0; i < 100; ++i) {
+        vector1.set(i, i % 3 == 0);
+    }
+    
+    // Same size, so the storage of the target is reused.
+    storm::storage::BitVector vector2(100, true);
+    vector2 = vector1;
+    ASSERT_EQ(100ul, vector2.size());
+    ASSERT_TRUE(vector1 == vector2);
+    
+    // The copy does not share its storage with the original.
+    vector2.set(1);
+    ASSERT_FALSE(vector1.get(1));
+    
+    // Same number of buckets, but a different size.
+    storm::storage::BitVector vector3(70, true);
+    vector3 = vector1;
+    ASSERT_EQ(100ul, vector3.size());
+    ASSERT_TRUE(vector1 == vector3);
+    
+    // Different number of buckets.
+    storm::storage::BitVector vector4(10);
+    vector4 = vector1;
+    ASSERT_EQ(100ul, vector4.size());
+    ASSERT_TRUE(vector1 == vector4);
+    
+    storm::storage::BitVector vector5(200, true);
+    vector5 = vector1;
+    ASSERT_EQ(100ul, vector5.size());
+    ASSERT_TRUE(vector1 == vector5);
+    
+    // No storage yet.
+    storm::storage::BitVector vector6;
+    vector6 = vector1;
+    ASSERT_EQ(100ul, vector6.size());
+    ASSERT_TRUE(vector1 == vector6);
+    
+    storm::storage::BitVector const& original = vector1;
+    vector1 = original;
+    ASSERT_EQ(34ul, vector1.getNumberOfSetBits());
+}
+
 TEST(BitVectorTest, OperatorAnd) {
 	storm::storage::BitVector vector1(32);
 	storm::storage::BitVector vector2(32);
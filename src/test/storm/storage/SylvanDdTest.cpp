@@ -3,16 +3,19 @@
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Odd.h"
 #include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/storage/SparseMatrix.h"
 
 #include <memory>
 #include <iostream>
+#include <sstream>
 
 TEST(SylvanDd, Constants) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
@@ -954,3 +957,57 @@ TEST(SylvanDd, BddToExpressionTest) {
     
     auto result = bdd.toExpression(*manager);
 }
+
+TEST(SylvanDd, TableSizes) {
+    typedef storm::dd::InternalDdManager<storm::dd::DdType::Sylvan> SylvanManager;
+    uint64_t const megabyte = 1024 * 1024;
+    
+    // With the default of 4096MB, both tables have the same size as before the cache was accounted for correctly.
+    SylvanManager::TableSizes sizes = SylvanManager::computeTableSizes(4096 * megabyte, 0);
+    EXPECT_EQ(1ull << 26, sizes.maxTableSize);
+    EXPECT_EQ(1ull << 26, sizes.maxCacheSize);
+    EXPECT_EQ(1ull << 22, sizes.initialTableSize);
+    EXPECT_EQ(1ull << 22, sizes.initialCacheSize);
+    
+    sizes = SylvanManager::computeTableSizes(4096 * megabyte, 1);
+    EXPECT_EQ(1ull << 26, sizes.maxTableSize);
+    EXPECT_EQ(1ull << 25, sizes.maxCacheSize);
+    EXPECT_EQ(1ull << 22, sizes.initialTableSize);
+    EXPECT_EQ(1ull << 21, sizes.initialCacheSize);
+    
+    sizes = SylvanManager::computeTableSizes(4096 * megabyte, -1);
+    EXPECT_EQ(1ull << 25, sizes.maxTableSize);
+    EXPECT_EQ(1ull << 26, sizes.maxCacheSize);
+    EXPECT_EQ(1ull << 21, sizes.initialTableSize);
+    EXPECT_EQ(1ull << 22, sizes.initialCacheSize);
+    
+    // The tables always fit into the memory, but doubling the node table (and the cache with it) does not.
+    for (uint64_t memory : {32ull, 100ull, 1000ull, 4096ull, 10000ull}) {
+        for (int64_t ratio = -3; ratio <= 3; ++ratio) {
+            sizes = SylvanManager::computeTableSizes(memory * megabyte, ratio);
+            EXPECT_LE(sizes.maxTableSize * 24 + sizes.maxCacheSize * 36, memory * megabyte);
+            EXPECT_GT(sizes.maxTableSize * 48 + sizes.maxCacheSize * 72, memory * megabyte);
+            EXPECT_LE(sizes.initialTableSize, sizes.maxTableSize);
+            EXPECT_LE(sizes.initialCacheSize, sizes.maxCacheSize);
+        }
+    }
+    
+    // Sylvan needs at least 2^16 nodes.
+    EXPECT_THROW(SylvanManager::computeTableSizes(megabyte, 0), storm::exceptions::InvalidSettingsException);
+}
+
+TEST(SylvanDd, PrintStatistics) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> dd = manager->template getIdentity<double>(x.first);
+    EXPECT_EQ(9ul, dd.getNonZeroCount());
+    
+    std::stringstream stream;
+    storm::dd::InternalDdManager<storm::dd::DdType::Sylvan>::printStatistics(stream);
+    std::string statistics = stream.str();
+    EXPECT_NE(std::string::npos, statistics.find("Sylvan garbage collections: "));
+    EXPECT_NE(std::string::npos, statistics.find("Sylvan nodes: "));
+    
+    // Some nodes are live, because the manager and the DD still exist.
+    EXPECT_EQ(std::string::npos, statistics.find("Sylvan nodes: 0 live"));
+}
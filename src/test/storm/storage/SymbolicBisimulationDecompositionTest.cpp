@@ -78,6 +78,39 @@ TEST(SymbolicModelBisimulationDecomposition, Crowds_Cudd) {
     EXPECT_TRUE(quotient->isSymbolicModel());
 }
 
+TEST(SymbolicModelBisimulationDecomposition, Crowds_Sylvan_RepeatedInitialization) {
+    storm::storage::SymbolicModelDescription smd = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds5_5.pm");
+    
+    // Preprocess model to substitute all constants.
+    smd = smd.preprocess();
+    
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]"));
+    
+    // Sylvan is shut down when the last manager is destroyed, which drops all garbage collection marks. Therefore,
+    // the refinement must also be correct after Sylvan was initialized again.
+    for (uint_fast64_t run = 0; run < 2; ++run) {
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan, double>().build(smd.asPrismProgram());
+        
+        storm::dd::BisimulationDecomposition<storm::dd::DdType::Sylvan, double> decomposition(*model, storm::storage::BisimulationType::Strong);
+        decomposition.compute();
+        std::shared_ptr<storm::models::Model<double>> quotient = decomposition.getQuotient();
+        
+        EXPECT_EQ(2007ul, quotient->getNumberOfStates());
+        EXPECT_EQ(3738ul, quotient->getNumberOfTransitions());
+        EXPECT_EQ(storm::models::ModelType::Dtmc, quotient->getType());
+        EXPECT_TRUE(quotient->isSymbolicModel());
+        
+        storm::dd::BisimulationDecomposition<storm::dd::DdType::Sylvan, double> decomposition2(*model, formulas, storm::storage::BisimulationType::Strong);
+        decomposition2.compute();
+        quotient = decomposition2.getQuotient();
+        
+        EXPECT_EQ(65ul, quotient->getNumberOfStates());
+        EXPECT_EQ(105ul, quotient->getNumberOfTransitions());
+    }
+}
+
 TEST(SymbolicModelBisimulationDecomposition, TwoDice_Cudd) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
 
@@ -0,0 +1,157 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/storm.h"
+#include "storm/parser/FormulaParser.h"
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/NondeterministicModel.h"
+#include "storm/models/symbolic/Model.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/GeneralSettings.h"
+#include "storm/utility/engine.h"
+
+namespace {
+    storm::utility::engine::ModelStatistics createStatistics(storm::models::ModelType const& modelType, uint64_t numberOfStates, uint64_t numberOfTransitions) {
+        storm::utility::engine::ModelStatistics statistics;
+        statistics.modelType = modelType;
+        statistics.exact = false;
+        statistics.numberOfStates = numberOfStates;
+        statistics.numberOfChoices = numberOfStates;
+        statistics.numberOfTransitions = numberOfTransitions;
+        statistics.numberOfTransitionMatrixNodes = 1000;
+        statistics.estimatedExplicitMatrixSize = numberOfTransitions * 16 + numberOfStates * 24;
+        return statistics;
+    }
+    
+    /*!
+     * Mirrors the automatic engine selection of the command line interface: the model is probed symbolically, an
+     * engine is selected from the statistics of the probe and the formula is checked with it. The memory budget is
+     * chosen such that the given engine is expected to be selected. The statistics are compared to the explicit model
+     * and the value of the initial state is returned.
+     */
+    double checkWithSelectedEngine(std::string const& filename, std::string const& formulaString, storm::settings::modules::CoreSettings::Engine const& expectedEngine) {
+        storm::prism::Program program = storm::api::parseProgram(filename);
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaString, program));
+        
+        // Build the full models, so that the statistics can be compared to the explicit model.
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> symbolicModel = storm::api::buildSymbolicModel<storm::dd::DdType::CUDD, double>(program, {}, true);
+        storm::utility::engine::ModelStatistics statistics = storm::utility::engine::getModelStatistics(*symbolicModel);
+        
+        std::shared_ptr<storm::models::sparse::Model<double>> sparseModel = storm::api::buildSparseModel<double>(program, storm::builder::BuilderOptions(true, true));
+        EXPECT_EQ(sparseModel->getType(), statistics.modelType);
+        EXPECT_FALSE(statistics.exact);
+        EXPECT_EQ(sparseModel->getNumberOfStates(), statistics.numberOfStates);
+        EXPECT_EQ(sparseModel->getNumberOfTransitions(), statistics.numberOfTransitions);
+        if (sparseModel->isNondeterministicModel()) {
+            EXPECT_EQ(sparseModel->as<storm::models::sparse::NondeterministicModel<double>>()->getNumberOfChoices(), statistics.numberOfChoices);
+        } else {
+            EXPECT_EQ(statistics.numberOfStates, statistics.numberOfChoices);
+        }
+        EXPECT_LT(0ull, statistics.numberOfTransitionMatrixNodes);
+        EXPECT_LT(0ull, statistics.estimatedExplicitMatrixSize);
+        
+        uint64_t memoryBudget = 0;
+        if (expectedEngine == storm::settings::modules::CoreSettings::Engine::Hybrid) {
+            // Choose a budget that suffices for the hybrid but not for the sparse engine.
+            uint64_t hybridMemory = storm::utility::engine::estimateHybridEngineMemory(statistics);
+            uint64_t sparseMemory = storm::utility::engine::estimateSparseEngineMemory(statistics);
+            EXPECT_LT(hybridMemory, sparseMemory);
+            memoryBudget = (hybridMemory + sparseMemory) / 2;
+        } else if (expectedEngine == storm::settings::modules::CoreSettings::Engine::Dd) {
+            memoryBudget = 1;
+        }
+        
+        storm::utility::engine::EngineSelection selection = storm::utility::engine::selectEngine(statistics, formulas, memoryBudget, 0);
+        EXPECT_EQ(expectedEngine, selection.engine);
+        
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+        auto task = storm::api::createTask<double>(formulas.front(), true);
+        if (selection.engine == storm::settings::modules::CoreSettings::Engine::Sparse) {
+            result = storm::api::verifyWithSparseEngine<double>(sparseModel, task);
+            result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(sparseModel->getInitialStates()));
+        } else {
+            if (selection.engine == storm::settings::modules::CoreSettings::Engine::Hybrid) {
+                result = storm::api::verifyWithHybridEngine<storm::dd::DdType::CUDD, double>(symbolicModel, task);
+            } else {
+                result = storm::api::verifyWithDdEngine<storm::dd::DdType::CUDD, double>(symbolicModel, task);
+            }
+            result->filter(storm::modelchecker::SymbolicQualitativeCheckResult<storm::dd::DdType::CUDD>(symbolicModel->getReachableStates(), symbolicModel->getInitialStates()));
+        }
+        return result->asQuantitativeCheckResult<double>().getMin();
+    }
+}
+
+TEST(EngineSelectionTest, Dtmc) {
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = {formulaParser.parseSingleFormulaFromString("P=? [F \"target\"]")};
+
+    // Small models are checked with the sparse engine.
+    storm::utility::engine::ModelStatistics statistics = createStatistics(storm::models::ModelType::Dtmc, 1000, 5000);
+    storm::utility::engine::EngineSelection selection = storm::utility::engine::selectEngine(statistics, formulas, 0, 0);
+    EXPECT_EQ(storm::settings::modules::CoreSettings::Engine::Sparse, selection.engine);
+    EXPECT_FALSE(static_cast<bool>(selection.minMaxMethod));
+
+    // If only the explicit transition matrix fits into memory, the hybrid engine is used.
+    statistics = createStatistics(storm::models::ModelType::Dtmc, 10000000, 50000000);
+    EXPECT_LT(storm::utility::engine::estimateHybridEngineMemory(statistics), storm::utility::engine::estimateSparseEngineMemory(statistics));
+    selection = storm::utility::engine::selectEngine(statistics, formulas, 1500000000ull, 0);
+    EXPECT_EQ(storm::settings::modules::CoreSettings::Engine::Hybrid, selection.engine);
+
+    // If not even the matrix fits, the dd engine is used.
+    selection = storm::utility::engine::selectEngine(statistics, formulas, 1000000000ull, 0);
+    EXPECT_EQ(storm::settings::modules::CoreSettings::Engine::Dd, selection.engine);
+
+    // Large models that cannot be built explicitly within the time budget are checked symbolically.
+    selection = storm::utility::engine::selectEngine(statistics, formulas, 0, 10);
+    EXPECT_EQ(storm::settings::modules::CoreSettings::Engine::Hybrid, selection.engine);
+    selection = storm::utility::engine::selectEngine(statistics, formulas, 0, 3600);
+    EXPECT_EQ(storm::settings::modules::CoreSettings::Engine::Sparse, selection.engine);
+}
+
+TEST(EngineSelectionTest, Mdp) {
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = {formulaParser.parseSingleFormulaFromString("Pmax=? [F \"target\"]")};
+
+    // Small MDPs are solved with policy iteration.
+    storm::utility::engine::ModelStatistics statistics = createStatistics(storm::models::ModelType::Mdp, 1000, 5000);
+    storm::utility::engine::EngineSelection selection = storm::utility::engine::selectEngine(statistics, formulas, 0, 0);
+    EXPECT_EQ(storm::settings::modules::CoreSettings::Engine::Sparse, selection.engine);
+    ASSERT_TRUE(static_cast<bool>(selection.minMaxMethod));
+    EXPECT_EQ(storm::solver::MinMaxMethod::PolicyIteration, selection.minMaxMethod.get());
+
+    statistics = createStatistics(storm::models::ModelType::Mdp, 10000000, 50000000);
+    selection = storm::utility::engine::selectEngine(statistics, formulas, 1000000000ull, 0);
+    EXPECT_EQ(storm::settings::modules::CoreSettings::Engine::Dd, selection.engine);
+    EXPECT_FALSE(static_cast<bool>(selection.minMaxMethod));
+
+    // Long-run average rewards on MDPs are only supported by the sparse engine.
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Rmax=? [LRA]"));
+    selection = storm::utility::engine::selectEngine(statistics, formulas, 1000000000ull, 0);
+    EXPECT_EQ(storm::settings::modules::CoreSettings::Engine::Sparse, selection.engine);
+}
+
+TEST(EngineSelectionTest, MarkovAutomaton) {
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = {formulaParser.parseSingleFormulaFromString("Pmax=? [F \"target\"]")};
+
+    // Markov automata are only supported by the sparse engine.
+    storm::utility::engine::ModelStatistics statistics = createStatistics(storm::models::ModelType::MarkovAutomaton, 10000000, 50000000);
+    storm::utility::engine::EngineSelection selection = storm::utility::engine::selectEngine(statistics, formulas, 1000000000ull, 0);
+    EXPECT_EQ(storm::settings::modules::CoreSettings::Engine::Sparse, selection.engine);
+}
+
+TEST(EngineSelectionTest, EndToEnd) {
+    double precision = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision();
+    std::string dtmcFile = STORM_TEST_RESOURCES_DIR "/dtmc/die.pm";
+    std::string mdpFile = STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm";
+    
+    // Without limits, the small models are checked with the sparse engine. Tighter budgets move them to the hybrid
+    // and dd engines, which yield the same results.
+    for (auto engine : {storm::settings::modules::CoreSettings::Engine::Sparse, storm::settings::modules::CoreSettings::Engine::Hybrid, storm::settings::modules::CoreSettings::Engine::Dd}) {
+        EXPECT_NEAR(1.0 / 6.0, checkWithSelectedEngine(dtmcFile, "P=? [F \"one\"]", engine), precision);
+        EXPECT_NEAR(1.0 / 36.0, checkWithSelectedEngine(mdpFile, "Pmin=? [F \"two\"]", engine), precision);
+    }
+}
@@ -15,6 +15,9 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 TEST(GraphTest, SymbolicProb01_Cudd) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
@@ -668,3 +671,78 @@ TEST(GraphTest, ExplicitProb01MinMax) {
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
 }
+
+namespace {
+    // Computes the states with probability 0 and 1 (minimal and maximal) with and without the worklist and checks
+    // that both yield the same states.
+    void checkProb01MinMaxWorklist(storm::models::sparse::Mdp<double> const& mdp, std::string const& label, std::pair<storm::storage::BitVector, storm::storage::BitVector>& min, std::pair<storm::storage::BitVector, storm::storage::BitVector>& max) {
+        storm::storage::BitVector phiStates(mdp.getNumberOfStates(), true);
+        storm::storage::BitVector psiStates = mdp.getStates(label);
+        
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> fixpointMin;
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> fixpointMax;
+        {
+            std::unique_ptr<storm::settings::SettingMemento> worklistMemento = storm::settings::mutableCoreSettings().overrideProb01WorklistSet(false);
+            fixpointMin = storm::utility::graph::performProb01Min(mdp, phiStates, psiStates);
+            fixpointMax = storm::utility::graph::performProb01Max(mdp, phiStates, psiStates);
+        }
+        
+        {
+            std::unique_ptr<storm::settings::SettingMemento> worklistMemento = storm::settings::mutableCoreSettings().overrideProb01WorklistSet(true);
+            min = storm::utility::graph::performProb01Min(mdp, phiStates, psiStates);
+            max = storm::utility::graph::performProb01Max(mdp, phiStates, psiStates);
+        }
+        
+        EXPECT_EQ(fixpointMin.first, min.first);
+        EXPECT_EQ(fixpointMin.second, min.second);
+        EXPECT_EQ(fixpointMax.first, max.first);
+        EXPECT_EQ(fixpointMax.second, max.second);
+    }
+}
+
+TEST(GraphTest, ExplicitProb01MinMaxWorklist) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01Min;
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01Max;
+    
+    checkProb01MinMaxWorklist(*model->as<storm::models::sparse::Mdp<double>>(), "elected", statesWithProbability01Min, statesWithProbability01Max);
+    EXPECT_EQ(0ull, statesWithProbability01Min.first.getNumberOfSetBits());
+    EXPECT_EQ(364ull, statesWithProbability01Min.second.getNumberOfSetBits());
+    EXPECT_EQ(0ull, statesWithProbability01Max.first.getNumberOfSetBits());
+    EXPECT_EQ(364ull, statesWithProbability01Max.second.getNumberOfSetBits());
+    
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    program = modelDescription.preprocess().asPrismProgram();
+    model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    
+    checkProb01MinMaxWorklist(*model->as<storm::models::sparse::Mdp<double>>(), "all_coins_equal_0", statesWithProbability01Min, statesWithProbability01Max);
+    EXPECT_EQ(77ull, statesWithProbability01Min.first.getNumberOfSetBits());
+    EXPECT_EQ(149ull, statesWithProbability01Min.second.getNumberOfSetBits());
+    EXPECT_EQ(74ull, statesWithProbability01Max.first.getNumberOfSetBits());
+    EXPECT_EQ(198ull, statesWithProbability01Max.second.getNumberOfSetBits());
+    
+    checkProb01MinMaxWorklist(*model->as<storm::models::sparse::Mdp<double>>(), "all_coins_equal_1", statesWithProbability01Min, statesWithProbability01Max);
+    EXPECT_EQ(94ull, statesWithProbability01Min.first.getNumberOfSetBits());
+    EXPECT_EQ(33ull, statesWithProbability01Min.second.getNumberOfSetBits());
+    EXPECT_EQ(83ull, statesWithProbability01Max.first.getNumberOfSetBits());
+    EXPECT_EQ(35ull, statesWithProbability01Max.second.getNumberOfSetBits());
+    
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm");
+    program = modelDescription.preprocess().asPrismProgram();
+    model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    
+    checkProb01MinMaxWorklist(*model->as<storm::models::sparse::Mdp<double>>(), "collision_max_backoff", statesWithProbability01Min, statesWithProbability01Max);
+    EXPECT_EQ(993ull, statesWithProbability01Min.first.getNumberOfSetBits());
+    EXPECT_EQ(16ull, statesWithProbability01Min.second.getNumberOfSetBits());
+    EXPECT_EQ(993ull, statesWithProbability01Max.first.getNumberOfSetBits());
+    EXPECT_EQ(16ull, statesWithProbability01Max.second.getNumberOfSetBits());
+}
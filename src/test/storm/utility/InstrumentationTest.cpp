@@ -0,0 +1,166 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "json.hpp"
+namespace modernjson {
+    using json = nlohmann::json;
+}
+
+#include "storm/utility/instrumentation.h"
+
+#if defined STORM_HAVE_INTELTBB && (defined STORM_HAVE_HYPRO || defined STORM_HAVE_Z3_OPTIMIZE)
+#include "storm/api/storm.h"
+#include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+namespace {
+    uint64_t sumCounter(modernjson::json const& phase, std::string const& name) {
+        uint64_t result = 0;
+        if (phase["counters"].count(name) > 0) {
+            result += phase["counters"][name].get<uint64_t>();
+        }
+        for (auto const& child : phase["phases"]) {
+            result += sumCounter(child, name);
+        }
+        return result;
+    }
+}
+#endif
+
+TEST(InstrumentationTest, NestedPhasesAndCounters) {
+    storm::utility::instrumentation::enable();
+    storm::utility::instrumentation::reset();
+
+    for (uint_fast64_t i = 0; i < 3; ++i) {
+        storm::utility::instrumentation::ScopedPhase outer("model checking");
+        {
+            storm::utility::instrumentation::ScopedPhase inner("solving");
+            // Re-entering the active phase must not create a nested phase of the same name.
+            storm::utility::instrumentation::ScopedPhase recursive("solving");
+            storm::utility::instrumentation::addToCounter("iterations", 10);
+        }
+        storm::utility::instrumentation::addToCounter("iterations", 1);
+    }
+
+    std::stringstream stream;
+    storm::utility::instrumentation::exportToJson(stream);
+    modernjson::json profile = modernjson::json::parse(stream.str());
+
+    EXPECT_EQ("total", profile["name"].get<std::string>());
+    ASSERT_EQ(1ull, profile["phases"].size());
+
+    modernjson::json const& outer = profile["phases"][0];
+    EXPECT_EQ("model checking", outer["name"].get<std::string>());
+    EXPECT_EQ(3ull, outer["calls"].get<uint64_t>());
+    EXPECT_EQ(3ull, outer["counters"]["iterations"].get<uint64_t>());
+    ASSERT_EQ(1ull, outer["phases"].size());
+
+    modernjson::json const& inner = outer["phases"][0];
+    EXPECT_EQ("solving", inner["name"].get<std::string>());
+    EXPECT_EQ(3ull, inner["calls"].get<uint64_t>());
+    EXPECT_EQ(30ull, inner["counters"]["iterations"].get<uint64_t>());
+    EXPECT_TRUE(inner["phases"].empty());
+    EXPECT_LE(inner["time"].get<double>(), outer["time"].get<double>());
+    EXPECT_LE(outer["time"].get<double>(), profile["time"].get<double>());
+
+    // Nothing is recorded once recording is disabled again.
+    storm::utility::instrumentation::disable();
+    EXPECT_FALSE(storm::utility::instrumentation::isEnabled());
+    {
+        storm::utility::instrumentation::ScopedPhase outer("model checking");
+        storm::utility::instrumentation::ScopedPhase other("graph analysis");
+        storm::utility::instrumentation::addToCounter("iterations", 1);
+    }
+    stream.str("");
+    storm::utility::instrumentation::exportToJson(stream);
+    profile = modernjson::json::parse(stream.str());
+    ASSERT_EQ(1ull, profile["phases"].size());
+    EXPECT_EQ(3ull, profile["phases"][0]["calls"].get<uint64_t>());
+    EXPECT_EQ(3ull, profile["phases"][0]["counters"]["iterations"].get<uint64_t>());
+    EXPECT_EQ(1ull, profile["phases"][0]["phases"].size());
+
+    storm::utility::instrumentation::reset();
+}
+
+TEST(InstrumentationTest, WorkerThreads) {
+    storm::utility::instrumentation::enable();
+    storm::utility::instrumentation::reset();
+
+    uint64_t const numberOfThreads = 4;
+    uint64_t const itemsPerThread = 1000;
+    {
+        storm::utility::instrumentation::ScopedPhase parallel("parallel section");
+        std::vector<std::thread> threads;
+        for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+            threads.emplace_back([itemsPerThread] () {
+                for (uint64_t item = 0; item < itemsPerThread; ++item) {
+                    // Phases entered on other threads are ignored.
+                    storm::utility::instrumentation::ScopedPhase worker("worker");
+                    storm::utility::instrumentation::addToCounter("items", 1);
+                    storm::utility::instrumentation::addSolverIterations("value iterations", 2, 3, 10);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    std::stringstream stream;
+    storm::utility::instrumentation::exportToJson(stream);
+    modernjson::json profile = modernjson::json::parse(stream.str());
+
+    // The counters of all threads are attributed to the phase that was active on the recording thread.
+    ASSERT_EQ(1ull, profile["phases"].size());
+    modernjson::json const& parallel = profile["phases"][0];
+    EXPECT_EQ("parallel section", parallel["name"].get<std::string>());
+    EXPECT_EQ(1ull, parallel["calls"].get<uint64_t>());
+    EXPECT_TRUE(parallel["phases"].empty());
+    EXPECT_EQ(numberOfThreads * itemsPerThread, parallel["counters"]["items"].get<uint64_t>());
+    EXPECT_EQ(2 * numberOfThreads * itemsPerThread, parallel["counters"]["value iterations"].get<uint64_t>());
+    EXPECT_EQ(3 * numberOfThreads * itemsPerThread, parallel["counters"]["matrix-vector products"].get<uint64_t>());
+    EXPECT_EQ(30 * numberOfThreads * itemsPerThread, parallel["counters"]["nonzeros touched"].get<uint64_t>());
+
+    storm::utility::instrumentation::disable();
+    storm::utility::instrumentation::reset();
+}
+
+#if defined STORM_HAVE_INTELTBB && (defined STORM_HAVE_HYPRO || defined STORM_HAVE_Z3_OPTIMIZE)
+TEST(InstrumentationTest, ParallelPcaaQuery) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/multiobj_consensus2_3_2.nm";
+    std::string formulasAsString = "multi(Pmax=? [ F \"one_proc_err\" ], Pmax=? [ G \"one_coin_ok\" ]) ";
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+
+    // The weight vectors of a refinement step are checked on TBB worker threads.
+    std::unique_ptr<storm::settings::SettingMemento> tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+    storm::utility::instrumentation::enable();
+    storm::utility::instrumentation::reset();
+    {
+        storm::utility::instrumentation::ScopedPhase phase("model checking");
+        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(*mdp, formulas[0]->asMultiObjectiveFormula(), storm::modelchecker::multiobjective::MultiObjectiveMethodSelection::Pcaa);
+        EXPECT_TRUE(result->isExplicitParetoCurveCheckResult());
+    }
+    storm::utility::instrumentation::disable();
+
+    std::stringstream stream;
+    storm::utility::instrumentation::exportToJson(stream);
+    modernjson::json profile = modernjson::json::parse(stream.str());
+    ASSERT_EQ(1ull, profile["phases"].size());
+    EXPECT_EQ("model checking", profile["phases"][0]["name"].get<std::string>());
+    EXPECT_EQ(1ull, profile["phases"][0]["calls"].get<uint64_t>());
+    EXPECT_GT(sumCounter(profile, "matrix-vector products"), 0ull);
+    EXPECT_GE(sumCounter(profile, "nonzeros touched"), sumCounter(profile, "matrix-vector products"));
+
+    storm::utility::instrumentation::reset();
+}
+#endif
@@ -100,3 +100,32 @@ TEST(KSPTest, kspPathAsList) {
 
     EXPECT_EQ(reference, list);
 }
+
+TEST(KSPTest, computeUntilProbability) {
+    auto model = buildExampleModel();
+    storm::utility::ksp::ShortestPathsGenerator<double> spg(*model, testState);
+
+    double threshold = 0.02;
+    double accumulatedDistance = 0;
+    unsigned long numberOfPaths = spg.computeKSPUntil(threshold, [&accumulatedDistance] (unsigned long, double const& distance) {
+        accumulatedDistance += distance;
+        return true;
+    });
+
+    // the search stops with the first path that reaches the threshold
+    EXPECT_GE(accumulatedDistance, threshold);
+    EXPECT_LT(accumulatedDistance - spg.getDistance(numberOfPaths), threshold);
+    EXPECT_DOUBLE_EQ(0.015859334652581887, spg.getDistance(1));
+}
+
+TEST(KSPTest, computeUntilEarlyTermination) {
+    auto model = buildExampleModel();
+    storm::utility::ksp::ShortestPathsGenerator<double> spg(*model, testState);
+
+    unsigned long numberOfPaths = spg.computeKSPUntil(1.0, [] (unsigned long k, double const&) { return k < 3; });
+    EXPECT_EQ(3ul, numberOfPaths);
+
+    // a target with only one path does not trigger an exception
+    storm::utility::ksp::ShortestPathsGenerator<double> spg2(*model, stateWithOnlyOnePath);
+    EXPECT_EQ(1ul, spg2.computeKSPUntil(1.0));
+}